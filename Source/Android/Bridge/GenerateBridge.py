@@ -0,0 +1,564 @@
+#!/usr/bin/env python3
+#
+# @Author: Punal Manalan
+# @Description: Android Browser Custom Tab Plugin - JNI bridge generator.
+# @Date: 18/10/2026
+#
+# Reads ABCT_Bridge.idl and writes the C++ and Java halves of the JNI bridge plus the
+# ProGuard keep rules, so signatures, symbol names and keep rules cannot drift apart.
+#
+# Usage:
+#   python3 Source/Android/Bridge/GenerateBridge.py            regenerate
+#   python3 Source/Android/Bridge/GenerateBridge.py --check    exit 1 if any output is stale
+
+import argparse
+import os
+import re
+import sys
+
+BRIDGE_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_DIR = os.path.dirname(os.path.dirname(BRIDGE_DIR))
+IDL_PATH = os.path.join(BRIDGE_DIR, "ABCT_Bridge.idl")
+CPP_HEADER_PATH = os.path.join(SOURCE_DIR, "Private", "Android", "ABCT_JavaBridge.h")
+CPP_SOURCE_PATH = os.path.join(SOURCE_DIR, "Private", "Android", "ABCT_JavaBridge.cpp")
+UPL_PATH = os.path.join(SOURCE_DIR, "Android", "ChromeCustomTabs_UPL.xml")
+
+UPL_BEGIN = "# BEGIN GENERATED BRIDGE KEEP RULES (GenerateBridge.py)"
+UPL_END = "# END GENERATED BRIDGE KEEP RULES"
+
+# ============================================================================
+# Types
+# ============================================================================
+
+
+class BridgeType:
+    def __init__(self, name, java, signature, jni, cpp_in, cpp_out, call_kind):
+        self.name = name
+        self.java = java            # Java source type
+        self.signature = signature  # JNI descriptor
+        self.jni = jni              # JNI C type
+        self.cpp_in = cpp_in        # C++ parameter type of a call stub
+        self.cpp_out = cpp_out      # C++ parameter type of a callback handler / call return type
+        self.call_kind = call_kind  # Call<Kind>StaticMethod
+
+
+TYPES = {
+    "void": BridgeType("void", "void", "V", "void", None, "void", "Void"),
+    "boolean": BridgeType("boolean", "boolean", "Z", "jboolean", "bool", "bool", "Boolean"),
+    "int": BridgeType("int", "int", "I", "jint", "int32", "int32", "Int"),
+    "long": BridgeType("long", "long", "J", "jlong", "int64", "int64", "Long"),
+    "float": BridgeType("float", "float", "F", "jfloat", "float", "float", "Float"),
+    "double": BridgeType("double", "double", "D", "jdouble", "double", "double", "Double"),
+    "string": BridgeType("string", "String", "Ljava/lang/String;", "jstring", "const FString &", "FString", "Object"),
+    "bytes": BridgeType("bytes", "java.nio.ByteBuffer", "Ljava/nio/ByteBuffer;", "jobject", "TArrayView<const uint8>", "TArrayView<const uint8>", "Object"),
+}
+
+PROGUARD_TYPES = {"String": "java.lang.String"}
+
+
+class Param:
+    def __init__(self, type_, name):
+        self.type = type_
+        self.name = name
+
+    @property
+    def cpp_name(self):
+        return self.name[0].upper() + self.name[1:]
+
+    @property
+    def jni_name(self):
+        return "j" + self.cpp_name
+
+
+class Method:
+    def __init__(self, kind, return_type, name, params, line):
+        self.kind = kind
+        self.return_type = return_type
+        self.name = name
+        self.params = params
+        self.line = line
+
+    @property
+    def signature(self):
+        return "(" + "".join(p.type.signature for p in self.params) + ")" + self.return_type.signature
+
+    @property
+    def cpp_name(self):
+        name = self.name
+        if self.kind == "callback" and name.startswith("native"):
+            name = name[len("native"):]
+        return name[0].upper() + name[1:]
+
+
+class Bridge:
+    def __init__(self):
+        self.package = None
+        self.bridge_class = None
+        self.target_class = None
+        self.callbacks = []
+        self.calls = []
+
+    @property
+    def java_path(self):
+        return os.path.join(SOURCE_DIR, "Android", "Java", "src", *self.package.split("."), self.bridge_class + ".java")
+
+    @property
+    def jni_class_path(self):
+        return self.package.replace(".", "/") + "/" + self.bridge_class
+
+
+# ============================================================================
+# Parsing
+# ============================================================================
+
+METHOD_PATTERN = re.compile(r"^(callback|call)\s+(?:(\w+)\s+)?(\w+)\s*\((.*)\)$")
+
+
+def fail(line_number, message):
+    sys.exit("%s:%d: error: %s" % (IDL_PATH, line_number, message))
+
+
+def parse_type(line_number, name):
+    if name not in TYPES:
+        fail(line_number, "unknown type '%s' (expected one of %s)" % (name, ", ".join(TYPES)))
+    return TYPES[name]
+
+
+def parse(text):
+    bridge = Bridge()
+    names = set()
+    for line_number, raw in enumerate(text.splitlines(), 1):
+        line = raw.split("#", 1)[0].strip()
+        if not line:
+            continue
+
+        directive = line.split(None, 1)
+        if directive[0] in ("package", "bridge", "target"):
+            if len(directive) != 2:
+                fail(line_number, "'%s' needs a value" % directive[0])
+            setattr(bridge, {"package": "package", "bridge": "bridge_class", "target": "target_class"}[directive[0]], directive[1].strip())
+            continue
+
+        match = METHOD_PATTERN.match(line)
+        if not match:
+            fail(line_number, "cannot parse '%s'" % line)
+        kind, return_name, name, param_text = match.groups()
+        if kind == "callback" and return_name is not None:
+            fail(line_number, "callbacks return void; drop the return type")
+        return_type = parse_type(line_number, return_name or "void")
+        if return_type.name == "bytes":
+            fail(line_number, "bytes cannot be returned (the buffer would outlive the call)")
+        if name in names:
+            fail(line_number, "'%s' is declared twice (JNI has no overloads here)" % name)
+        names.add(name)
+
+        params = []
+        for param in filter(None, (p.strip() for p in param_text.split(","))):
+            parts = param.split()
+            if len(parts) != 2:
+                fail(line_number, "parameter '%s' must be '<type> <name>'" % param)
+            param_type = parse_type(line_number, parts[0])
+            if param_type.name == "void":
+                fail(line_number, "void parameter '%s'" % parts[1])
+            params.append(Param(param_type, parts[1]))
+
+        (bridge.callbacks if kind == "callback" else bridge.calls).append(Method(kind, return_type, name, params, line_number))
+
+    for attribute, directive in (("package", "package"), ("bridge_class", "bridge"), ("target_class", "target")):
+        if getattr(bridge, attribute) is None:
+            sys.exit("%s: error: missing '%s' directive" % (IDL_PATH, directive))
+    return bridge
+
+
+# ============================================================================
+# Emitters
+# ============================================================================
+
+
+def jni_mangle(name):
+    """JNI short-name mangling (JNI spec, "Resolving Native Method Names")"""
+    out = []
+    for char in name:
+        if char == ".":
+            out.append("_")
+        elif char == "_":
+            out.append("_1")
+        elif char == ";":
+            out.append("_2")
+        elif char == "[":
+            out.append("_3")
+        elif char.isascii() and char.isalnum():
+            out.append(char)
+        else:
+            out.append("_0%04x" % ord(char))
+    return "".join(out)
+
+
+def banner(description):
+    lines = [
+        "@Author: Punal Manalan",
+        "@Description: Android Browser Custom Tab Plugin - %s" % description,
+        "@Date: 18/10/2026",
+        "",
+        "GENERATED by Source/Android/Bridge/GenerateBridge.py from ABCT_Bridge.idl - do not edit.",
+    ]
+    return "/*\n" + "\n".join((" * " + line).rstrip() for line in lines) + "\n */\n"
+
+
+def cpp_params(method, for_call):
+    if for_call:
+        return ", ".join("%s%s" % (p.type.cpp_in, p.cpp_name if p.type.cpp_in.endswith("&") else " " + p.cpp_name) for p in method.params)
+    return ", ".join("%s %s" % (p.type.cpp_out, p.cpp_name) for p in method.params)
+
+
+def emit_cpp_header(bridge):
+    out = [banner("Generated JNI bridge."), "#pragma once", "", '#include "CoreMinimal.h"', ""]
+    out.append("/**")
+    out.append(" * ABCTJavaBridge")
+    out.append(" *")
+    out.append(" * C++ side of the JNI bridge to %s.%s." % (bridge.package, bridge.bridge_class))
+    out.append(" * Call stubs resolve the class and method IDs once and pass strings as UTF-16 without")
+    out.append(" * conversion; they log and return a default value when Java is unavailable or throws.")
+    out.append(" * Android only.")
+    out.append(" */")
+    out.append("namespace ABCTJavaBridge")
+    out.append("{")
+    out.append("    // ============================================================================")
+    out.append("    // C++ -> Java (generated)")
+    out.append("    // ============================================================================")
+    out.append("")
+    for method in bridge.calls:
+        out.append("    /** %s.%s%s */" % (bridge.target_class, method.name, method.signature))
+        out.append("    %s %s(%s);" % (method.return_type.cpp_out, method.cpp_name, cpp_params(method, True)))
+        out.append("")
+    out.append("    // ============================================================================")
+    out.append("    // Java -> C++ (implemented by hand in ChromeCustomTabsJNI.cpp)")
+    out.append("    // ============================================================================")
+    out.append("")
+    for method in bridge.callbacks:
+        note = " Buffers are only valid during the call." if any(p.type.name == "bytes" for p in method.params) else ""
+        out.append("    /** %s.%s, called on a Java thread.%s */" % (bridge.bridge_class, method.name, note))
+        out.append("    void %s(%s);" % (method.cpp_name, cpp_params(method, False)))
+        out.append("")
+    out[-1] = "}"
+    return "\n".join(out) + "\n"
+
+
+def emit_call_stub(method):
+    lines = []
+    ret = method.return_type
+    default = {"void": "", "boolean": "false", "string": "FString()"}.get(ret.name, "0")
+    fail_return = "return;" if ret.name == "void" else "return %s;" % default
+
+    lines.append("%s %s(%s)" % (ret.cpp_out, method.cpp_name, cpp_params(method, True)))
+    lines.append("{")
+    lines.append("    JNIEnv *Env = FAndroidApplication::GetJavaEnv();")
+    lines.append("    const FMethods *Methods = GetMethods(Env);")
+    lines.append("    if (Methods == nullptr || Methods->%s == nullptr)" % method.cpp_name)
+    lines.append("    {")
+    lines.append("        %s" % fail_return)
+    lines.append("    }")
+    lines.append("")
+
+    args = []
+    locals_ = []
+    for p in method.params:
+        if p.type.name == "string":
+            lines.append("    jstring %s = NewJavaString(Env, %s);" % (p.jni_name, p.cpp_name))
+            locals_.append(p.jni_name)
+        elif p.type.name == "bytes":
+            lines.append("    jobject %s = Env->NewDirectByteBuffer(const_cast<uint8 *>(%s.GetData()), %s.Num());" % (p.jni_name, p.cpp_name, p.cpp_name))
+            locals_.append(p.jni_name)
+        elif p.type.name == "boolean":
+            lines.append("    const jboolean %s = %s ? JNI_TRUE : JNI_FALSE;" % (p.jni_name, p.cpp_name))
+        else:
+            lines.append("    const %s %s = (%s)%s;" % (p.type.jni, p.jni_name, p.type.jni, p.cpp_name))
+        args.append(p.jni_name)
+
+    call = "Env->CallStatic%sMethod(Methods->Class, Methods->%s%s)" % (ret.call_kind, method.cpp_name, "".join(", " + a for a in args))
+    if ret.name == "void":
+        lines.append("    %s;" % call)
+    elif ret.name == "string":
+        lines.append("    jstring jResult = (jstring)%s;" % call)
+    else:
+        lines.append("    const %s jResult = %s;" % (ret.jni, call))
+
+    for local in locals_:
+        lines.append("    Env->DeleteLocalRef(%s);" % local)
+
+    if ret.name == "void":
+        lines.append("    ClearException(Env, \"%s\");" % method.name)
+    else:
+        lines.append("    if (ClearException(Env, \"%s\"))" % method.name)
+        lines.append("    {")
+        if ret.name == "string":
+            lines.append("        Env->DeleteLocalRef(jResult);")
+        lines.append("        %s" % fail_return)
+        lines.append("    }")
+    if ret.name == "boolean":
+        lines.append("    return jResult != JNI_FALSE;")
+    elif ret.name == "string":
+        lines.append("    FString Result = ToFString(Env, jResult);")
+        lines.append("    Env->DeleteLocalRef(jResult);")
+        lines.append("    return Result;")
+    elif ret.name != "void":
+        lines.append("    return (%s)jResult;" % ret.cpp_out)
+    lines.append("}")
+    return lines
+
+
+def emit_callback_export(bridge, method):
+    lines = []
+    params = ["JNIEnv *Env", "jclass Clazz"] + ["%s %s" % (p.type.jni, p.jni_name) for p in method.params]
+    symbol = "Java_%s_%s_%s" % (jni_mangle(bridge.package), jni_mangle(bridge.bridge_class), jni_mangle(method.name))
+    lines.append("JNIEXPORT void JNICALL %s(%s)" % (symbol, ", ".join(params)))
+    lines.append("{")
+    args = []
+    for p in method.params:
+        if p.type.name == "string":
+            args.append("ToFString(Env, %s)" % p.jni_name)
+        elif p.type.name == "bytes":
+            args.append("ToByteView(Env, %s)" % p.jni_name)
+        elif p.type.name == "boolean":
+            args.append("%s != JNI_FALSE" % p.jni_name)
+        else:
+            args.append("(%s)%s" % (p.type.cpp_out, p.jni_name))
+    lines.append("    ABCTJavaBridge::%s(%s);" % (method.cpp_name, ", ".join(args)))
+    lines.append("}")
+    return lines
+
+
+def emit_cpp_source(bridge):
+    needs_bytes = any(p.type.name == "bytes" for m in bridge.callbacks for p in m.params)
+    out = [banner("Generated JNI bridge."), '#include "ABCT_JavaBridge.h"', "", "#if PLATFORM_ANDROID", '#include "ABCT_Memory.h"',
+           '#include "Android/AndroidApplication.h"', '#include "Android/AndroidJavaEnv.h"', '#include "Misc/ScopeLock.h"', "#include <atomic>", ""]
+
+    out.append('static_assert(sizeof(TCHAR) == sizeof(jchar), "FString must be UTF-16 to share buffers with Java strings");')
+    out.append("")
+    out.append("namespace")
+    out.append("{")
+    out.append("    struct FMethods")
+    out.append("    {")
+    out.append("        jclass Class = nullptr;")
+    for method in bridge.calls:
+        out.append("        jmethodID %s = nullptr;" % method.cpp_name)
+    out.append("    };")
+    out.append("")
+    out.append("    /** Resolves the bridge class and every method ID once; retried until the class loader can see the class */")
+    out.append("    const FMethods *GetMethods(JNIEnv *Env)")
+    out.append("    {")
+    out.append("        static FMethods Methods;")
+    out.append("        static std::atomic<bool> bResolved(false);")
+    out.append("        static FCriticalSection ResolveLock;")
+    out.append("")
+    out.append("        if (Env == nullptr)")
+    out.append("        {")
+    out.append("            return nullptr;")
+    out.append("        }")
+    out.append("        if (bResolved.load(std::memory_order_acquire))")
+    out.append("        {")
+    out.append("            return &Methods;")
+    out.append("        }")
+    out.append("")
+    out.append("        FScopeLock Lock(&ResolveLock);")
+    out.append("        if (!bResolved.load(std::memory_order_relaxed))")
+    out.append("        {")
+    out.append('            jclass LocalClass = FAndroidApplication::FindJavaClass("%s");' % bridge.jni_class_path)
+    out.append("            if (LocalClass == nullptr)")
+    out.append("            {")
+    out.append('                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - %s class not found"));' % bridge.bridge_class)
+    out.append("                Env->ExceptionClear();")
+    out.append("                return nullptr;")
+    out.append("            }")
+    out.append("            Methods.Class = (jclass)Env->NewGlobalRef(LocalClass);")
+    out.append("            Env->DeleteLocalRef(LocalClass);")
+    out.append("")
+    for method in bridge.calls:
+        out.append('            Methods.%s = Env->GetStaticMethodID(Methods.Class, "%s", "%s");' % (method.cpp_name, method.name, method.signature))
+        out.append("            if (Methods.%s == nullptr)" % method.cpp_name)
+        out.append("            {")
+        out.append('                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - %s%s not found"));' % (method.name, method.signature))
+        out.append("                Env->ExceptionClear();")
+        out.append("            }")
+    out.append("            bResolved.store(true, std::memory_order_release);")
+    out.append("        }")
+    out.append("        return &Methods;")
+    out.append("    }")
+    out.append("")
+    out.append("    /** Logs and clears a pending Java exception; returns true if there was one */")
+    out.append("    bool ClearException(JNIEnv *Env, const char *MethodName)")
+    out.append("    {")
+    out.append("        if (!Env->ExceptionCheck())")
+    out.append("        {")
+    out.append("            return false;")
+    out.append("        }")
+    out.append("        Env->ExceptionDescribe();")
+    out.append("        Env->ExceptionClear();")
+    out.append('        UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - %s threw"), UTF8_TO_TCHAR(MethodName));')
+    out.append("        return true;")
+    out.append("    }")
+    out.append("")
+    out.append("    /** UTF-16 straight from FString; no UTF-8 round trip */")
+    out.append("    jstring NewJavaString(JNIEnv *Env, const FString &Value)")
+    out.append("    {")
+    out.append("        return Env->NewString(reinterpret_cast<const jchar *>(*Value), Value.Len());")
+    out.append("    }")
+    out.append("")
+    out.append("    /** Copies the UTF-16 code units of Value into a new FString with a single copy */")
+    out.append("    FString ToFString(JNIEnv *Env, jstring Value)")
+    out.append("    {")
+    out.append("        // Strings from Java are payloads on their way into the ingress queues")
+    out.append("        LLM_SCOPE_BYTAG(ABCT_Queues);")
+    out.append("        FString Result;")
+    out.append("        if (Value == nullptr)")
+    out.append("        {")
+    out.append("            return Result;")
+    out.append("        }")
+    out.append("        const jsize Length = Env->GetStringLength(Value);")
+    out.append("        if (Length > 0)")
+    out.append("        {")
+    out.append("            auto &Chars = Result.GetCharArray();")
+    out.append("            Chars.SetNumUninitialized(Length + 1);")
+    out.append("            Env->GetStringRegion(Value, 0, Length, reinterpret_cast<jchar *>(Chars.GetData()));")
+    out.append("            Chars[Length] = TEXT('\\0');")
+    out.append("        }")
+    out.append("        return Result;")
+    out.append("    }")
+    if needs_bytes:
+        out.append("")
+        out.append("    /** The memory of a direct ByteBuffer, without copying */")
+        out.append("    TArrayView<const uint8> ToByteView(JNIEnv *Env, jobject Buffer)")
+        out.append("    {")
+        out.append("        const uint8 *Data = Buffer != nullptr ? static_cast<const uint8 *>(Env->GetDirectBufferAddress(Buffer)) : nullptr;")
+        out.append("        return Data != nullptr ? TArrayView<const uint8>(Data, (int32)Env->GetDirectBufferCapacity(Buffer)) : TArrayView<const uint8>();")
+        out.append("    }")
+    out.append("}")
+    out.append("")
+    out.append("// ============================================================================")
+    out.append("// C++ -> Java")
+    out.append("// ============================================================================")
+    out.append("")
+    out.append("namespace ABCTJavaBridge")
+    out.append("{")
+    for method in bridge.calls:
+        out.extend("    " + line if line else "" for line in emit_call_stub(method))
+        out.append("")
+    out[-1] = "}"
+    out.append("")
+    out.append("// ============================================================================")
+    out.append("// Java -> C++")
+    out.append("// ============================================================================")
+    out.append("")
+    out.append('extern "C"')
+    out.append("{")
+    for method in bridge.callbacks:
+        out.extend("    " + line for line in emit_callback_export(bridge, method))
+        out.append("")
+    out[-1] = "}"
+    out.append("")
+    out.append("#endif // PLATFORM_ANDROID")
+    return "\n".join(out) + "\n"
+
+
+def java_params(method):
+    return ", ".join("%s %s" % (p.type.java, p.name) for p in method.params)
+
+
+def emit_java(bridge):
+    out = [banner("Generated JNI bridge."), "package %s;" % bridge.package, ""]
+    out.append("/**")
+    out.append(" * Java side of the JNI bridge. Native callbacks are implemented by ABCT_JavaBridge.cpp;")
+    out.append(" * the forwarders are what C++ calls, so a signature change in %s breaks" % bridge.target_class)
+    out.append(" * the Java build instead of failing GetStaticMethodID at run time.")
+    if any(p.type.name == "bytes" for m in bridge.callbacks + bridge.calls for p in m.params):
+        out.append(" * ByteBuffer arguments must be direct buffers.")
+    out.append(" */")
+    out.append("final class %s {" % bridge.bridge_class)
+    out.append("    private %s() {" % bridge.bridge_class)
+    out.append("    }")
+    out.append("")
+    out.append("    // Java -> C++")
+    out.append("")
+    for method in bridge.callbacks:
+        out.append("    static native void %s(%s);" % (method.name, java_params(method)))
+        out.append("")
+    out.append("    // C++ -> Java")
+    out.append("")
+    for method in bridge.calls:
+        args = ", ".join(p.name for p in method.params)
+        out.append("    static %s %s(%s) {" % (method.return_type.java, method.name, java_params(method)))
+        prefix = "" if method.return_type.name == "void" else "return "
+        out.append("        %s%s.%s(%s);" % (prefix, bridge.target_class, method.name, args))
+        out.append("    }")
+        out.append("")
+    out[-1] = "}"
+    return "\n".join(out) + "\n"
+
+
+def proguard_type(type_):
+    return PROGUARD_TYPES.get(type_.java, type_.java)
+
+
+def emit_keep_rules(bridge):
+    rules = [UPL_BEGIN, "-keep class %s.%s {" % (bridge.package, bridge.bridge_class)]
+    for method in bridge.callbacks:
+        rules.append("    static native void %s(%s);" % (method.name, ",".join(proguard_type(p.type) for p in method.params)))
+    for method in bridge.calls:
+        rules.append("    static %s %s(%s);" % (proguard_type(method.return_type), method.name, ",".join(proguard_type(p.type) for p in method.params)))
+    rules.append("}")
+    rules.append(UPL_END)
+    return rules
+
+
+def patch_upl(bridge, text):
+    begin = text.find(UPL_BEGIN)
+    end = text.find(UPL_END)
+    if begin < 0 or end < begin:
+        sys.exit("%s: error: generated keep rule markers not found" % UPL_PATH)
+    end += len(UPL_END)
+    return text[:begin] + "\n".join(emit_keep_rules(bridge)) + text[end:]
+
+
+# ============================================================================
+# Main
+# ============================================================================
+
+
+def read(path):
+    with open(path, "r", encoding="utf-8-sig", newline="") as handle:
+        return handle.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generates the ABCT JNI bridge from ABCT_Bridge.idl")
+    parser.add_argument("--check", action="store_true", help="exit 1 if any generated output is out of date")
+    options = parser.parse_args()
+
+    bridge = parse(read(IDL_PATH))
+    with open(UPL_PATH, "rb") as handle:
+        upl_bom = handle.read(3) == b"\xef\xbb\xbf"
+
+    outputs = [
+        (CPP_HEADER_PATH, emit_cpp_header(bridge), False),
+        (CPP_SOURCE_PATH, emit_cpp_source(bridge), False),
+        (bridge.java_path, emit_java(bridge), False),
+        (UPL_PATH, patch_upl(bridge, read(UPL_PATH)), upl_bom),
+    ]
+
+    stale = []
+    for path, content, bom in outputs:
+        current = read(path) if os.path.exists(path) else None
+        if current == content:
+            continue
+        stale.append(os.path.relpath(path, SOURCE_DIR))
+        if not options.check:
+            with open(path, "w", encoding="utf-8-sig" if bom else "utf-8", newline="\n") as handle:
+                handle.write(content)
+
+    for path in stale:
+        print(("stale: " if options.check else "wrote: ") + path)
+    return 1 if options.check and stale else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
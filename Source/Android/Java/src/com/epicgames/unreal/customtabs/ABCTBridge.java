@@ -0,0 +1,51 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Generated JNI bridge.
+ * @Date: 18/10/2026
+ *
+ * GENERATED by Source/Android/Bridge/GenerateBridge.py from ABCT_Bridge.idl - do not edit.
+ */
+
+package com.epicgames.unreal.customtabs;
+
+/**
+ * Java side of the JNI bridge. Native callbacks are implemented by ABCT_JavaBridge.cpp;
+ * the forwarders are what C++ calls, so a signature change in ChromeCustomTabs breaks
+ * the Java build instead of failing GetStaticMethodID at run time.
+ */
+final class ABCTBridge {
+    private ABCTBridge() {
+    }
+
+    // Java -> C++
+
+    static native void nativeOnTabOpened();
+
+    static native void nativeOnTabClosed();
+
+    static native void nativeOnNavigationEvent(int event, String url);
+
+    static native void nativeOnMessageChannelReady();
+
+    static native void nativeOnPostMessage(String message, String origin);
+
+    static native void nativeOnDeepLinkReceived(String action, String paramsJson);
+
+    static native void nativeOnReturnedToGame(boolean relaunched);
+
+    static native void nativeOnNothingToClose();
+
+    // C++ -> Java
+
+    static boolean openTab(String url, String toolbarColorHex, String userAgent, String customHeader) {
+        return ChromeCustomTabs.openTab(url, toolbarColorHex, userAgent, customHeader);
+    }
+
+    static void closeTab() {
+        ChromeCustomTabs.closeTab();
+    }
+
+    static boolean executeJava(String message) {
+        return ChromeCustomTabs.executeJava(message);
+    }
+}
@@ -14,6 +14,7 @@ import android.content.Intent;
 import android.net.Uri;
 import android.os.Build;
 import android.os.Bundle;
+import android.os.SystemClock;
 import android.util.Log;
 
 import androidx.annotation.Nullable;
@@ -32,6 +33,11 @@ import java.lang.ref.WeakReference;
 public final class ChromeCustomTabs {
     private static final String TAG = "UEChromeTabs";
 
+    // Request code the Custom Tab is started with, so close() can finish it in place
+    private static final int TAB_REQUEST_CODE = 0xABC7;
+    // Set on deep link intents once delivered, so onStart / onNewIntent do not deliver them again
+    private static final String EXTRA_DEEP_LINK_HANDLED = "com.epicgames.unreal.customtabs.DEEP_LINK_HANDLED";
+
     private static WeakReference<Activity> activityRef = new WeakReference<>(null);
     private static CustomTabsClient customTabsClient;
     private static CustomTabsSession customTabsSession;
@@ -40,6 +46,12 @@ public final class ChromeCustomTabs {
     private static Uri pendingOrigin;
     private static String lastNavigatedUrl = "";
 
+    // Return-to-game state, only touched on the UI thread
+    private static boolean tabLaunchedForResult;
+    private static boolean gameActivityResumed;
+    private static boolean closePending;
+    private static boolean closeRelaunched;
+
     private ChromeCustomTabs() {
     }
 
@@ -49,7 +61,7 @@ public final class ChromeCustomTabs {
             String url = lastNavigatedUrl;
             // Note: EXTRA_URL constant was removed in newer AndroidX versions
             // The URL tracking is handled through lastNavigatedUrl instead
-            nativeOnNavigationEvent(navigationEvent, url != null ? url : "");
+            ABCTBridge.nativeOnNavigationEvent(navigationEvent, url != null ? url : "");
 
             // Trigger PostMessage channel request when navigation finishes (if not already
             // ready)
@@ -67,7 +79,7 @@ public final class ChromeCustomTabs {
             }
 
             if (navigationEvent == TAB_SHOWN) {
-                nativeOnTabOpened();
+                ABCTBridge.nativeOnTabOpened();
             }
             if (navigationEvent == TAB_HIDDEN) {
                 // TAB_HIDDEN means the tab is still open but not visible (user switched apps)
@@ -84,13 +96,13 @@ public final class ChromeCustomTabs {
             messageChannelReady = true;
             pendingRetryOrigin = null; // Stop any pending retries
             Log.i(TAG, "PostMessage channel is now ready!");
-            nativeOnMessageChannelReady();
+            ABCTBridge.nativeOnMessageChannelReady();
         }
 
         @Override
         public void onPostMessage(String message, Bundle extras) {
             String origin = pendingOrigin != null ? pendingOrigin.toString() : "";
-            nativeOnPostMessage(message != null ? message : "", origin);
+            ABCTBridge.nativeOnPostMessage(message != null ? message : "", origin);
         }
     };
 
@@ -106,6 +118,35 @@ public final class ChromeCustomTabs {
         activityRef = new WeakReference<>(null);
     }
 
+    /**
+     * Call from GameActivity's onResume. Reports the end of a close() to native code, which
+     * times the return to the first game frame.
+     */
+    public static void onActivityResumed() {
+        gameActivityResumed = true;
+        if (closePending) {
+            closePending = false;
+            ABCTBridge.nativeOnReturnedToGame(closeRelaunched);
+        }
+    }
+
+    /**
+     * Call from GameActivity's onPause
+     */
+    public static void onActivityPaused() {
+        gameActivityResumed = false;
+    }
+
+    /**
+     * Call from GameActivity's onActivityResult. The tab finished (closed by the user or by
+     * close()), so there is nothing left to finish in place.
+     */
+    public static void onActivityResult(int requestCode) {
+        if (requestCode == TAB_REQUEST_CODE) {
+            tabLaunchedForResult = false;
+        }
+    }
+
     public static synchronized boolean isAvailable(@Nullable Activity activity) {
         if (activity == null) {
             return false;
@@ -159,8 +200,16 @@ public final class ChromeCustomTabs {
             Log.i(TAG, "Modified URL with query parameters: " + finalUrl);
         }
 
+        // Request the PostMessage channel for the page's origin so C++ can send messages
+        // (UCPP_ABCT_Base::SendMessageToPage) as soon as the page has loaded
+        Uri finalUri = Uri.parse(finalUrl);
+        String postMessageOrigin = null;
+        if (finalUri.getScheme() != null && finalUri.getAuthority() != null) {
+            postMessageOrigin = finalUri.getScheme() + "://" + finalUri.getAuthority();
+        }
+
         // Call full open() method with default parameters
-        return open(activity, finalUrl, toolbarColor, false, 0, true, true, true, null);
+        return open(activity, finalUrl, toolbarColor, false, 0, true, true, true, postMessageOrigin);
     }
 
     public static boolean open(final Activity activity,
@@ -284,6 +333,25 @@ public final class ChromeCustomTabs {
         }
 
         activity.runOnUiThread(() -> {
+            if (tabLaunchedForResult) {
+                // The tab sits on top of the game activity in its task: finishing it just resumes
+                // the game, without a round trip through the activity manager to relaunch it
+                tabLaunchedForResult = false;
+                closePending = true;
+                closeRelaunched = false;
+                activity.finishActivity(TAB_REQUEST_CODE);
+                return;
+            }
+            if (gameActivityResumed) {
+                // Nothing is covering the game (the user already closed the tab): there is no
+                // return to measure
+                ABCTBridge.nativeOnNothingToClose();
+                return;
+            }
+
+            // Fallback for a browser in its own task (ACTION_VIEW fallback): relaunch the game
+            closePending = true;
+            closeRelaunched = true;
             Intent intent = new Intent(activity, activity.getClass());
             intent.addFlags(
                     Intent.FLAG_ACTIVITY_CLEAR_TOP | Intent.FLAG_ACTIVITY_SINGLE_TOP | Intent.FLAG_ACTIVITY_NEW_TASK);
@@ -312,8 +380,12 @@ public final class ChromeCustomTabs {
         // compatibility
 
         CustomTabsIntent intent = builder.build();
-        intent.intent.addFlags(Intent.FLAG_ACTIVITY_SINGLE_TOP | Intent.FLAG_ACTIVITY_CLEAR_TOP);
-        intent.launchUrl(activity, Uri.parse(url));
+        // Same as launchUrl, but for a result and without CLEAR_TOP, so the tab stacks on the game
+        // activity in its task and close() can finish it with finishActivity
+        intent.intent.addFlags(Intent.FLAG_ACTIVITY_SINGLE_TOP);
+        intent.intent.setData(Uri.parse(url));
+        activity.startActivityForResult(intent.intent, TAB_REQUEST_CODE, intent.startAnimationBundle);
+        tabLaunchedForResult = true;
 
         if (customTabsSession != null && postMessageOrigin != null && !postMessageOrigin.isEmpty()) {
             requestPostMessageChannel(activity, postMessageOrigin);
@@ -383,6 +455,8 @@ public final class ChromeCustomTabs {
      * Call this from GameActivity's onNewIntent to process incoming Deep Links
      */
     public static boolean handleDeepLink(Intent intent) {
+        // Start of the intent stage of the deep link latency trace
+        long intentReceivedNanos = SystemClock.elapsedRealtimeNanos();
         Log.d(TAG, "handleDeepLink called");
 
         if (intent == null) {
@@ -390,6 +464,12 @@ public final class ChromeCustomTabs {
             return false;
         }
 
+        // The activity keeps its last intent, and onStart runs again every time the game returns
+        if (intent.getBooleanExtra(EXTRA_DEEP_LINK_HANDLED, false)) {
+            Log.d(TAG, "handleDeepLink: Intent already handled");
+            return false;
+        }
+
         Uri data = intent.getData();
         if (data == null) {
             Log.d(TAG, "handleDeepLink: Intent.getData() is NULL. Intent action=" + intent.getAction()
@@ -412,29 +492,36 @@ public final class ChromeCustomTabs {
         Log.i(TAG, "Action: " + action + ", Query: " + query);
 
         // Convert query string to JSON format for C++
-        String paramsJson = queryStringToJson(query);
+        // Batch links carry their sub-commands as a JSON array, passed through undecoded
+        String paramsJson = queryStringToJson(query, "batch".equalsIgnoreCase(action));
+        paramsJson = appendIntentAge(paramsJson, (SystemClock.elapsedRealtimeNanos() - intentReceivedNanos) / 1000L);
 
         // Notify native code
-        nativeOnDeepLinkReceived(action != null ? action : "", paramsJson);
+        intent.putExtra(EXTRA_DEEP_LINK_HANDLED, true);
+        ABCTBridge.nativeOnDeepLinkReceived(action != null ? action : "", paramsJson);
         return true;
     }
 
     /**
      * Convert URL query string to JSON format
      * Example: "text=hello&priority=high" -> "{"text":"hello","priority":"high"}"
+     *
+     * @param rawCmds Write the "cmds" value of batch links as raw JSON instead of a string
      */
-    private static String queryStringToJson(String query) {
+    private static String queryStringToJson(String query, boolean rawCmds) {
         if (query == null || query.isEmpty()) {
             return "{}";
         }
 
         StringBuilder json = new StringBuilder("{");
+        boolean first = true;
         String[] pairs = query.split("&");
         for (int i = 0; i < pairs.length; i++) {
             String[] keyValue = pairs[i].split("=", 2);
             if (keyValue.length == 2) {
-                if (i > 0)
+                if (!first)
                     json.append(",");
+                first = false;
 
                 // Decode URL-encoded value
                 String decodedValue = keyValue[1];
@@ -444,23 +531,61 @@ public final class ChromeCustomTabs {
                     // UTF-8 is always supported, but just in case keep original
                 }
 
-                json.append("\"").append(keyValue[0]).append("\":\"")
-                        .append(decodedValue).append("\"");
+                json.append("\"");
+                appendJsonEscaped(json, keyValue[0]);
+                json.append("\":");
+                if (rawCmds && "cmds".equals(keyValue[0])) {
+                    // Validated by the C++ decoder; a malformed array rejects the whole batch
+                    json.append(decodedValue);
+                } else {
+                    json.append("\"");
+                    appendJsonEscaped(json, decodedValue);
+                    json.append("\"");
+                }
             }
         }
         json.append("}");
         return json.toString();
     }
 
-    private static native void nativeOnTabOpened();
-
-    private static native void nativeOnTabClosed();
-
-    private static native void nativeOnNavigationEvent(int event, String url);
-
-    private static native void nativeOnMessageChannelReady();
-
-    private static native void nativeOnPostMessage(String message, String origin);
+    /**
+     * Add the time since the intent was received, so native code can place the intent on its clock
+     * Example: "{"x":"1"}", 42 -> "{"x":"1","_intent_age_us":42}"
+     */
+    private static String appendIntentAge(String json, long ageMicros) {
+        String field = "\"_intent_age_us\":" + ageMicros + "}";
+        return json.length() > 2 ? json.substring(0, json.length() - 1) + "," + field : "{" + field;
+    }
 
-    private static native void nativeOnDeepLinkReceived(String action, String paramsJson);
+    /**
+     * Append a string as the body of a JSON string literal
+     */
+    private static void appendJsonEscaped(StringBuilder json, String value) {
+        for (int i = 0; i < value.length(); i++) {
+            char c = value.charAt(i);
+            switch (c) {
+                case '"':
+                    json.append("\\\"");
+                    break;
+                case '\\':
+                    json.append("\\\\");
+                    break;
+                case '\n':
+                    json.append("\\n");
+                    break;
+                case '\r':
+                    json.append("\\r");
+                    break;
+                case '\t':
+                    json.append("\\t");
+                    break;
+                default:
+                    if (c < 0x20) {
+                        json.append(String.format("\\u%04x", (int) c));
+                    } else {
+                        json.append(c);
+                    }
+            }
+        }
+    }
 }
@@ -1,21 +1,42 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CPP_ABCT_Base.h"
+#include "ABCT_Backend.h"
+#include "ABCT_Benchmark.h"
+#include "ABCT_DeepLinkAuth.h"
+#include "ABCT_DeepLinkBatch.h"
+#include "ABCT_DeepLinkLatency.h"
+#include "ABCT_DeepLinkRouter.h"
+#include "ABCT_EchoPage.h"
+#include "ABCT_JsonWriter.h"
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_MetricsEndpoint.h"
+#include "ABCT_Prefetch.h"
+#include "ABCT_ResumePipeline.h"
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_Stats.h"
+#include "ABCT_StructSerializer.h"
+#include "ABCT_TabJobs.h"
+#include "CPP_ABCT_DeepLinkTagMap.h"
+#include "CPP_ABCT_PrefetchMap.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
-#if PLATFORM_ANDROID || defined(__ANDROID__)
-#include "Android/AndroidApplication.h"
-#include "Android/AndroidJavaEnv.h"
+#if PLATFORM_ANDROID
+#include "Android/ABCT_JavaBridge.h"
 #endif
 
 // ============================================================================
-// Global Registry for Active Chrome Custom Tab Instance (Android-only)
+// Global Registry for Active Chrome Custom Tab Instance
 // ============================================================================
 
-#if PLATFORM_ANDROID
 namespace ChromeCustomTabsRegistry
 {
     // The UCPP_ABCT_Base instance that currently has an open Chrome Custom Tab
@@ -38,7 +59,29 @@ namespace ChromeCustomTabsRegistry
         return ActiveInstance.IsValid() ? ActiveInstance.Get() : nullptr;
     }
 }
-#endif
+
+namespace
+{
+    /** Stamps Point on the latency trace of a deep link, if it is traced */
+    void StampDeepLinkTrace(FABCTDeepLinkTrace *Trace, EABCTDeepLinkStamp Point)
+    {
+        if (Trace)
+        {
+            Trace->Stamp(Point);
+        }
+    }
+}
+
+// Defined ahead of its callers in this file, the only one that uses it
+template <typename FmtType, typename... Types>
+void UCPP_ABCT_Base::DebugLogf(const FmtType &Format, Types... Args)
+{
+    if (bEnableDebugLogging)
+    {
+        LLM_SCOPE_BYTAG(ABCT);
+        DebugLog(*FString::Printf(Format, Args...));
+    }
+}
 
 // ============================================================================
 // Constructor
@@ -52,6 +95,7 @@ UCPP_ABCT_Base::UCPP_ABCT_Base()
     LastNavigationEvent = TEXT("");
     LastDeepLinkAction = TEXT("");
     LastDeepLinkParams = TEXT("");
+    bIsDispatchingDeepLinkBatch = false;
 
     // Initialize configuration variables with defaults
     DefaultToolbarColor = TEXT("#4285F4"); // Google Blue
@@ -59,6 +103,8 @@ UCPP_ABCT_Base::UCPP_ABCT_Base()
     bEnableUrlBarHiding = true;
     CustomUserAgent = TEXT(""); // Empty = use default browser user agent
     CustomHeader = TEXT("");    // Empty = no custom header
+    DeepLinkTagMap = nullptr;   // Null = every deep link goes to Blueprint
+    PrefetchMap = nullptr;      // Null = nothing is prefetched
 
     // Initialize debug settings
     bEnableDebugLogging = true; // Enable by default for development
@@ -66,80 +112,74 @@ UCPP_ABCT_Base::UCPP_ABCT_Base()
     DebugLog(TEXT("UCPP_ABCT_Base initialized"));
 }
 
+void UCPP_ABCT_Base::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+    {
+        ABCTStats::AddGauge(EABCTGauge::LiveInstances, 1);
+    }
+}
+
+void UCPP_ABCT_Base::BeginDestroy()
+{
+    if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+    {
+        ABCTStats::AddGauge(EABCTGauge::LiveInstances, -1);
+    }
+
+    Benchmark.Reset();
+    EchoPageServer.Reset();
+    Prefetcher.Reset();
+
+    Super::BeginDestroy();
+}
+
 // ============================================================================
 // Chrome Custom Tab - Opening URLs
 // ============================================================================
 
 bool UCPP_ABCT_Base::OpenChromeCustomTab(const FString &URL, const FString &ToolbarColor)
 {
-    DebugLog(FString::Printf(TEXT("OpenChromeCustomTab called with URL: %s, Color: %s"), *URL, *ToolbarColor));
+    DebugLogf(TEXT("OpenChromeCustomTab called with URL: %s, Color: %s"), *URL, *ToolbarColor);
+    ABCTStats::Increment(EABCTCounter::TabOpenRequests);
 
     if (URL.IsEmpty())
     {
         UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - URL is empty!"));
+        ABCTStats::Increment(EABCTCounter::TabOpenFailures);
         return false;
     }
 
-#if PLATFORM_ANDROID
-    // Call Java method to open Chrome Custom Tab
-    if (JNIEnv *Env = FAndroidApplication::GetJavaEnv())
+    // Simulated / test backends take precedence over the platform bridge
+    if (TSharedPtr<IABCTBackend> Backend = ABCTBackend::GetOverride())
     {
-        // Find ChromeCustomTabs class
-        jclass ChromeCustomTabsClass = FAndroidApplication::FindJavaClass("com/epicgames/unreal/customtabs/ChromeCustomTabs");
-        if (ChromeCustomTabsClass != nullptr)
-        {
-            // Find openTab static method with new signature (includes userAgent and customHeader)
-            jmethodID OpenTabMethod = Env->GetStaticMethodID(ChromeCustomTabsClass, "openTab", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z");
-            if (OpenTabMethod != nullptr)
-            {
-                // Convert FString to jstring
-                jstring jURL = Env->NewStringUTF(TCHAR_TO_UTF8(*URL));
-                jstring jColor = Env->NewStringUTF(TCHAR_TO_UTF8(*ToolbarColor));
-                jstring jUserAgent = Env->NewStringUTF(TCHAR_TO_UTF8(*CustomUserAgent));
-                jstring jCustomHeader = Env->NewStringUTF(TCHAR_TO_UTF8(*CustomHeader));
-
-                // Call Java method
-                jboolean result = Env->CallStaticBooleanMethod(ChromeCustomTabsClass, OpenTabMethod, jURL, jColor, jUserAgent, jCustomHeader);
-
-                // Clean up local references
-                Env->DeleteLocalRef(jURL);
-                Env->DeleteLocalRef(jColor);
-                Env->DeleteLocalRef(jUserAgent);
-                Env->DeleteLocalRef(jCustomHeader);
-                Env->DeleteLocalRef(ChromeCustomTabsClass);
-
-                if (result)
-                {
-                    OnCustomTabOpened(URL);
-                    DebugLog(TEXT("Chrome Custom Tab opened successfully"));
-                    return true;
-                }
-                else
-                {
-                    UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - Java method returned false"));
-                    return false;
-                }
-            }
-            else
-            {
-                UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - openTab method not found"));
-                Env->DeleteLocalRef(ChromeCustomTabsClass);
-                return false;
-            }
-        }
-        else
+        if (Backend->OpenTab(URL, ToolbarColor, CustomUserAgent, CustomHeader))
         {
-            UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - ChromeCustomTabs class not found"));
-            return false;
+            OnCustomTabOpened(ABCTUrlTable::Intern(URL), URL);
+            DebugLog(TEXT("Chrome Custom Tab opened successfully (override backend)"));
+            return true;
         }
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - Override backend returned false"));
+        ABCTStats::Increment(EABCTCounter::TabOpenFailures);
+        return false;
     }
-    else
+
+#if PLATFORM_ANDROID
+    // Call Java method to open Chrome Custom Tab (failures are logged by the bridge)
+    if (ABCTJavaBridge::OpenTab(URL, ToolbarColor, CustomUserAgent, CustomHeader))
     {
-        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - Failed to get JNI environment"));
-        return false;
+        OnCustomTabOpened(ABCTUrlTable::Intern(URL), URL);
+        DebugLog(TEXT("Chrome Custom Tab opened successfully"));
+        return true;
     }
+    UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - Java openTab failed"));
+    ABCTStats::Increment(EABCTCounter::TabOpenFailures);
+    return false;
 #else
     UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_Base::OpenChromeCustomTab - Not running on Android platform"));
+    ABCTStats::Increment(EABCTCounter::TabOpenFailures);
     return false;
 #endif
 }
@@ -147,49 +187,64 @@ bool UCPP_ABCT_Base::OpenChromeCustomTab(const FString &URL, const FString &Tool
 void UCPP_ABCT_Base::CloseChromeCustomTab()
 {
     DebugLog(TEXT("CloseChromeCustomTab called"));
+    ABCTStats::Increment(EABCTCounter::TabCloseRequests);
 
-#if PLATFORM_ANDROID
-    // Call Java method to close Chrome Custom Tab
-    if (JNIEnv *Env = FAndroidApplication::GetJavaEnv())
+    // Simulated / test backends take precedence over the platform bridge
+    if (TSharedPtr<IABCTBackend> Backend = ABCTBackend::GetOverride())
     {
-        jclass ChromeCustomTabsClass = FAndroidApplication::FindJavaClass("com/epicgames/unreal/customtabs/ChromeCustomTabs");
-        if (ChromeCustomTabsClass != nullptr)
-        {
-            jmethodID CloseTabMethod = Env->GetStaticMethodID(ChromeCustomTabsClass, "closeTab", "()V");
-            if (CloseTabMethod != nullptr)
-            {
-                Env->CallStaticVoidMethod(ChromeCustomTabsClass, CloseTabMethod);
-                OnCustomTabClosed();
-                DebugLog(TEXT("Chrome Custom Tab closed"));
-            }
-            else
-            {
-                UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::CloseChromeCustomTab - closeTab method not found"));
-            }
-            Env->DeleteLocalRef(ChromeCustomTabsClass);
-        }
-        else
-        {
-            UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::CloseChromeCustomTab - ChromeCustomTabs class not found"));
-        }
+        // The game never left the screen, so the next frame is the first one back
+        ABCTReturnToGame::BeginClose(false);
+        Backend->CloseTab();
+        OnCustomTabClosed();
+        DebugLog(TEXT("Chrome Custom Tab closed (override backend)"));
+        return;
     }
+
+#if PLATFORM_ANDROID
+    // Call Java method to close Chrome Custom Tab; it reports back once the game activity resumes
+    ABCTReturnToGame::BeginClose(true);
+    ABCTJavaBridge::CloseTab();
+    OnCustomTabClosed();
+    DebugLog(TEXT("Chrome Custom Tab closed"));
 #else
     UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_Base::CloseChromeCustomTab - Not running on Android platform"));
 #endif
 }
 
+float UCPP_ABCT_Base::GetLastReturnToGameMillis() const
+{
+    return (float)ABCTReturnToGame::GetLastMillis();
+}
+
 // ============================================================================
 // Chrome Custom Tab - Navigation Events
 // ============================================================================
 
 void UCPP_ABCT_Base::HandleNavigationEvent(const FString &Event, const FString &URL)
 {
-    DebugLog(FString::Printf(TEXT("HandleNavigationEvent: Event=%s, URL=%s"), *Event, *URL));
+    HandleNavigationEvent(FABCTEvent::MakeNavigation(Event, ABCTUrlTable::Intern(URL), URL));
+}
+
+void UCPP_ABCT_Base::HandleNavigationEvent(const FString &Event, const FABCTUrlRef &Url)
+{
+    HandleNavigationEvent(FABCTEvent::MakeNavigation(Event, Url));
+}
+
+void UCPP_ABCT_Base::HandleNavigationEvent(const FABCTEventRef &SharedEvent)
+{
+    FABCTScopedHistogramTimer HandlerTimer(EABCTHistogram::NavigationHandlerMicros);
+    ABCTStats::Increment(EABCTCounter::NavigationEventsDispatched);
+
+    const FString &Event = SharedEvent->GetName();
+    const FABCTUrlRef &Url = SharedEvent->GetUrl();
+    const FString &URL = SharedEvent->GetSourceUrlString();
+    DebugLogf(TEXT("HandleNavigationEvent: Event=%s, URL=%s"), *Event, *URL);
 
     // Update internal state
     LastNavigationEvent = Event;
-    if (!URL.IsEmpty())
+    if (Url.IsValid())
     {
+        CurrentUrl = Url;
         CurrentURL = URL;
     }
 
@@ -198,11 +253,47 @@ void UCPP_ABCT_Base::HandleNavigationEvent(const FString &Event, const FString &
     {
         OnCustomTabClosed();
     }
+    else if (Event == TEXT("TabHidden"))
+    {
+        BeginResume(EABCTResumeReason::TabHidden);
+    }
+    else if (Event == TEXT("MessageChannelReady"))
+    {
+        // A (re)loaded page has not seen any struct schema yet
+        SentStructSchemas.Reset();
+        FABCTMessageChannel::Get().SetReady(true);
+    }
     else if (Event == TEXT("NavigationStarted") && bIsCustomTabOpen == false)
     {
-        OnCustomTabOpened(URL);
+        OnCustomTabOpened(Url, URL);
+    }
+
+    // Start on the new page's assets while the browser is still loading it
+    if (Event == TEXT("NavigationStarted") && Url.IsValid())
+    {
+        PrefetchForPage(Url);
+    }
+
+    // Keep the cross-thread snapshot in step (events after close are ignored)
+    if (bIsCustomTabOpen)
+    {
+        const EABCTTabLifecycle Lifecycle = ABCTTabState::Read().Lifecycle;
+        if (Event == TEXT("TabShown"))
+        {
+            PublishTabState(EABCTTabLifecycle::Visible);
+        }
+        else if (Event == TEXT("TabHidden"))
+        {
+            PublishTabState(EABCTTabLifecycle::Hidden);
+        }
+        else if (Url.IsValid())
+        {
+            PublishTabState(Lifecycle);
+        }
     }
 
+    BroadcastEvent(SharedEvent);
+
     // Broadcast to Blueprint
     OnNavigationEvent(Event, URL);
 }
@@ -213,14 +304,462 @@ void UCPP_ABCT_Base::HandleNavigationEvent(const FString &Event, const FString &
 
 void UCPP_ABCT_Base::HandleDeepLink(const FString &Action, const FString &ParamsJson)
 {
-    DebugLog(FString::Printf(TEXT("HandleDeepLink: Action=%s, Params=%s"), *Action, *ParamsJson));
+    HandleDeepLink(FABCTEvent::MakeDeepLink(Action, ParamsJson));
+}
+
+void UCPP_ABCT_Base::HandleDeepLink(const FABCTEventRef &SharedEvent, FABCTDeepLinkTrace *Trace)
+{
+    const FString &Action = SharedEvent->GetName();
+    const FString &ParamsJson = SharedEvent->GetPayload();
+
+    if (ABCTDeepLinkBatch::IsBatchAction(Action))
+    {
+        HandleDeepLinkBatch(SharedEvent, Trace);
+        return;
+    }
+
+    FABCTScopedHistogramTimer HandlerTimer(EABCTHistogram::DeepLinkHandlerMicros);
+    ABCTStats::Increment(EABCTCounter::DeepLinksDispatched);
+    DebugLogf(TEXT("HandleDeepLink: Action=%s, Params=%s"), *Action, *ParamsJson);
 
     // Update internal state
     LastDeepLinkAction = Action;
     LastDeepLinkParams = ParamsJson;
+    PrefetchForDeepLink(SharedEvent);
+
+    FABCTDeepLinkEvent TagEvent;
+    const bool bMapped = DecodeDeepLinkTagEvent(SharedEvent, TagEvent);
+    StampDeepLinkTrace(Trace, EABCTDeepLinkStamp::Decoded);
+
+    BroadcastEvent(SharedEvent);
+    StampDeepLinkTrace(Trace, EABCTDeepLinkStamp::Dispatched);
+
+    // Mapped actions are handled natively and skip the Blueprint VM
+    if (!bMapped || !RouteDeepLinkByTag(TagEvent))
+    {
+        // Broadcast to Blueprint
+        OnDeepLinkReceived(Action, ParamsJson);
+    }
+
+    if (Trace)
+    {
+        Trace->Stamp(EABCTDeepLinkStamp::Completed);
+        ABCTDeepLinkLatency::Record(*Trace, Action);
+    }
+}
+
+void UCPP_ABCT_Base::HandleDeepLinkBatch(const FABCTEventRef &SharedEvent, FABCTDeepLinkTrace *Trace)
+{
+    ABCTStats::Increment(EABCTCounter::DeepLinkBatchesReceived);
+
+    TArray<FABCTEventRef> Commands;
+    FString Error;
+    if (bIsDispatchingDeepLinkBatch || !ABCTDeepLinkBatch::Decode(SharedEvent->GetPayload(), Commands, Error))
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::HandleDeepLinkBatch - Rejected batch: %s"), bIsDispatchingDeepLinkBatch ? TEXT("nested batch") : *Error);
+        ABCTStats::Increment(EABCTCounter::DeepLinkBatchesRejected);
+        return;
+    }
+    DebugLogf(TEXT("HandleDeepLinkBatch: %d commands"), Commands.Num());
+    StampDeepLinkTrace(Trace, EABCTDeepLinkStamp::Decoded);
+
+    // Every sub-command runs before control returns to the frame, so none is seen half-applied
+    bIsDispatchingDeepLinkBatch = true;
+    for (const FABCTEventRef &Command : Commands)
+    {
+        HandleDeepLink(Command);
+    }
+    bIsDispatchingDeepLinkBatch = false;
+    StampDeepLinkTrace(Trace, EABCTDeepLinkStamp::Dispatched);
+
+    OnDeepLinkBatchCompleted(Commands.Num());
+
+    // The whole batch is one tap, recorded under the "batch" action
+    if (Trace)
+    {
+        Trace->Stamp(EABCTDeepLinkStamp::Completed);
+        ABCTDeepLinkLatency::Record(*Trace, SharedEvent->GetName());
+    }
+}
+
+bool UCPP_ABCT_Base::DecodeDeepLinkTagEvent(const FABCTEventRef &SharedEvent, FABCTDeepLinkEvent &Event)
+{
+    if (!DeepLinkTagMap)
+    {
+        return false;
+    }
+
+    const FGameplayTag Tag = DeepLinkTagMap->FindTag(SharedEvent->GetName());
+    if (!Tag.IsValid())
+    {
+        return false;
+    }
+
+    const FString &ParamsJson = SharedEvent->GetPayload();
+    Event.Tag = Tag;
+    Event.Link = FABCTEventHandle(SharedEvent);
+    Event.Instance = this;
+
+    // Params are flat string maps built by the Java side from the query string
+    LLM_SCOPE_BYTAG(ABCT_Parsing);
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ParamsJson);
+    if (!ParamsJson.IsEmpty() && FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+    {
+        Event.Params.Reserve(JsonObject->Values.Num());
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : JsonObject->Values)
+        {
+            FString Value;
+            if (Pair.Value.IsValid() && Pair.Value->TryGetString(Value))
+            {
+                Event.Params.Add(Pair.Key, MoveTemp(Value));
+            }
+        }
+    }
+    return true;
+}
+
+bool UCPP_ABCT_Base::RouteDeepLinkByTag(const FABCTDeepLinkEvent &Event)
+{
+    ABCTStats::Increment(EABCTCounter::DeepLinksRoutedByTag);
+    const int32 NumTagsHandled = ABCTDeepLinkRouter::Dispatch(Event);
+    DebugLogf(TEXT("RouteDeepLinkByTag: Action=%s, Tag=%s, Handlers=%d"), *Event.GetAction(), *Event.Tag.ToString(), NumTagsHandled);
+
+    // A mapped action nobody registered a handler for still reaches Blueprint
+    return NumTagsHandled > 0 && !DeepLinkTagMap->bAlsoNotifyBlueprint;
+}
+
+// ============================================================================
+// PostMessage - Receiving from Web Pages
+// ============================================================================
+
+bool UCPP_ABCT_Base::SendMessageToPage(const FString &Message, EABCTMessageLane Lane)
+{
+    if (!bIsCustomTabOpen)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_Base::SendMessageToPage - No Chrome Custom Tab is open"));
+        return false;
+    }
+    if (Lane >= EABCTMessageLane::Count)
+    {
+        Lane = EABCTMessageLane::Interactive;
+    }
+
+    FABCTMessageChannel::Get().Send(Lane, Message);
+    return true;
+}
+
+bool UCPP_ABCT_Base::SendJsonToPage(TFunctionRef<void(FABCTJsonWriter &)> Build, EABCTMessageLane Lane, int32 ReserveChars)
+{
+    if (!bIsCustomTabOpen)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_Base::SendJsonToPage - No Chrome Custom Tab is open"));
+        return false;
+    }
+    if (Lane >= EABCTMessageLane::Count)
+    {
+        Lane = EABCTMessageLane::Interactive;
+    }
+
+    FABCTMessageChannel &Channel = FABCTMessageChannel::Get();
+    FString Payload = Channel.AcquirePayloadBuffer(ReserveChars);
+    FABCTJsonWriter Writer(Payload);
+    Build(Writer);
+    if (!Writer.IsComplete())
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::SendJsonToPage - Build did not write a complete JSON value"));
+        Channel.ReleasePayloadBuffer(MoveTemp(Payload));
+        return false;
+    }
+
+    Channel.Send(Lane, MoveTemp(Payload));
+    return true;
+}
+
+bool UCPP_ABCT_Base::SendStruct(const UScriptStruct *Struct, const void *Data, EABCTStructFormat Format, EABCTMessageLane Lane)
+{
+    if (Struct == nullptr || Data == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::SendStruct - No struct given"));
+        return false;
+    }
+
+    // The page needs the layout before the first binary message of a struct; both go on the
+    // same lane, so the schema always arrives first
+    const uint32 SchemaHash = Format == EABCTStructFormat::Binary ? ABCTStructSerializer::GetSchemaHash(Struct) : 0;
+    if (Format == EABCTStructFormat::Binary && !SentStructSchemas.Contains(SchemaHash))
+    {
+        if (!SendJsonToPage([Struct](FABCTJsonWriter &Writer)
+                            { ABCTStructSerializer::WriteSchemaMessage(Struct, Writer); }, Lane))
+        {
+            return false;
+        }
+        SentStructSchemas.Add(SchemaHash);
+    }
+
+    return SendJsonToPage([Struct, Data, Format](FABCTJsonWriter &Writer)
+                          { ABCTStructSerializer::WriteMessage(Struct, Data, Format, Writer); }, Lane);
+}
+
+bool UCPP_ABCT_Base::SendStructToPage(const int32 &Value, EABCTStructFormat Format, EABCTMessageLane Lane)
+{
+    // Only reachable through execSendStructToPage
+    checkNoEntry();
+    return false;
+}
+
+DEFINE_FUNCTION(UCPP_ABCT_Base::execSendStructToPage)
+{
+    Stack.MostRecentProperty = nullptr;
+    Stack.MostRecentPropertyAddress = nullptr;
+    Stack.StepCompiledIn<FStructProperty>(nullptr);
+    const FStructProperty *StructProperty = CastField<FStructProperty>(Stack.MostRecentProperty);
+    const void *StructData = Stack.MostRecentPropertyAddress;
+    P_GET_ENUM(EABCTStructFormat, Format);
+    P_GET_ENUM(EABCTMessageLane, Lane);
+    P_FINISH;
+
+    P_NATIVE_BEGIN;
+    *(bool *)RESULT_PARAM = StructProperty != nullptr && P_THIS->SendStruct(StructProperty->Struct, StructData, Format, Lane);
+    P_NATIVE_END;
+}
+
+void UCPP_ABCT_Base::HandlePostMessage(const FString &Message, const FString &Origin)
+{
+    HandlePostMessage(FABCTEvent::MakePageMessage(Message, Origin));
+}
+
+void UCPP_ABCT_Base::HandlePostMessage(const FABCTEventRef &SharedEvent)
+{
+    ABCTStats::Increment(EABCTCounter::PostMessagesDispatched);
+
+    const FString &Message = SharedEvent->GetPayload();
+    const FString &Origin = SharedEvent->GetOrigin();
+
+    // Benchmark acks are consumed by the runner and never reach Blueprint
+    if (Benchmark.IsValid() && !Benchmark->IsFinished() && Benchmark->HandleMessage(Message))
+    {
+        return;
+    }
+
+    DebugLogf(TEXT("HandlePostMessage: Origin=%s, Message=%s"), *Origin, *Message);
+
+    BroadcastEvent(SharedEvent);
 
     // Broadcast to Blueprint
-    OnDeepLinkReceived(Action, ParamsJson);
+    OnPostMessageReceived(Message, Origin);
+}
+
+// ============================================================================
+// Events - Shared Payloads
+// ============================================================================
+
+void UCPP_ABCT_Base::BroadcastEvent(const FABCTEventRef &SharedEvent)
+{
+    NativeEventListeners.Broadcast(SharedEvent);
+
+    // The handle is only built when Blueprint listens
+    if (OnEventReceived.IsBound())
+    {
+        OnEventReceived.Broadcast(FABCTEventHandle(SharedEvent));
+    }
+}
+
+// ============================================================================
+// Benchmark
+// ============================================================================
+
+bool UCPP_ABCT_Base::StartChannelBenchmark(const FString &ReportPath)
+{
+    return StartChannelBenchmarkWithConfig(FABCTBenchmarkConfig(), ReportPath);
+}
+
+bool UCPP_ABCT_Base::StartChannelBenchmarkWithConfig(const FABCTBenchmarkConfig &Config, const FString &ReportPath)
+{
+    if (IsChannelBenchmarkRunning() || bIsCustomTabOpen)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_Base::StartChannelBenchmark - A benchmark or Custom Tab is already running"));
+        return false;
+    }
+
+    int32 Port = 9465;
+    FParse::Value(FCommandLine::Get(), TEXT("ABCTBenchmarkPort="), Port);
+    const FString URL = FString::Printf(TEXT("http://127.0.0.1:%d%s"), Port, ANSI_TO_TCHAR(ABCTEchoPage::Path));
+
+    // The simulated backend plays the echo page itself; the browser loads it from loopback
+    TSharedPtr<IABCTBackend> Backend = ABCTBackend::GetOverride();
+    if (!Backend.IsValid())
+    {
+        EchoPageServer = MakeShared<FABCTMetricsEndpoint>();
+        if (Port <= 0 || Port > MAX_uint16 || !EchoPageServer->Start((uint16)Port, false))
+        {
+            UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::StartChannelBenchmark - Cannot serve the echo page on port %d"), Port);
+            EchoPageServer.Reset();
+            return false;
+        }
+    }
+
+    BenchmarkReportPath = ReportPath;
+    Benchmark = MakeShared<FABCTBenchmark>(Config, Backend.IsValid() ? Backend->GetName() : FString(TEXT("android")),
+                                           FABCTBenchmark::FOnFinished::CreateUObject(this, &UCPP_ABCT_Base::OnChannelBenchmarkComplete));
+
+    if (!OpenChromeCustomTab(URL))
+    {
+        Benchmark.Reset();
+        EchoPageServer.Reset();
+        return false;
+    }
+    DebugLogf(TEXT("Channel benchmark started: %s"), *URL);
+    return true;
+}
+
+bool UCPP_ABCT_Base::IsChannelBenchmarkRunning() const
+{
+    return Benchmark.IsValid() && !Benchmark->IsFinished();
+}
+
+void UCPP_ABCT_Base::OnChannelBenchmarkComplete(const FString &ReportJson)
+{
+    LastBenchmarkReport = ReportJson;
+
+    FString ReportPath = BenchmarkReportPath;
+    if (ReportPath.IsEmpty())
+    {
+        ReportPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ABCT"), FString::Printf(TEXT("ChannelBenchmark-%s.json"), *FDateTime::Now().ToString()));
+    }
+    if (FFileHelper::SaveStringToFile(ReportJson, *ReportPath))
+    {
+        UE_LOG(LogTemp, Log, TEXT("UCPP_ABCT_Base: Channel benchmark report written to %s"), *ReportPath);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::OnChannelBenchmarkComplete - Failed to write %s"), *ReportPath);
+        ReportPath.Reset();
+    }
+
+    if (bIsCustomTabOpen)
+    {
+        CloseChromeCustomTab();
+    }
+    EchoPageServer.Reset();
+
+    // Broadcast to Blueprint
+    OnChannelBenchmarkFinished(ReportJson, ReportPath);
+}
+
+// ============================================================================
+// Deep Link - Signing
+// ============================================================================
+
+void UCPP_ABCT_Base::SetDeepLinkSigningKey(const FString &Key, const TArray<FString> &SignedActions)
+{
+    const FTCHARToUTF8 KeyUtf8(*Key, Key.Len());
+    ABCTDeepLinkAuth::SetKey(TConstArrayView<uint8>((const uint8 *)KeyUtf8.Get(), KeyUtf8.Length()));
+    ABCTDeepLinkAuth::SetSignedActions(SignedActions);
+    DebugLogf(TEXT("Deep link signing %s, %d signed actions"), Key.IsEmpty() ? TEXT("off") : TEXT("on"), SignedActions.Num());
+}
+
+// ============================================================================
+// Memory
+// ============================================================================
+
+void UCPP_ABCT_Base::SetMemoryBudget(int64 BudgetBytes)
+{
+    ABCTMemory::SetBudgetBytes(BudgetBytes);
+    DebugLogf(TEXT("Memory budget set to %lld bytes"), BudgetBytes);
+}
+
+int64 UCPP_ABCT_Base::GetTrackedMemoryBytes() const
+{
+    return ABCTMemory::GetTotalBytes();
+}
+
+bool UCPP_ABCT_Base::IsSheddingMemory() const
+{
+    return ABCTMemory::GetShedLevel() != EABCTShedLevel::None;
+}
+
+// ============================================================================
+// Resume
+// ============================================================================
+
+FABCTResumeProfile UCPP_ABCT_Base::GetLastResumeProfile() const
+{
+    return ABCTResumePipeline::GetLastProfile();
+}
+
+void UCPP_ABCT_Base::BeginResume(EABCTResumeReason Reason)
+{
+    TWeakObjectPtr<UCPP_ABCT_Base> WeakThis(this);
+    const bool bStarted = ABCTResumePipeline::Begin(Reason, FABCTResumeProfileReady::CreateLambda([WeakThis](const FABCTResumeProfile &Profile)
+                                                                                                  {
+        if (UCPP_ABCT_Base *This = WeakThis.Get())
+        {
+            This->DebugLogf(TEXT("Resume profiled: %d frames, worst %.1f ms, restore took %d frames"),
+                            Profile.FrameMillis.Num(), Profile.WorstFrameMillis, Profile.RestoreFrames);
+            This->OnResumeProfileReady(Profile);
+        } }));
+    if (bStarted)
+    {
+        DebugLogf(TEXT("Resume started (%s)"), Reason == EABCTResumeReason::TabHidden ? TEXT("tab hidden") : TEXT("tab closed"));
+    }
+}
+
+// ============================================================================
+// Background Jobs
+// ============================================================================
+
+FABCTTabJobSessionStats UCPP_ABCT_Base::GetLastTabJobSessionStats() const
+{
+    return ABCTTabJobs::GetLastSessionStats();
+}
+
+// ============================================================================
+// Asset Prefetch
+// ============================================================================
+
+void UCPP_ABCT_Base::SetPrefetchMap(UCPP_ABCT_PrefetchMap *Map)
+{
+    if (Map != PrefetchMap && Prefetcher.IsValid())
+    {
+        Prefetcher->Reset();
+    }
+    PrefetchMap = Map;
+}
+
+void UCPP_ABCT_Base::PrefetchForPage(const FABCTUrlRef &Url)
+{
+    if (!PrefetchMap)
+    {
+        return;
+    }
+    if (!Prefetcher.IsValid())
+    {
+        Prefetcher = MakeShared<FABCTPrefetcher>();
+    }
+
+    FABCTPrefetchRequest Request;
+    if (Url.IsValid() && PrefetchMap->ResolvePage(*Url, Request))
+    {
+        DebugLogf(TEXT("Prefetch for page %s: %s"), *Url->GetCanonical(), *Request.Key);
+    }
+    Prefetcher->SetPage(MoveTemp(Request), PrefetchMap->MaxRetainedLoads);
+}
+
+void UCPP_ABCT_Base::PrefetchForDeepLink(const FABCTEventRef &SharedEvent)
+{
+    FABCTPrefetchRequest Request;
+    if (!PrefetchMap || !PrefetchMap->ResolveDeepLink(SharedEvent->GetName(), SharedEvent->GetPayload(), Request))
+    {
+        return;
+    }
+    if (!Prefetcher.IsValid())
+    {
+        Prefetcher = MakeShared<FABCTPrefetcher>();
+    }
+
+    DebugLogf(TEXT("Prefetch for deep link %s: %s"), *SharedEvent->GetName(), *Request.Key);
+    Prefetcher->AddDeepLink(MoveTemp(Request), PrefetchMap->MaxRetainedLoads);
 }
 
 // ============================================================================
@@ -233,29 +772,36 @@ bool UCPP_ABCT_Base::GetDeepLinkParameter(const FString &ParamsJson, const FStri
     {
         return false;
     }
+    ABCTStats::Increment(EABCTCounter::ParameterLookups);
 
     // Parse JSON string
+    LLM_SCOPE_BYTAG(ABCT_Parsing);
     TSharedPtr<FJsonObject> JsonObject;
     TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ParamsJson);
 
-    if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+    const uint64 ParseStartCycles = FPlatformTime::Cycles64();
+    const bool bParsed = FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid();
+    ABCTStats::RecordCyclesSince(EABCTHistogram::ParameterParseMicros, ParseStartCycles);
+
+    if (bParsed)
     {
         // Try to get the value
         if (JsonObject->HasField(Key))
         {
             OutValue = JsonObject->GetStringField(Key);
-            DebugLog(FString::Printf(TEXT("GetDeepLinkParameter: Key=%s, Value=%s"), *Key, *OutValue));
+            DebugLogf(TEXT("GetDeepLinkParameter: Key=%s, Value=%s"), *Key, *OutValue);
             return true;
         }
         else
         {
-            DebugLog(FString::Printf(TEXT("GetDeepLinkParameter: Key=%s not found in JSON"), *Key));
+            DebugLogf(TEXT("GetDeepLinkParameter: Key=%s not found in JSON"), *Key);
             return false;
         }
     }
     else
     {
         UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_Base::GetDeepLinkParameter - Failed to parse JSON: %s"), *ParamsJson);
+        ABCTStats::Increment(EABCTCounter::ParameterParseFailures);
         return false;
     }
 }
@@ -292,12 +838,12 @@ bool UCPP_ABCT_Base::GetDeepLinkParameterAsVector(const FString &ParamsJson, FVe
     if (bFoundX && bFoundY && bFoundZ)
     {
         OutVector = FVector(X, Y, Z);
-        DebugLog(FString::Printf(TEXT("GetDeepLinkParameterAsVector: X=%f, Y=%f, Z=%f"), X, Y, Z));
+        DebugLogf(TEXT("GetDeepLinkParameterAsVector: X=%f, Y=%f, Z=%f"), X, Y, Z);
         return true;
     }
     else
     {
-        DebugLog(FString::Printf(TEXT("GetDeepLinkParameterAsVector: Failed to extract all components (X=%d, Y=%d, Z=%d)"), bFoundX, bFoundY, bFoundZ));
+        DebugLogf(TEXT("GetDeepLinkParameterAsVector: Failed to extract all components (X=%d, Y=%d, Z=%d)"), bFoundX, bFoundY, bFoundZ);
         return false;
     }
 }
@@ -306,34 +852,68 @@ bool UCPP_ABCT_Base::GetDeepLinkParameterAsVector(const FString &ParamsJson, FVe
 // Internal Helper Functions
 // ============================================================================
 
-void UCPP_ABCT_Base::DebugLog(const FString &Message)
+void UCPP_ABCT_Base::DebugLog(const TCHAR *Message)
 {
     if (bEnableDebugLogging)
     {
-        UE_LOG(LogTemp, Log, TEXT("UCPP_ABCT_Base: %s"), *Message);
+        UE_LOG(LogTemp, Log, TEXT("UCPP_ABCT_Base: %s"), Message);
     }
 }
 
-void UCPP_ABCT_Base::OnCustomTabOpened(const FString &URL)
+void UCPP_ABCT_Base::OnCustomTabOpened(const FABCTUrlRef &Url, const FString &URL)
 {
     bIsCustomTabOpen = true;
+    CurrentUrl = Url;
     CurrentURL = URL;
-    DebugLog(FString::Printf(TEXT("Custom Tab opened: %s"), *URL));
+    ABCTStats::SetGauge(EABCTGauge::TabOpen, 1);
+    DebugLogf(TEXT("Custom Tab opened: %s"), *URL);
+    PublishTabState(EABCTTabLifecycle::Opening);
 
     // Register this instance with the global registry so it receives deep links
-#if PLATFORM_ANDROID
     ChromeCustomTabsRegistry::RegisterActiveInstance(this);
-#endif
 }
 
 void UCPP_ABCT_Base::OnCustomTabClosed()
 {
     bIsCustomTabOpen = false;
+    CurrentUrl.Reset();
     CurrentURL = TEXT("");
+    ABCTStats::SetGauge(EABCTGauge::TabOpen, 0);
+    SentStructSchemas.Reset();
     DebugLog(TEXT("Custom Tab closed"));
+    PublishTabState(EABCTTabLifecycle::Closed);
+    BeginResume(EABCTResumeReason::TabClosed);
+
+    // The last page's unfinished loads are cancelled; finished ones stay for the game
+    PrefetchForPage(nullptr);
+
+    // Queued outbound messages cannot reach a closed page
+    FABCTMessageChannel::Get().SetReady(false);
 
     // Unregister this instance from the global registry
-#if PLATFORM_ANDROID
     ChromeCustomTabsRegistry::UnregisterActiveInstance();
-#endif
+}
+
+void UCPP_ABCT_Base::PublishTabState(EABCTTabLifecycle Lifecycle)
+{
+    FABCTTabStateSnapshot Snapshot = ABCTTabState::Read();
+    const uint64 NowCycles = FPlatformTime::Cycles64();
+
+    if (Lifecycle == EABCTTabLifecycle::Closed)
+    {
+        Snapshot.OpenedCycles = 0;
+    }
+    else if (Snapshot.Lifecycle == EABCTTabLifecycle::Closed)
+    {
+        Snapshot.OpenedCycles = NowCycles;
+    }
+    if (Snapshot.Lifecycle != Lifecycle)
+    {
+        Snapshot.LifecycleChangedCycles = NowCycles;
+    }
+    Snapshot.Lifecycle = Lifecycle;
+    Snapshot.UrlId = CurrentUrl.IsValid() ? CurrentUrl->GetId() : 0;
+
+    ABCTTabState::Publish(Snapshot);
+    ABCTTabJobs::OnTabStateChanged(Snapshot);
 }
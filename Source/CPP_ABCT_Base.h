@@ -8,8 +8,24 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "ABCT_Event.h"
+#include "ABCT_MessageTypes.h"
+#include "ABCT_ResumePipeline.h"
+#include "ABCT_TabJobs.h"
+#include "ABCT_TabState.h"
+#include "ABCT_UrlTable.h"
 #include "CPP_ABCT_Base.generated.h"
 
+class FABCTBenchmark;
+class FABCTJsonWriter;
+class FABCTMetricsEndpoint;
+class FABCTPrefetcher;
+class UCPP_ABCT_DeepLinkTagMap;
+class UCPP_ABCT_PrefetchMap;
+struct FABCTBenchmarkConfig;
+struct FABCTDeepLinkEvent;
+struct FABCTDeepLinkTrace;
+
 /**
  * UCPP_ABCT_Base
  *
@@ -50,10 +66,20 @@ public:
 
     /**
      * Closes the currently open Chrome Custom Tab.
+     * On Android the tab is finished in place, without relaunching the game activity.
      */
     UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab")
     void CloseChromeCustomTab();
 
+    /**
+     * Returns how long the last CloseChromeCustomTab took to bring the game back, from the call
+     * to the first game frame with the game in front (see ABCTReturnToGame).
+     *
+     * @return Latency in milliseconds, or -1 if no close has completed yet
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab")
+    float GetLastReturnToGameMillis() const;
+
     // ============================================================================
     // Chrome Custom Tab - Navigation Events
     // ============================================================================
@@ -78,6 +104,21 @@ public:
      */
     void HandleNavigationEvent(const FString &Event, const FString &URL);
 
+    /**
+     * Native handler for navigation events whose URL is already interned (ABCTIngress path).
+     *
+     * @param Event - The type of navigation event
+     * @param Url - The interned URL, or nullptr if the event has none
+     */
+    void HandleNavigationEvent(const FString &Event, const FABCTUrlRef &Url);
+
+    /**
+     * Native handler for navigation events already wrapped in a shared payload (ABCTIngress path).
+     *
+     * @param SharedEvent - The navigation event; listeners share it instead of copying its strings
+     */
+    void HandleNavigationEvent(const FABCTEventRef &SharedEvent);
+
     // ============================================================================
     // Deep Link - Receiving from Web Pages
     // ============================================================================
@@ -106,6 +147,145 @@ public:
      */
     void HandleDeepLink(const FString &Action, const FString &ParamsJson);
 
+    /**
+     * Native handler for Deep Links already wrapped in a shared payload (ABCTIngress path).
+     *
+     * @param SharedEvent - The deep link event; listeners share it instead of copying its strings
+     * @param Trace - Latency trace of the link, stamped and recorded when the handler completes (optional)
+     */
+    void HandleDeepLink(const FABCTEventRef &SharedEvent, FABCTDeepLinkTrace *Trace = nullptr);
+
+    /**
+     * Called after every sub-command of a batch deep link (uewebtest://batch?cmds=[...]) has
+     * been dispatched through OnDeepLinkReceived / the tag router. The sub-commands run in
+     * order within one frame; commit their combined effect (save, refresh UI) here.
+     *
+     * @param NumCommands - Number of sub-commands dispatched
+     */
+    UFUNCTION(BlueprintImplementableEvent, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    void OnDeepLinkBatchCompleted(int32 NumCommands);
+
+    /**
+     * Returns whether the deep link being handled is a sub-command of a batch.
+     *
+     * @return true from the first to the last sub-command of a batch
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    bool IsDispatchingDeepLinkBatch() const { return bIsDispatchingDeepLinkBatch; }
+
+    /**
+     * Sets the action -> gameplay tag map used to dispatch deep links natively.
+     * Mapped links go to ABCTDeepLinkRouter instead of OnDeepLinkReceived, unless no handler takes them.
+     *
+     * @param TagMap - The mapping, or nullptr to send every link to Blueprint
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    void SetDeepLinkTagMap(UCPP_ABCT_DeepLinkTagMap *TagMap) { DeepLinkTagMap = TagMap; }
+
+    // ============================================================================
+    // PostMessage - Receiving from Web Pages
+    // ============================================================================
+
+    /**
+     * Called when the web page sends a message over the PostMessage channel.
+     *
+     * @param Message - The message payload sent by the page
+     * @param Origin - The origin the PostMessage channel was opened for
+     */
+    UFUNCTION(BlueprintImplementableEvent, Category = "Punal|Android|Browser|Chrome Custom Tab|PostMessage")
+    void OnPostMessageReceived(const FString &Message, const FString &Origin);
+
+    /**
+     * Sends a message to the web page over the PostMessage channel.
+     * Messages are queued per lane and sent from the next frames; large messages are chunked
+     * so Control messages can overtake them. Messages queued before the channel is ready are
+     * sent once it is, and dropped if the tab closes first.
+     *
+     * @param Message - The payload to send (usually JSON)
+     * @param Lane - Scheduling lane (Control for urgent, Interactive for UI, Bulk for snapshots)
+     * @return true if the message was queued, false if no Custom Tab is open
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|PostMessage")
+    bool SendMessageToPage(const FString &Message, EABCTMessageLane Lane = EABCTMessageLane::Interactive);
+
+    /**
+     * Builds a JSON message with FABCTJsonWriter and sends it like SendMessageToPage.
+     * The writer streams into a pooled, pre-reserved buffer that is handed to the channel
+     * as-is, so state messages are built without FJsonObject nodes or per-message allocations.
+     *
+     * @param Build - Writes exactly one JSON value
+     * @param Lane - Scheduling lane
+     * @param ReserveChars - Expected message size; the buffer grows if it is exceeded
+     * @return true if the message was queued, false if no Custom Tab is open or Build left the JSON incomplete
+     */
+    bool SendJsonToPage(TFunctionRef<void(FABCTJsonWriter &)> Build, EABCTMessageLane Lane = EABCTMessageLane::Interactive, int32 ReserveChars = 4096);
+
+    /**
+     * Sends a USTRUCT to the page, serialized from reflection (see ABCTStructSerializer):
+     *   Json   - {"type":"<Struct>","data":{...}}
+     *   Binary - {"type":"<Struct>","schema":<hash>,"bin":"<base64>"}, preceded by an
+     *            {"type":"abct_schema",...} message the first time the page sees the struct
+     *
+     * @param Value - Any USTRUCT, e.g. SendStruct(Inventory) for an FPlayerInventory
+     * @param Format - Encoding
+     * @param Lane - Scheduling lane
+     * @return true if the message was queued, false if no Custom Tab is open
+     */
+    template <typename StructType>
+    bool SendStruct(const StructType &Value, EABCTStructFormat Format = EABCTStructFormat::Json, EABCTMessageLane Lane = EABCTMessageLane::Interactive)
+    {
+        return SendStruct(StructType::StaticStruct(), &Value, Format, Lane);
+    }
+
+    /** Untyped SendStruct; Data must point to an instance of Struct */
+    bool SendStruct(const UScriptStruct *Struct, const void *Data, EABCTStructFormat Format = EABCTStructFormat::Json, EABCTMessageLane Lane = EABCTMessageLane::Interactive);
+
+    /**
+     * Sends any struct to the web page over the PostMessage channel.
+     * Blueprint version of SendStruct.
+     *
+     * @param Value - The struct to send
+     * @param Format - JSON, or compact binary (base64) decoded with the schema message
+     * @param Lane - Scheduling lane
+     * @return true if the message was queued, false if no Custom Tab is open
+     */
+    UFUNCTION(BlueprintCallable, CustomThunk, Category = "Punal|Android|Browser|Chrome Custom Tab|PostMessage", meta = (CustomStructureParam = "Value"))
+    bool SendStructToPage(const int32 &Value, EABCTStructFormat Format = EABCTStructFormat::Json, EABCTMessageLane Lane = EABCTMessageLane::Interactive);
+    DECLARE_FUNCTION(execSendStructToPage);
+
+    /**
+     * Native handler for PostMessages from Java.
+     * Converts from C++ to Blueprint event.
+     *
+     * @param Message - The message payload sent by the page
+     * @param Origin - The origin the PostMessage channel was opened for
+     */
+    void HandlePostMessage(const FString &Message, const FString &Origin);
+
+    /**
+     * Native handler for PostMessages already wrapped in a shared payload (channel path).
+     *
+     * @param SharedEvent - The page message event; listeners share it instead of copying its strings
+     */
+    void HandlePostMessage(const FABCTEventRef &SharedEvent);
+
+    // ============================================================================
+    // Events - Shared Payloads
+    // ============================================================================
+
+    /**
+     * Native listeners called with every navigation event, deep link and page message, before
+     * the Blueprint events. Each event is one immutable payload shared by all listeners.
+     */
+    FABCTEventDelegate &OnEvent() { return NativeEventListeners; }
+
+    /**
+     * Called with a handle to every navigation event, deep link and page message.
+     * The handle is a pointer to the shared payload; read it with UCPP_ABCT_EventLibrary.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    FABCTEventHandleDelegate OnEventReceived;
+
     // ============================================================================
     // Deep Link - Parameter Parsing Helpers
     // ============================================================================
@@ -153,12 +333,151 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
     bool GetDeepLinkParameterAsVector(const FString &ParamsJson, FVector &OutVector);
 
+    /**
+     * Turns on signed deep links (see ABCTDeepLinkAuth). Links carrying "_sig" are verified
+     * with HMAC-SHA256 on a worker thread and dropped if the signature, expiry or nonce is
+     * bad; links are still delivered in arrival order. Shared by every instance.
+     *
+     * @param Key - Shared secret, used as UTF-8 bytes; empty string turns verification off
+     * @param SignedActions - Actions dropped unless signed (e.g. "grant"); others may be unsigned
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    void SetDeepLinkSigningKey(const FString &Key, const TArray<FString> &SignedActions);
+
+    // ============================================================================
+    // Benchmark
+    // ============================================================================
+
+    /**
+     * Opens the bundled echo page and benchmarks the PostMessage channel: round trip time at
+     * idle and under load, and sustained messages/s and bytes/s for sizes from 16 B to 1 MB.
+     * Runs for about half a minute; the tab closes when it ends and the JSON report is written
+     * and passed to OnChannelBenchmarkFinished. The page is served from 127.0.0.1, port 9465
+     * by default (-ABCTBenchmarkPort=<port>).
+     *
+     * @param ReportPath - Where to write the report (empty = Saved/ABCT/ChannelBenchmark-<time>.json)
+     * @return true if the benchmark started, false if a tab is open or the page cannot be served
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Benchmark")
+    bool StartChannelBenchmark(const FString &ReportPath = "");
+
+    /**
+     * Native variant of StartChannelBenchmark with custom workloads.
+     *
+     * @param Config - Workloads to run
+     * @param ReportPath - Where to write the report (empty = Saved/ABCT/ChannelBenchmark-<time>.json)
+     * @return true if the benchmark started
+     */
+    bool StartChannelBenchmarkWithConfig(const FABCTBenchmarkConfig &Config, const FString &ReportPath);
+
+    /**
+     * Returns whether a channel benchmark is in progress.
+     *
+     * @return true from StartChannelBenchmark until OnChannelBenchmarkFinished
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Benchmark")
+    bool IsChannelBenchmarkRunning() const;
+
+    /**
+     * Returns the JSON report of the last finished channel benchmark.
+     *
+     * @return The report, or empty string if no benchmark has finished
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Benchmark")
+    FString GetLastChannelBenchmarkReport() const { return LastBenchmarkReport; }
+
+    /**
+     * Called when a channel benchmark finishes or aborts ("aborted" is set in the report).
+     *
+     * @param ReportJson - The JSON report (schema "abct-benchmark/1")
+     * @param ReportPath - The file the report was written to, or empty string if writing failed
+     */
+    UFUNCTION(BlueprintImplementableEvent, Category = "Punal|Android|Browser|Chrome Custom Tab|Benchmark")
+    void OnChannelBenchmarkFinished(const FString &ReportJson, const FString &ReportPath);
+
+    // ============================================================================
+    // Memory
+    // ============================================================================
+
+    /**
+     * Sets the memory budget of the plugin (queues, messaging and caches; see ABCTMemory).
+     * While over budget the plugin drops bulk messages, then shrinks its caches, then stops
+     * tracing, one step per plugin tick. Shared by every instance.
+     *
+     * @param BudgetBytes - Budget in bytes, 0 to disable (default 16 MB)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Memory")
+    void SetMemoryBudget(int64 BudgetBytes);
+
+    /**
+     * Returns the memory the plugin currently counts against its budget.
+     *
+     * @return Tracked bytes across queues, messaging and caches
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Memory")
+    int64 GetTrackedMemoryBytes() const;
+
+    /**
+     * Returns whether the plugin is shedding load to get back within its memory budget.
+     *
+     * @return true from the first shedding step until memory falls to 75% of the budget
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Memory")
+    bool IsSheddingMemory() const;
+
+    // ============================================================================
+    // Resume
+    // ============================================================================
+
+    /**
+     * Called once the first frames after returning from the tab have been profiled.
+     * Restore work spread over those frames is registered with ABCTResumePipeline::AddStep.
+     *
+     * @param Profile - Frame times of the first frames back and how long the restore work took
+     */
+    UFUNCTION(BlueprintImplementableEvent, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    void OnResumeProfileReady(const FABCTResumeProfile &Profile);
+
+    /**
+     * Returns the profile of the last return from the tab.
+     *
+     * @return The last profile, empty if the game has not returned from the tab yet
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    FABCTResumeProfile GetLastResumeProfile() const;
+
+    // ============================================================================
+    // Background Jobs
+    // ============================================================================
+
+    /**
+     * Returns the work background jobs did while the last tab was open (see ABCTTabJobs).
+     *
+     * @return Slices run, jobs finished and CPU time of the last finished tab session
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Background Jobs")
+    FABCTTabJobSessionStats GetLastTabJobSessionStats() const;
+
+    // ============================================================================
+    // Asset Prefetch
+    // ============================================================================
+
+    /**
+     * Sets the page / deep link -> game asset map used to prefetch what the tab shows.
+     * Loads already made are released when the map changes.
+     *
+     * @param Map - The mapping, or nullptr to prefetch nothing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    void SetPrefetchMap(UCPP_ABCT_PrefetchMap *Map);
+
     // ============================================================================
     // State Management
     // ============================================================================
 
     /**
      * Returns whether a Chrome Custom Tab is currently open.
+     * Game thread; other threads read ABCTTabState::Read() instead.
      *
      * @return true if Custom Tab is open, false otherwise
      */
@@ -173,6 +492,62 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab")
     FString GetCurrentURL() const { return CurrentURL; }
 
+    /**
+     * Returns the current URL in canonical form (lower-case scheme and host, no default port;
+     * see FABCTUrl), as used by the URL table and prefetch map.
+     *
+     * @return The canonical current URL, or empty string if no tab is open
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab")
+    FString GetCurrentCanonicalURL() const { return CurrentUrl.IsValid() ? CurrentUrl->GetCanonical() : FString(); }
+
+    /**
+     * Returns the URL table id of the current URL (see ABCTUrlTable).
+     *
+     * @return The current URL id, or 0 if no tab is open
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab")
+    int32 GetCurrentURLId() const { return CurrentUrl.IsValid() ? (int32)CurrentUrl->GetId() : 0; }
+
+    /** Returns the current URL with its host / path / query views, or nullptr if no tab is open */
+    const FABCTUrlRef &GetCurrentUrlRef() const { return CurrentUrl; }
+
+    /**
+     * Returns the last navigation event received (e.g. "NavigationFinished").
+     *
+     * @return The last navigation event name, or empty string if none was received
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab")
+    FString GetLastNavigationEvent() const { return LastNavigationEvent; }
+
+    /**
+     * Returns the last Deep Link action received (e.g. "teleport").
+     *
+     * @return The last Deep Link action, or empty string if none was received
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    FString GetLastDeepLinkAction() const { return LastDeepLinkAction; }
+
+    /**
+     * Returns the last Deep Link parameters received (as JSON string).
+     *
+     * @return The last Deep Link parameters, or empty string if none were received
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    FString GetLastDeepLinkParams() const { return LastDeepLinkParams; }
+
+    /**
+     * Enables or disables debug logging for this instance.
+     *
+     * @param bEnabled - true to log every event (development), false for quiet operation
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Debug")
+    void SetDebugLoggingEnabled(bool bEnabled) { bEnableDebugLogging = bEnabled; }
+
+    // UObject interface
+    virtual void PostInitProperties() override;
+    virtual void BeginDestroy() override;
+
 protected:
     // ============================================================================
     // Internal State Variables
@@ -186,6 +561,9 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab")
     FString CurrentURL;
 
+    /** CurrentURL interned in the URL table */
+    FABCTUrlRef CurrentUrl;
+
     /** The last navigation event received */
     UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab")
     FString LastNavigationEvent;
@@ -198,6 +576,9 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab")
     FString LastDeepLinkParams;
 
+    /** Whether the sub-commands of a batch deep link are being dispatched */
+    bool bIsDispatchingDeepLinkBatch;
+
     // ============================================================================
     // Configuration Variables
     // ============================================================================
@@ -222,6 +603,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Punal|Android|Browser|Chrome Custom Tab|Config")
     FString CustomHeader;
 
+    /** Deep link actions dispatched natively as gameplay tags (nullptr = all go to OnDeepLinkReceived) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Punal|Android|Browser|Chrome Custom Tab|Config")
+    TObjectPtr<UCPP_ABCT_DeepLinkTagMap> DeepLinkTagMap;
+
+    /** Game assets loaded ahead for the pages and deep links of the tab (nullptr = none) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Punal|Android|Browser|Chrome Custom Tab|Config")
+    TObjectPtr<UCPP_ABCT_PrefetchMap> PrefetchMap;
+
     // ============================================================================
     // Debug Variables
     // ============================================================================
@@ -230,6 +619,43 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chrome Custom Tab|Debug")
     bool bEnableDebugLogging;
 
+    // ============================================================================
+    // Benchmark State
+    // ============================================================================
+
+    /** The running (or last finished) channel benchmark */
+    TSharedPtr<FABCTBenchmark> Benchmark;
+
+    /** Serves the echo page while a benchmark runs on the platform bridge */
+    TSharedPtr<FABCTMetricsEndpoint> EchoPageServer;
+
+    /** Report path requested by StartChannelBenchmark */
+    FString BenchmarkReportPath;
+
+    /** The last benchmark report */
+    FString LastBenchmarkReport;
+
+    // ============================================================================
+    // PostMessage State
+    // ============================================================================
+
+    /** Schema hashes of the binary structs the current page has been sent the schema for */
+    TSet<uint32> SentStructSchemas;
+
+    // ============================================================================
+    // Prefetch State
+    // ============================================================================
+
+    /** Loads started through PrefetchMap, created on first use */
+    TSharedPtr<FABCTPrefetcher> Prefetcher;
+
+    // ============================================================================
+    // Event Listeners
+    // ============================================================================
+
+    /** Native listeners registered through OnEvent() */
+    FABCTEventDelegate NativeEventListeners;
+
 private:
     // ============================================================================
     // Internal Helper Functions
@@ -240,17 +666,97 @@ private:
      *
      * @param Message - The message to log
      */
-    void DebugLog(const FString &Message);
+    void DebugLog(const TCHAR *Message);
+
+    /**
+     * Formats and logs a debug message if debug logging is enabled; nothing is formatted
+     * (or allocated) while it is off.
+     *
+     * @param Format - printf style format literal
+     * @param Args - Format arguments
+     */
+    template <typename FmtType, typename... Types>
+    void DebugLogf(const FmtType &Format, Types... Args);
 
     /**
      * Updates internal state when Custom Tab opens.
      *
-     * @param URL - The URL that was opened
+     * @param Url - The URL that was opened, interned
+     * @param URL - The URL as given
      */
-    void OnCustomTabOpened(const FString &URL);
+    void OnCustomTabOpened(const FABCTUrlRef &Url, const FString &URL);
 
     /**
      * Updates internal state when Custom Tab closes.
      */
     void OnCustomTabClosed();
+
+    /**
+     * Starts the resume pipeline for the game coming back from the tab (ignored if running).
+     *
+     * @param Reason - What brought the game back
+     */
+    void BeginResume(EABCTResumeReason Reason);
+
+    /**
+     * Starts the PrefetchMap loads for the page the tab is navigating to; unfinished loads of
+     * the previous page are cancelled.
+     *
+     * @param Url - The page, or an invalid ref when the tab closed
+     */
+    void PrefetchForPage(const FABCTUrlRef &Url);
+
+    /**
+     * Starts the PrefetchMap loads for a deep link, at high priority.
+     *
+     * @param SharedEvent - The deep link event
+     */
+    void PrefetchForDeepLink(const FABCTEventRef &SharedEvent);
+
+    /**
+     * Writes the benchmark report, closes the echo page and notifies Blueprint.
+     *
+     * @param ReportJson - The JSON report
+     */
+    void OnChannelBenchmarkComplete(const FString &ReportJson);
+
+    /**
+     * Decodes a batch deep link and dispatches its sub-commands in order, as one transaction:
+     * a malformed batch dispatches nothing.
+     *
+     * @param SharedEvent - The batch deep link
+     * @param Trace - Latency trace of the batch link (optional)
+     */
+    void HandleDeepLinkBatch(const FABCTEventRef &SharedEvent, FABCTDeepLinkTrace *Trace);
+
+    /**
+     * Hands a shared event to the native and Blueprint event listeners.
+     *
+     * @param SharedEvent - The event
+     */
+    void BroadcastEvent(const FABCTEventRef &SharedEvent);
+
+    /**
+     * Decodes a deep link into its tagged form if DeepLinkTagMap maps its action.
+     *
+     * @param SharedEvent - The deep link event
+     * @param OutEvent - The tagged event with decoded params
+     * @return true if the link is mapped
+     */
+    bool DecodeDeepLinkTagEvent(const FABCTEventRef &SharedEvent, FABCTDeepLinkEvent &OutEvent);
+
+    /**
+     * Dispatches a decoded deep link through ABCTDeepLinkRouter.
+     *
+     * @param Event - The tagged event from DecodeDeepLinkTagEvent
+     * @return true if a handler took the link and Blueprint should not be notified
+     */
+    bool RouteDeepLinkByTag(const FABCTDeepLinkEvent &Event);
+
+    /**
+     * Publishes the tab state snapshot for other threads (see ABCTTabState).
+     *
+     * @param Lifecycle - The new lifecycle state
+     */
+    void PublishTabState(EABCTTabLifecycle Lifecycle);
 };
@@ -39,7 +39,8 @@ public class P_AndroidBrowserCustomTab : ModuleRules
 				"RHI",
 				"ProceduralMeshComponent",
 				"Json",
-				"JsonUtilities"
+				"JsonUtilities",
+				"GameplayTags"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -52,6 +53,9 @@ public class P_AndroidBrowserCustomTab : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"Sockets",
+				"Networking",
+				"NetCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
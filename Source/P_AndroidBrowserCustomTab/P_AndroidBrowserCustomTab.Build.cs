@@ -37,7 +37,8 @@ public class P_AndroidBrowserCustomTab : ModuleRules
 				"RenderCore",
 				"RHI",
 				"Json",
-				"JsonUtilities"
+				"JsonUtilities",
+				"GameplayTags"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -50,6 +51,9 @@ public class P_AndroidBrowserCustomTab : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"Sockets",
+				"Networking",
+				"NetCore",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -0,0 +1,27 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Browser backend abstraction.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Backend.h"
+
+namespace
+{
+    // Backend installed by tests, soak runs or non-Android targets (nullptr = platform bridge)
+    TSharedPtr<IABCTBackend> OverrideBackend;
+}
+
+namespace ABCTBackend
+{
+    void SetOverride(TSharedPtr<IABCTBackend> Backend)
+    {
+        check(IsInGameThread());
+        OverrideBackend = MoveTemp(Backend);
+    }
+
+    TSharedPtr<IABCTBackend> GetOverride()
+    {
+        return OverrideBackend;
+    }
+}
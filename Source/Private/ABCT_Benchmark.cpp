@@ -0,0 +1,357 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel benchmark.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Benchmark.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_MessageChannel.h"
+#include "Misc/EngineVersion.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    /** Size of the RTT probes */
+    const int32 ProbeChars = 16;
+
+    using FReportWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+    /** Nearest-rank percentile of sorted samples */
+    double Percentile(const TArray<double> &Sorted, double Fraction)
+    {
+        if (Sorted.IsEmpty())
+        {
+            return 0.0;
+        }
+        const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * Sorted.Num()), 1, Sorted.Num());
+        return Sorted[Rank - 1];
+    }
+
+    void WriteLatencySummary(FReportWriter &Writer, const TCHAR *Name, TArray<double> Samples, int32 Lost)
+    {
+        Samples.Sort();
+        double Sum = 0.0;
+        for (double Sample : Samples)
+        {
+            Sum += Sample;
+        }
+
+        Writer.WriteObjectStart(Name);
+        Writer.WriteValue(TEXT("samples"), Samples.Num());
+        Writer.WriteValue(TEXT("lost"), Lost);
+        Writer.WriteValue(TEXT("mean"), Samples.IsEmpty() ? 0.0 : FMath::RoundToDouble(Sum / Samples.Num()));
+        Writer.WriteValue(TEXT("p50"), FMath::RoundToDouble(Percentile(Samples, 0.50)));
+        Writer.WriteValue(TEXT("p90"), FMath::RoundToDouble(Percentile(Samples, 0.90)));
+        Writer.WriteValue(TEXT("p99"), FMath::RoundToDouble(Percentile(Samples, 0.99)));
+        Writer.WriteValue(TEXT("max"), Samples.IsEmpty() ? 0.0 : FMath::RoundToDouble(Samples.Last()));
+        Writer.WriteObjectEnd();
+    }
+}
+
+FABCTBenchmark::FABCTBenchmark(const FABCTBenchmarkConfig &InConfig, const FString &InBackendName, FOnFinished InOnFinished)
+    : Config(InConfig), BackendName(InBackendName), OnFinished(MoveTemp(InOnFinished)), Phase(EPhase::WaitForChannel), StartedUtc(FDateTime::UtcNow()), StartSeconds(FPlatformTime::Seconds()), PhaseStartSeconds(StartSeconds), PhaseProbesSent(0), SizeIndex(0), NextSeq(1), InFlightChars(0), InFlightProbes(0), InFlightLoad(0), IdleRttLost(0), LoadedRttLost(0)
+{
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FABCTBenchmark::Tick));
+}
+
+FABCTBenchmark::~FABCTBenchmark()
+{
+    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+}
+
+// ============================================================================
+// Workloads
+// ============================================================================
+
+bool FABCTBenchmark::Tick(float DeltaTime)
+{
+    const double NowSeconds = FPlatformTime::Seconds();
+    const FABCTMessageChannel &Channel = FABCTMessageChannel::Get();
+
+    if (Phase == EPhase::Finished)
+    {
+        return false;
+    }
+    if (Phase == EPhase::WaitForChannel)
+    {
+        if (!Channel.IsReady())
+        {
+            if (NowSeconds - StartSeconds > Config.ChannelReadyTimeoutSeconds)
+            {
+                Finish(TEXT("channel not ready"));
+                return false;
+            }
+            return true;
+        }
+        EnterPhase(EPhase::IdleRtt, NowSeconds);
+    }
+    if (!Channel.IsReady())
+    {
+        Finish(TEXT("channel closed"));
+        return false;
+    }
+
+    ExpireLost(NowSeconds);
+
+    switch (Phase)
+    {
+    case EPhase::IdleRtt:
+        if (InFlightProbes == 0)
+        {
+            if (PhaseProbesSent < Config.IdleRttSamples)
+            {
+                SendBench(EABCTMessageLane::Interactive, ProbeChars, true);
+            }
+            else
+            {
+                EnterPhase(EPhase::LoadedRtt, NowSeconds);
+            }
+        }
+        break;
+
+    case EPhase::LoadedRtt:
+        if (PhaseProbesSent < Config.LoadedRttSamples || InFlightProbes > 0)
+        {
+            while (InFlightLoad < Config.LoadInFlight)
+            {
+                SendBench(EABCTMessageLane::Bulk, Config.LoadMessageChars, false);
+            }
+            if (InFlightProbes == 0)
+            {
+                SendBench(EABCTMessageLane::Interactive, ProbeChars, true);
+            }
+        }
+        else if (InFlight.IsEmpty())
+        {
+            // The load has drained, so throughput starts on an empty channel
+            EnterPhase(EPhase::Throughput, NowSeconds);
+        }
+        break;
+
+    case EPhase::Throughput:
+    {
+        FThroughputResult &Result = Throughput.Last();
+        const double Elapsed = NowSeconds - PhaseStartSeconds;
+        if (Elapsed < Config.ThroughputSeconds)
+        {
+            while (InFlight.Num() < Config.MaxInFlight && (InFlight.IsEmpty() || InFlightChars + Result.Size <= Config.MaxInFlightChars))
+            {
+                SendBench(Config.ThroughputLane, Result.Size, false);
+            }
+        }
+        else
+        {
+            // Acks after the measurement window are not counted; wait for them before the next size
+            if (Result.Seconds == 0.0)
+            {
+                Result.Seconds = Elapsed;
+            }
+            if (InFlight.IsEmpty())
+            {
+                if (SizeIndex + 1 < Config.ThroughputSizes.Num())
+                {
+                    ++SizeIndex;
+                    EnterPhase(EPhase::Throughput, NowSeconds);
+                }
+                else
+                {
+                    Finish(nullptr);
+                    return false;
+                }
+            }
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+    return true;
+}
+
+void FABCTBenchmark::EnterPhase(EPhase NewPhase, double NowSeconds)
+{
+    Phase = NewPhase;
+    PhaseStartSeconds = NowSeconds;
+    PhaseProbesSent = 0;
+
+    if (Phase == EPhase::Throughput)
+    {
+        if (!Config.ThroughputSizes.IsValidIndex(SizeIndex))
+        {
+            Finish(nullptr);
+            return;
+        }
+        FThroughputResult &Result = Throughput.AddDefaulted_GetRef();
+        Result.Size = FMath::Max(ProbeChars, Config.ThroughputSizes[SizeIndex]);
+    }
+}
+
+void FABCTBenchmark::SendBench(EABCTMessageLane Lane, int32 Chars, bool bProbe)
+{
+    const uint32 Seq = NextSeq++;
+
+    // {"type":"bench","seq":N,"pad":"xxx..."} padded to Chars (before the channel adds "_ts")
+    FString Message = FString::Printf(TEXT("{\"type\":\"bench\",\"seq\":%u,\"pad\":\""), Seq);
+    const int32 PadChars = FMath::Max(0, Chars - Message.Len() - 2);
+    Message.Reserve(Message.Len() + PadChars + 2);
+    for (int32 Index = 0; Index < PadChars; ++Index)
+    {
+        Message.AppendChar(TEXT('x'));
+    }
+    Message += TEXT("\"}");
+
+    FInFlight &Entry = InFlight.Add(Seq);
+    Entry.SentSeconds = FPlatformTime::Seconds();
+    Entry.Chars = Message.Len();
+    Entry.bProbe = bProbe;
+    Entry.Phase = Phase;
+    Entry.SizeIndex = SizeIndex;
+
+    InFlightChars += Entry.Chars;
+    InFlightProbes += bProbe ? 1 : 0;
+    InFlightLoad += (!bProbe && Phase == EPhase::LoadedRtt) ? 1 : 0;
+    PhaseProbesSent += bProbe ? 1 : 0;
+
+    FABCTMessageChannel::Get().Send(Lane, MoveTemp(Message));
+}
+
+bool FABCTBenchmark::HandleMessage(const FString &Message)
+{
+    FStringView Type;
+    if (!ABCTJsonScan::FindStringField(Message, TEXTVIEW("type"), Type) || Type != TEXTVIEW("bench_ack"))
+    {
+        return false;
+    }
+
+    double SeqValue = 0.0;
+    FInFlight Entry;
+    if (!ABCTJsonScan::FindNumberField(Message, TEXTVIEW("seq"), SeqValue) || !InFlight.RemoveAndCopyValue((uint32)SeqValue, Entry))
+    {
+        // Late ack of a message already counted as lost
+        return true;
+    }
+    Retire(Entry);
+
+    const double RttMicros = (FPlatformTime::Seconds() - Entry.SentSeconds) * 1000000.0;
+    if (Entry.bProbe)
+    {
+        (Entry.Phase == EPhase::IdleRtt ? IdleRttMicros : LoadedRttMicros).Add(RttMicros);
+    }
+    else if (Entry.Phase == EPhase::Throughput && Throughput.IsValidIndex(Entry.SizeIndex))
+    {
+        FThroughputResult &Result = Throughput[Entry.SizeIndex];
+        if (Result.Seconds == 0.0)
+        {
+            ++Result.Messages;
+            Result.Chars += Entry.Chars;
+            Result.RttMicros.Add(RttMicros);
+        }
+    }
+    return true;
+}
+
+void FABCTBenchmark::Retire(const FInFlight &Message)
+{
+    InFlightChars -= Message.Chars;
+    InFlightProbes -= Message.bProbe ? 1 : 0;
+    InFlightLoad -= (!Message.bProbe && Message.Phase == EPhase::LoadedRtt) ? 1 : 0;
+}
+
+void FABCTBenchmark::ExpireLost(double NowSeconds)
+{
+    for (auto It = InFlight.CreateIterator(); It; ++It)
+    {
+        const FInFlight &Entry = It.Value();
+        if (NowSeconds - Entry.SentSeconds < Config.AckTimeoutSeconds)
+        {
+            continue;
+        }
+
+        if (Entry.bProbe)
+        {
+            ++(Entry.Phase == EPhase::IdleRtt ? IdleRttLost : LoadedRttLost);
+        }
+        else if (Entry.Phase == EPhase::Throughput && Throughput.IsValidIndex(Entry.SizeIndex))
+        {
+            ++Throughput[Entry.SizeIndex].Lost;
+        }
+        Retire(Entry);
+        It.RemoveCurrent();
+    }
+}
+
+// ============================================================================
+// Report
+// ============================================================================
+
+void FABCTBenchmark::Finish(const TCHAR *AbortReason)
+{
+    if (Phase == EPhase::Finished)
+    {
+        return;
+    }
+    Phase = EPhase::Finished;
+
+    const FABCTMessageChannel &Channel = FABCTMessageChannel::Get();
+    Report.Reset();
+    TSharedRef<FReportWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Report);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("schema"), FString(TEXT("abct-benchmark/1")));
+    Writer->WriteValue(TEXT("backend"), BackendName);
+    Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+    Writer->WriteValue(TEXT("device"), FPlatformMisc::GetDeviceMakeAndModel());
+    Writer->WriteValue(TEXT("engine"), FEngineVersion::Current().ToString());
+    Writer->WriteValue(TEXT("started_utc"), StartedUtc.ToIso8601());
+    Writer->WriteValue(TEXT("duration_seconds"), FPlatformTime::Seconds() - StartSeconds);
+    Writer->WriteValue(TEXT("aborted"), AbortReason != nullptr);
+    if (AbortReason != nullptr)
+    {
+        Writer->WriteValue(TEXT("abort_reason"), FString(AbortReason));
+    }
+
+    Writer->WriteObjectStart(TEXT("channel"));
+    Writer->WriteValue(TEXT("chunk_size_chars"), Channel.GetOutboundConfig().ChunkSizeChars);
+    Writer->WriteValue(TEXT("max_chars_per_tick"), Channel.GetOutboundConfig().MaxCharsPerTick);
+    Writer->WriteValue(TEXT("receive_window"), Channel.GetInboundConfig().ReceiveWindow);
+    Writer->WriteValue(TEXT("max_dispatch_per_tick"), Channel.GetInboundConfig().MaxDispatchPerTick);
+    Writer->WriteObjectEnd();
+
+    Writer->WriteObjectStart(TEXT("config"));
+    Writer->WriteValue(TEXT("load_message_chars"), Config.LoadMessageChars);
+    Writer->WriteValue(TEXT("load_in_flight"), Config.LoadInFlight);
+    Writer->WriteValue(TEXT("throughput_seconds"), Config.ThroughputSeconds);
+    Writer->WriteValue(TEXT("max_in_flight"), Config.MaxInFlight);
+    Writer->WriteValue(TEXT("max_in_flight_chars"), Config.MaxInFlightChars);
+    Writer->WriteObjectEnd();
+
+    WriteLatencySummary(*Writer, TEXT("idle_rtt_us"), IdleRttMicros, IdleRttLost);
+    WriteLatencySummary(*Writer, TEXT("loaded_rtt_us"), LoadedRttMicros, LoadedRttLost);
+
+    // Payloads are ASCII, so characters equal UTF-8 bytes on the wire
+    Writer->WriteArrayStart(TEXT("throughput"));
+    for (const FThroughputResult &Result : Throughput)
+    {
+        const double Seconds = Result.Seconds > 0.0 ? Result.Seconds : FMath::Max(FPlatformTime::Seconds() - PhaseStartSeconds, UE_DOUBLE_SMALL_NUMBER);
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("size"), Result.Size);
+        Writer->WriteValue(TEXT("seconds"), Seconds);
+        Writer->WriteValue(TEXT("messages"), Result.Messages);
+        Writer->WriteValue(TEXT("lost"), Result.Lost);
+        Writer->WriteValue(TEXT("messages_per_second"), FMath::RoundToDouble(Result.Messages / Seconds));
+        Writer->WriteValue(TEXT("bytes_per_second"), FMath::RoundToDouble(Result.Chars / Seconds));
+        WriteLatencySummary(*Writer, TEXT("rtt_us"), Result.RttMicros, Result.Lost);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    InFlight.Reset();
+    UE_LOG(LogTemp, Log, TEXT("FABCTBenchmark: %s"), AbortReason != nullptr ? *FString::Printf(TEXT("Aborted (%s)"), AbortReason) : TEXT("Finished"));
+    OnFinished.ExecuteIfBound(Report);
+}
@@ -0,0 +1,52 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Page / game clock offset estimation.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_ClockSync.h"
+
+namespace ABCTClock
+{
+    double NowMillis()
+    {
+        static const double AnchorSeconds = FPlatformTime::Seconds();
+        static const double AnchorUnixMillis = (double)(FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerMillisecond;
+        return AnchorUnixMillis + (FPlatformTime::Seconds() - AnchorSeconds) * 1000.0;
+    }
+}
+
+FABCTClockSync::FABCTClockSync()
+{
+    Reset();
+}
+
+void FABCTClockSync::AddSample(double T0, double T1, double T2, double T3)
+{
+    FSample &Sample = Samples[NextSample];
+    Sample.OffsetMillis = ((T1 - T0) + (T2 - T3)) * 0.5;
+    Sample.DelayMillis = FMath::Max(0.0, (T3 - T0) - (T2 - T1));
+    NextSample = (NextSample + 1) % FilterSize;
+
+    const FSample *Best = &Samples[0];
+    const int32 WindowSize = FMath::Min(NumSamples + 1, FilterSize);
+    for (int32 Index = 1; Index < WindowSize; ++Index)
+    {
+        if (Samples[Index].DelayMillis < Best->DelayMillis)
+        {
+            Best = &Samples[Index];
+        }
+    }
+
+    OffsetMillis = NumSamples == 0 ? Best->OffsetMillis : OffsetMillis + Smoothing * (Best->OffsetMillis - OffsetMillis);
+    BestDelayMillis = Best->DelayMillis;
+    NumSamples = WindowSize;
+}
+
+void FABCTClockSync::Reset()
+{
+    NumSamples = 0;
+    NextSample = 0;
+    OffsetMillis = 0.0;
+    BestDelayMillis = 0.0;
+}
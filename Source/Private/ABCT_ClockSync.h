@@ -0,0 +1,72 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Page / game clock offset estimation.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace ABCTClock
+{
+    /**
+     * Game clock on the page's scale: milliseconds since the Unix epoch, with sub-millisecond
+     * resolution. Anchored to UTC once and then advanced by the monotonic platform clock, so
+     * it never jumps when the wall clock is adjusted.
+     */
+    double NowMillis();
+}
+
+/**
+ * FABCTClockSync
+ *
+ * NTP-style estimate of the page clock relative to the game clock. Each ping/pong exchange
+ * gives four timestamps:
+ *   T0 game sends ping, T1 page receives it, T2 page sends pong, T3 game receives pong
+ * from which offset = ((T1 - T0) + (T2 - T3)) / 2 and delay = (T3 - T0) - (T2 - T1).
+ *
+ * Filtering: of the last FilterSize samples the one with the lowest delay is the most
+ * trustworthy (least queueing, most symmetric), and the published offset follows it with an
+ * exponential moving average so a single lucky sample cannot make it jump.
+ */
+class FABCTClockSync
+{
+public:
+    static constexpr int32 FilterSize = 8;
+
+    /** Weight of the newest best sample in the moving average */
+    static constexpr double Smoothing = 0.25;
+
+    FABCTClockSync();
+
+    /** Adds one exchange; times in milliseconds, T0 / T3 on the game clock, T1 / T2 on the page clock */
+    void AddSample(double T0, double T1, double T2, double T3);
+
+    /** Drops every sample (the page, and so its clock, went away) */
+    void Reset();
+
+    bool HasEstimate() const { return NumSamples > 0; }
+
+    /** Page clock minus game clock */
+    double GetOffsetMillis() const { return OffsetMillis; }
+
+    /** Round-trip network delay of the best sample in the window */
+    double GetBestDelayMillis() const { return BestDelayMillis; }
+
+    /** Converts a page timestamp to the game clock */
+    double PageToGameMillis(double PageMillis) const { return PageMillis - OffsetMillis; }
+
+private:
+    struct FSample
+    {
+        double OffsetMillis;
+        double DelayMillis;
+    };
+
+    FSample Samples[FilterSize];
+    int32 NumSamples;
+    int32 NextSample;
+    double OffsetMillis;
+    double BestDelayMillis;
+};
@@ -0,0 +1,186 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Idempotency key dedup window.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Dedup.h"
+#include "ABCT_Memory.h"
+#include "Misc/ScopeLock.h"
+
+namespace
+{
+    constexpr uint32 BucketMask = 4096 - 1;
+
+    uint16 ToFingerprint(uint64 KeyHash)
+    {
+        const uint16 Fingerprint = (uint16)(KeyHash >> 48);
+        return Fingerprint != 0 ? Fingerprint : 1;
+    }
+
+    /** Partial-key cuckoo hashing: the alternate bucket depends only on the bucket and fingerprint */
+    uint32 AlternateBucket(uint32 Bucket, uint16 Fingerprint)
+    {
+        return (Bucket ^ ((uint32)Fingerprint * 0x5bd1e995u)) & BucketMask;
+    }
+
+    /** Heap bytes of one exact LRU entry: the entry node and its lookup set element */
+    constexpr int64 ExactEntryBytes = 2 * (sizeof(uint64) + sizeof(double)) + 4 * sizeof(void *);
+}
+
+// ============================================================================
+// Filter Generation
+// ============================================================================
+
+bool FABCTDedupWindow::FGeneration::Contains(uint32 Bucket, uint16 Fingerprint) const
+{
+    const uint16 *Slot = &Slots[Bucket * SlotsPerBucket];
+    for (int32 Index = 0; Index < SlotsPerBucket; ++Index)
+    {
+        if (Slot[Index] == Fingerprint)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FABCTDedupWindow::FGeneration::TryPlace(uint32 Bucket, uint16 Fingerprint)
+{
+    uint16 *Slot = &Slots[Bucket * SlotsPerBucket];
+    for (int32 Index = 0; Index < SlotsPerBucket; ++Index)
+    {
+        if (Slot[Index] == 0)
+        {
+            Slot[Index] = Fingerprint;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FABCTDedupWindow::FGeneration::Reset()
+{
+    FMemory::Memzero(Slots, sizeof(Slots));
+}
+
+// ============================================================================
+// Dedup Window
+// ============================================================================
+
+FABCTDedupWindow::FABCTDedupWindow(double InWindowSeconds)
+    : Current(0), GenerationStartSeconds(0.0), WindowSeconds(InWindowSeconds), KickState(0x9e3779b9u), Exact(ExactCapacity)
+{
+    static_assert(NumBuckets - 1 == BucketMask, "BucketMask must match NumBuckets");
+    Generations[0].Reset();
+    Generations[1].Reset();
+
+    // Fixed for the lifetime of the window: both generations and a full exact LRU
+    ABCTMemory::Track(EABCTMemoryPool::Caches, GetTrackedBytes());
+}
+
+FABCTDedupWindow::~FABCTDedupWindow()
+{
+    ABCTMemory::Track(EABCTMemoryPool::Caches, -GetTrackedBytes());
+}
+
+int64 FABCTDedupWindow::GetTrackedBytes()
+{
+    return sizeof(FABCTDedupWindow) + ExactCapacity * ExactEntryBytes;
+}
+
+bool FABCTDedupWindow::CheckAndInsert(uint64 KeyHash, double NowSeconds)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    const double GenerationAge = NowSeconds - GenerationStartSeconds;
+    if (GenerationAge >= WindowSeconds)
+    {
+        // Idle for a whole window: both generations are stale
+        Generations[Current].Reset();
+        Rotate(NowSeconds);
+    }
+    else if (GenerationAge >= WindowSeconds * 0.5)
+    {
+        Rotate(NowSeconds);
+    }
+
+    if (const double *SeenSeconds = Exact.FindAndTouch(KeyHash))
+    {
+        if (NowSeconds - *SeenSeconds <= WindowSeconds)
+        {
+            return true;
+        }
+    }
+
+    const uint16 Fingerprint = ToFingerprint(KeyHash);
+    const uint32 Bucket = (uint32)KeyHash & BucketMask;
+    const uint32 Alternate = AlternateBucket(Bucket, Fingerprint);
+    for (const FGeneration &Generation : Generations)
+    {
+        if (Generation.Contains(Bucket, Fingerprint) || Generation.Contains(Alternate, Fingerprint))
+        {
+            return true;
+        }
+    }
+
+    {
+        LLM_SCOPE_BYTAG(ABCT_Caches);
+        Exact.Add(KeyHash, NowSeconds);
+    }
+    if (!InsertCurrent(Bucket, Fingerprint))
+    {
+        Rotate(NowSeconds);
+        InsertCurrent(Bucket, Fingerprint);
+    }
+    return false;
+}
+
+bool FABCTDedupWindow::InsertCurrent(uint32 Bucket, uint16 Fingerprint)
+{
+    FGeneration &Generation = Generations[Current];
+    if (Generation.TryPlace(Bucket, Fingerprint) || Generation.TryPlace(AlternateBucket(Bucket, Fingerprint), Fingerprint))
+    {
+        return true;
+    }
+
+    // Evict a random resident to its alternate bucket until everything fits
+    for (int32 Kick = 0; Kick < MaxKicks; ++Kick)
+    {
+        KickState ^= KickState << 13;
+        KickState ^= KickState >> 17;
+        KickState ^= KickState << 5;
+
+        uint16 &Victim = Generation.Slots[Bucket * SlotsPerBucket + (KickState % SlotsPerBucket)];
+        Swap(Victim, Fingerprint);
+        Bucket = AlternateBucket(Bucket, Fingerprint);
+        if (Generation.TryPlace(Bucket, Fingerprint))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FABCTDedupWindow::Rotate(double NowSeconds)
+{
+    Current ^= 1;
+    Generations[Current].Reset();
+    GenerationStartSeconds = NowSeconds;
+}
+
+void FABCTDedupWindow::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    Generations[0].Reset();
+    Generations[1].Reset();
+    LLM_SCOPE_BYTAG(ABCT_Caches);
+    Exact.Empty(ExactCapacity);
+    GenerationStartSeconds = 0.0;
+}
+
+void FABCTDedupWindow::SetWindowSeconds(double InWindowSeconds)
+{
+    FScopeLock ScopeLock(&Lock);
+    WindowSeconds = FMath::Max(InWindowSeconds, 1.0);
+}
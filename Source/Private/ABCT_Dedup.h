@@ -0,0 +1,85 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Idempotency key dedup window.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/LruCache.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * FABCTDedupWindow
+ *
+ * Fixed-memory set of idempotency keys seen in the last WindowSeconds.
+ *
+ * Two cuckoo filter generations (16-bit fingerprints, 4 slots per bucket) cover the window:
+ * keys go into the current generation, lookups check both, and every WindowSeconds / 2 the
+ * older generation is cleared and becomes current. A key is therefore remembered for at least
+ * half and at most a whole window. A generation that fills up early rotates immediately, so
+ * a burst shortens the window instead of growing memory.
+ *
+ * A small exact LRU of full key hashes sits in front of the filters. It answers for the most
+ * recent keys without false positives and keeps them remembered across an early rotation.
+ * Filter false positives (about 1 in 8000 at full load) are treated as duplicates.
+ *
+ * Its fixed size is counted against the ABCTMemory Caches pool.
+ *
+ * Thread-safe.
+ */
+class FABCTDedupWindow
+{
+public:
+    explicit FABCTDedupWindow(double InWindowSeconds = 300.0);
+    ~FABCTDedupWindow();
+
+    /**
+     * Records KeyHash unless it was already seen within the window.
+     *
+     * @param KeyHash - 64-bit hash of the idempotency key
+     * @param NowSeconds - Current time (FPlatformTime::Seconds)
+     * @return true if KeyHash is a duplicate
+     */
+    bool CheckAndInsert(uint64 KeyHash, double NowSeconds);
+
+    /** Forgets every key */
+    void Reset();
+
+    void SetWindowSeconds(double InWindowSeconds);
+    double GetWindowSeconds() const { return WindowSeconds; }
+
+private:
+    static constexpr int32 NumBuckets = 4096;
+    static constexpr int32 SlotsPerBucket = 4;
+    static constexpr int32 MaxKicks = 128;
+    static constexpr int32 ExactCapacity = 256;
+
+    struct FGeneration
+    {
+        /** 0 marks an empty slot */
+        uint16 Slots[NumBuckets * SlotsPerBucket];
+
+        bool Contains(uint32 Bucket, uint16 Fingerprint) const;
+        bool TryPlace(uint32 Bucket, uint16 Fingerprint);
+        void Reset();
+    };
+
+    /** Returns false if the generation is too full to take Fingerprint */
+    bool InsertCurrent(uint32 Bucket, uint16 Fingerprint);
+
+    /** Clears the older generation and makes it current */
+    void Rotate(double NowSeconds);
+
+    /** Bytes counted against the Caches pool while the window exists */
+    static int64 GetTrackedBytes();
+
+    FGeneration Generations[2];
+    int32 Current;
+    double GenerationStartSeconds;
+    double WindowSeconds;
+    uint32 KickState;
+    TLruCache<uint64, double> Exact;
+    FCriticalSection Lock;
+};
@@ -0,0 +1,624 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Signed deep link verification.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkAuth.h"
+#include "ABCT_DeepLinkBatch.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+#include "Async/Async.h"
+#include "Containers/Queue.h"
+#include "Dom/JsonObject.h"
+#include "Hash/CityHash.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <atomic>
+
+// ============================================================================
+// SHA-256
+// ============================================================================
+
+namespace
+{
+    const uint32 RoundConstants[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+    };
+
+    FORCEINLINE uint32 RotateRight(uint32 Value, uint32 Bits)
+    {
+        return (Value >> Bits) | (Value << (32 - Bits));
+    }
+}
+
+FABCTSha256::FABCTSha256()
+    : TotalBytes(0), BufferBytes(0)
+{
+    State[0] = 0x6a09e667;
+    State[1] = 0xbb67ae85;
+    State[2] = 0x3c6ef372;
+    State[3] = 0xa54ff53a;
+    State[4] = 0x510e527f;
+    State[5] = 0x9b05688c;
+    State[6] = 0x1f83d9ab;
+    State[7] = 0x5be0cd19;
+}
+
+void FABCTSha256::Update(const uint8 *Data, int64 Size)
+{
+    TotalBytes += Size;
+    if (BufferBytes > 0)
+    {
+        const int32 Take = (int32)FMath::Min<int64>(BlockSize - BufferBytes, Size);
+        FMemory::Memcpy(Buffer + BufferBytes, Data, Take);
+        BufferBytes += Take;
+        Data += Take;
+        Size -= Take;
+        if (BufferBytes < BlockSize)
+        {
+            return;
+        }
+        Transform(Buffer);
+        BufferBytes = 0;
+    }
+    for (; Size >= BlockSize; Data += BlockSize, Size -= BlockSize)
+    {
+        Transform(Data);
+    }
+    if (Size > 0)
+    {
+        FMemory::Memcpy(Buffer, Data, Size);
+        BufferBytes = (int32)Size;
+    }
+}
+
+void FABCTSha256::Final(uint8 (&OutDigest)[DigestSize])
+{
+    // 0x80, zeros, then the message length in bits as a big-endian 64-bit integer
+    const uint64 TotalBits = TotalBytes * 8;
+    Buffer[BufferBytes++] = 0x80;
+    if (BufferBytes > BlockSize - 8)
+    {
+        FMemory::Memzero(Buffer + BufferBytes, BlockSize - BufferBytes);
+        Transform(Buffer);
+        BufferBytes = 0;
+    }
+    FMemory::Memzero(Buffer + BufferBytes, BlockSize - 8 - BufferBytes);
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        Buffer[BlockSize - 8 + Index] = (uint8)(TotalBits >> (56 - Index * 8));
+    }
+    Transform(Buffer);
+    BufferBytes = 0;
+
+    for (int32 Index = 0; Index < 8; ++Index)
+    {
+        OutDigest[Index * 4 + 0] = (uint8)(State[Index] >> 24);
+        OutDigest[Index * 4 + 1] = (uint8)(State[Index] >> 16);
+        OutDigest[Index * 4 + 2] = (uint8)(State[Index] >> 8);
+        OutDigest[Index * 4 + 3] = (uint8)State[Index];
+    }
+}
+
+void FABCTSha256::Transform(const uint8 *Block)
+{
+    uint32 Schedule[64];
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        Schedule[Index] = ((uint32)Block[Index * 4] << 24) | ((uint32)Block[Index * 4 + 1] << 16) | ((uint32)Block[Index * 4 + 2] << 8) | (uint32)Block[Index * 4 + 3];
+    }
+    for (int32 Index = 16; Index < 64; ++Index)
+    {
+        const uint32 S0 = RotateRight(Schedule[Index - 15], 7) ^ RotateRight(Schedule[Index - 15], 18) ^ (Schedule[Index - 15] >> 3);
+        const uint32 S1 = RotateRight(Schedule[Index - 2], 17) ^ RotateRight(Schedule[Index - 2], 19) ^ (Schedule[Index - 2] >> 10);
+        Schedule[Index] = Schedule[Index - 16] + S0 + Schedule[Index - 7] + S1;
+    }
+
+    uint32 A = State[0], B = State[1], C = State[2], D = State[3], E = State[4], F = State[5], G = State[6], H = State[7];
+    for (int32 Index = 0; Index < 64; ++Index)
+    {
+        const uint32 Temp1 = H + (RotateRight(E, 6) ^ RotateRight(E, 11) ^ RotateRight(E, 25)) + ((E & F) ^ (~E & G)) + RoundConstants[Index] + Schedule[Index];
+        const uint32 Temp2 = (RotateRight(A, 2) ^ RotateRight(A, 13) ^ RotateRight(A, 22)) + ((A & B) ^ (A & C) ^ (B & C));
+        H = G;
+        G = F;
+        F = E;
+        E = D + Temp1;
+        D = C;
+        C = B;
+        B = A;
+        A = Temp1 + Temp2;
+    }
+
+    State[0] += A;
+    State[1] += B;
+    State[2] += C;
+    State[3] += D;
+    State[4] += E;
+    State[5] += F;
+    State[6] += G;
+    State[7] += H;
+}
+
+// ============================================================================
+// HMAC-SHA256
+// ============================================================================
+
+FABCTHmacSha256::FABCTHmacSha256(TConstArrayView<uint8> Key)
+{
+    // Keys longer than a block are hashed first (RFC 2104)
+    uint8 KeyBlock[FABCTSha256::BlockSize] = {};
+    if (Key.Num() > FABCTSha256::BlockSize)
+    {
+        FABCTSha256 KeyHash;
+        KeyHash.Update(Key.GetData(), Key.Num());
+        uint8 Digest[FABCTSha256::DigestSize];
+        KeyHash.Final(Digest);
+        FMemory::Memcpy(KeyBlock, Digest, sizeof(Digest));
+    }
+    else if (Key.Num() > 0)
+    {
+        FMemory::Memcpy(KeyBlock, Key.GetData(), Key.Num());
+    }
+
+    uint8 Pad[FABCTSha256::BlockSize];
+    for (int32 Index = 0; Index < FABCTSha256::BlockSize; ++Index)
+    {
+        Pad[Index] = KeyBlock[Index] ^ 0x36;
+    }
+    Inner.Update(Pad, sizeof(Pad));
+    for (int32 Index = 0; Index < FABCTSha256::BlockSize; ++Index)
+    {
+        Pad[Index] = KeyBlock[Index] ^ 0x5c;
+    }
+    Outer.Update(Pad, sizeof(Pad));
+}
+
+void FABCTHmacSha256::Compute(TConstArrayView<uint8> Message, uint8 (&OutMac)[FABCTSha256::DigestSize]) const
+{
+    FABCTSha256 InnerHash = Inner;
+    InnerHash.Update(Message.GetData(), Message.Num());
+    uint8 InnerDigest[FABCTSha256::DigestSize];
+    InnerHash.Final(InnerDigest);
+
+    FABCTSha256 OuterHash = Outer;
+    OuterHash.Update(InnerDigest, sizeof(InnerDigest));
+    OuterHash.Final(OutMac);
+}
+
+// ============================================================================
+// Replay Cache
+// ============================================================================
+
+FABCTReplayCache::FABCTReplayCache(int32 InCapacity)
+    : Capacity(FMath::Max(InCapacity, 1))
+{
+}
+
+FABCTReplayCache::EResult FABCTReplayCache::CheckAndInsert(uint64 NonceHash, double ExpirySeconds, double NowSeconds)
+{
+    FScopeLock ScopeLock(&Lock);
+
+    if (const double *Expiry = ExpiryByNonce.Find(NonceHash))
+    {
+        if (*Expiry >= NowSeconds)
+        {
+            return EResult::Replayed;
+        }
+    }
+    else if (ExpiryByNonce.Num() >= Capacity)
+    {
+        for (auto It = ExpiryByNonce.CreateIterator(); It; ++It)
+        {
+            if (It.Value() < NowSeconds)
+            {
+                It.RemoveCurrent();
+            }
+        }
+        if (ExpiryByNonce.Num() >= Capacity)
+        {
+            return EResult::Full;
+        }
+    }
+
+    ExpiryByNonce.Add(NonceHash, ExpirySeconds);
+    return EResult::Fresh;
+}
+
+void FABCTReplayCache::Reset()
+{
+    FScopeLock ScopeLock(&Lock);
+    ExpiryByNonce.Empty(Capacity);
+}
+
+int32 FABCTReplayCache::Num() const
+{
+    FScopeLock ScopeLock(&Lock);
+    return ExpiryByNonce.Num();
+}
+
+// ============================================================================
+// Signed Links
+// ============================================================================
+
+namespace
+{
+    using FHmacRef = TSharedPtr<const FABCTHmacSha256, ESPMode::ThreadSafe>;
+
+    FRWLock ConfigLock;
+    FHmacRef Hmac;
+    TSet<FString> SignedActions;
+
+    FABCTReplayCache &GetReplayCache()
+    {
+        static FABCTReplayCache ReplayCache(ABCTDeepLinkAuth::ReplayCacheCapacity);
+        return ReplayCache;
+    }
+
+    FHmacRef GetHmac()
+    {
+        FReadScopeLock ReadLock(ConfigLock);
+        return Hmac;
+    }
+
+    /** Underscore params are added after signing, except the nonce and expiry */
+    bool IsSignedParam(const FString &Key)
+    {
+        const FStringView KeyView = Key;
+        return !KeyView.StartsWith(TEXT('_')) ||
+               KeyView.Equals(ABCTDeepLinkAuth::NonceParam, ESearchCase::CaseSensitive) ||
+               KeyView.Equals(ABCTDeepLinkAuth::ExpiryParam, ESearchCase::CaseSensitive);
+    }
+
+    /** Appends "<UTF-8 byte length>:<Value>", so no value can pass for a separator */
+    void AppendField(FString &Text, FStringView Value)
+    {
+        Text += LexToString(FPlatformString::ConvertedLength<UTF8CHAR>(Value.GetData(), Value.Len()));
+        Text += TEXT(':');
+        Text += Value;
+    }
+
+    /**
+     * The text the signature covers: the action, then each signed param in key order as its key,
+     * a JSON type tag (s string, n number, b bool, j anything else) and its value, every part
+     * length-prefixed. "1\nb=2" and "1" + b=2, or "42" and 42, give different texts.
+     */
+    FString BuildSignedText(const FString &Action, const FJsonObject &Params)
+    {
+        TArray<const TPair<FString, TSharedPtr<FJsonValue>> *> Signed;
+        Signed.Reserve(Params.Values.Num());
+        for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Params.Values)
+        {
+            if (Pair.Value.IsValid() && IsSignedParam(Pair.Key))
+            {
+                Signed.Add(&Pair);
+            }
+        }
+        Signed.Sort([](const TPair<FString, TSharedPtr<FJsonValue>> &A, const TPair<FString, TSharedPtr<FJsonValue>> &B)
+                    { return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0; });
+
+        FString Text;
+        AppendField(Text, Action);
+        for (const TPair<FString, TSharedPtr<FJsonValue>> *Pair : Signed)
+        {
+            AppendField(Text, Pair->Key);
+
+            const EJson Type = Pair->Value->Type;
+            if (Type == EJson::String)
+            {
+                Text += TEXT('s');
+                AppendField(Text, Pair->Value->AsString());
+                continue;
+            }
+            Text += Type == EJson::Number ? TEXT('n') : Type == EJson::Boolean ? TEXT('b') : TEXT('j');
+
+            FString Compact;
+            TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Compact);
+            FJsonSerializer::Serialize(Pair->Value, FString(), Writer);
+            AppendField(Text, Compact);
+        }
+        return Text;
+    }
+
+    void ComputeMac(const FABCTHmacSha256 &Key, const FString &Text, uint8 (&OutMac)[FABCTSha256::DigestSize])
+    {
+        const FTCHARToUTF8 Utf8(*Text, Text.Len());
+        Key.Compute(TConstArrayView<uint8>((const uint8 *)Utf8.Get(), Utf8.Length()), OutMac);
+    }
+
+    bool ParseHexMac(FStringView Hex, uint8 (&OutMac)[FABCTSha256::DigestSize])
+    {
+        if (Hex.Len() != FABCTSha256::DigestSize * 2)
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < FABCTSha256::DigestSize; ++Index)
+        {
+            const TCHAR High = Hex[Index * 2];
+            const TCHAR Low = Hex[Index * 2 + 1];
+            if (!FChar::IsHexDigit(High) || !FChar::IsHexDigit(Low))
+            {
+                return false;
+            }
+            OutMac[Index] = (uint8)((FParse::HexDigit(High) << 4) | FParse::HexDigit(Low));
+        }
+        return true;
+    }
+
+    /** Compares every byte so the time taken does not reveal how much of a forgery matched */
+    bool ConstantTimeEquals(const uint8 (&A)[FABCTSha256::DigestSize], const uint8 (&B)[FABCTSha256::DigestSize])
+    {
+        uint8 Difference = 0;
+        for (int32 Index = 0; Index < FABCTSha256::DigestSize; ++Index)
+        {
+            Difference |= A[Index] ^ B[Index];
+        }
+        return Difference == 0;
+    }
+
+    EABCTDeepLinkAuthResult VerifySigned(const FString &Action, const FString &ParamsJson, FStringView SignatureHex, double NowSeconds)
+    {
+        uint8 Signature[FABCTSha256::DigestSize];
+        if (!ParseHexMac(SignatureHex, Signature))
+        {
+            return EABCTDeepLinkAuthResult::Malformed;
+        }
+
+        const FHmacRef Key = GetHmac();
+        if (!Key.IsValid())
+        {
+            return EABCTDeepLinkAuthResult::BadSignature;
+        }
+
+        LLM_SCOPE_BYTAG(ABCT_Parsing);
+        TSharedPtr<FJsonObject> Params;
+        FString Nonce;
+        FString ExpiryText;
+        double ExpirySeconds = 0.0;
+        if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ParamsJson), Params) || !Params.IsValid() ||
+            !Params->TryGetStringField(FString(ABCTDeepLinkAuth::NonceParam), Nonce) || Nonce.IsEmpty() ||
+            !Params->TryGetStringField(FString(ABCTDeepLinkAuth::ExpiryParam), ExpiryText) || !LexTryParseString(ExpirySeconds, *ExpiryText))
+        {
+            return EABCTDeepLinkAuthResult::Malformed;
+        }
+
+        // Checked before the nonce is recorded, so forged links cannot fill the replay cache
+        uint8 Expected[FABCTSha256::DigestSize];
+        ComputeMac(*Key, BuildSignedText(Action, *Params), Expected);
+        if (!ConstantTimeEquals(Signature, Expected))
+        {
+            return EABCTDeepLinkAuthResult::BadSignature;
+        }
+        if (ExpirySeconds < NowSeconds || ExpirySeconds - NowSeconds > ABCTDeepLinkAuth::MaxLifetimeSeconds)
+        {
+            return EABCTDeepLinkAuthResult::Expired;
+        }
+
+        const uint64 NonceHash = CityHash64((const char *)*Nonce, Nonce.Len() * sizeof(TCHAR));
+        switch (GetReplayCache().CheckAndInsert(NonceHash, ExpirySeconds, NowSeconds))
+        {
+        case FABCTReplayCache::EResult::Replayed:
+            return EABCTDeepLinkAuthResult::Replayed;
+        case FABCTReplayCache::EResult::Full:
+            return EABCTDeepLinkAuthResult::ReplayCacheFull;
+        default:
+            return EABCTDeepLinkAuthResult::Verified;
+        }
+    }
+
+    // ============================================================================
+    // Verification Worker
+    // ============================================================================
+
+    struct FPendingLink
+    {
+        FABCTEventRef Event;
+        TUniqueFunction<void()> Release;
+        int64 TrackedBytes = 0;
+    };
+
+    TQueue<FPendingLink, EQueueMode::Mpsc> PendingLinks;
+    std::atomic<int32> NumPending{0};
+
+    double NowUnixSeconds()
+    {
+        return (double)(FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTicks() / ETimespan::TicksPerSecond;
+    }
+
+    /** Whether an unsigned link of Action would run a signed action (itself, or a sub-command of a batch) */
+    bool RequiresSignature(const FString &Action, const FString &ParamsJson)
+    {
+        if (ABCTDeepLinkAuth::IsSignedAction(Action))
+        {
+            return true;
+        }
+        if (!ABCTDeepLinkBatch::IsBatchAction(Action))
+        {
+            return false;
+        }
+
+        // A batch that does not decode is rejected as a whole when it is handled
+        TArray<FABCTEventRef> Commands;
+        FString Error;
+        if (!ABCTDeepLinkBatch::Decode(ParamsJson, Commands, Error))
+        {
+            return false;
+        }
+        return Commands.ContainsByPredicate([](const FABCTEventRef &Command)
+                                            { return ABCTDeepLinkAuth::IsSignedAction(Command->GetName()); });
+    }
+
+    /** Verifies and releases links in submission order until the queue is empty */
+    void DrainPending()
+    {
+        do
+        {
+            FPendingLink Link;
+            verify(PendingLinks.Dequeue(Link));
+            ABCTStats::AddGauge(EABCTGauge::DeepLinkVerifyQueueDepth, -1);
+            ABCTMemory::Track(EABCTMemoryPool::Queues, -Link.TrackedBytes);
+
+            const EABCTDeepLinkAuthResult Result = ABCTDeepLinkAuth::Verify(Link.Event->GetName(), Link.Event->GetPayload(), NowUnixSeconds());
+            if (ABCTDeepLinkAuth::IsAccepted(Result))
+            {
+                Link.Release();
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("ABCTDeepLinkAuth - Rejected deep link '%s': %s"), *Link.Event->GetName(), ABCTDeepLinkAuth::LexToString(Result));
+            }
+        } while (NumPending.fetch_sub(1, std::memory_order_acq_rel) > 1);
+    }
+}
+
+namespace ABCTDeepLinkAuth
+{
+    void SetKey(TConstArrayView<uint8> Key)
+    {
+        FHmacRef NewHmac = Key.Num() > 0 ? MakeShared<FABCTHmacSha256, ESPMode::ThreadSafe>(Key) : FHmacRef();
+        FWriteScopeLock WriteLock(ConfigLock);
+        Hmac = MoveTemp(NewHmac);
+    }
+
+    bool IsEnabled()
+    {
+        FReadScopeLock ReadLock(ConfigLock);
+        return Hmac.IsValid();
+    }
+
+    void SetSignedActions(const TArray<FString> &Actions)
+    {
+        FWriteScopeLock WriteLock(ConfigLock);
+        SignedActions.Reset();
+        for (const FString &Action : Actions)
+        {
+            SignedActions.Add(Action.ToLower());
+        }
+    }
+
+    bool IsSignedAction(const FString &Action)
+    {
+        FReadScopeLock ReadLock(ConfigLock);
+        return SignedActions.Num() > 0 && SignedActions.Contains(Action.ToLower());
+    }
+
+    EABCTDeepLinkAuthResult Verify(const FString &Action, const FString &ParamsJson, double NowSeconds)
+    {
+        FStringView SignatureHex;
+        if (!ABCTJsonScan::FindStringField(ParamsJson, SignatureParam, SignatureHex))
+        {
+            if (!RequiresSignature(Action, ParamsJson))
+            {
+                return EABCTDeepLinkAuthResult::Unsigned;
+            }
+            ABCTStats::Increment(EABCTCounter::DeepLinkSignaturesRejected);
+            return EABCTDeepLinkAuthResult::MissingSignature;
+        }
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const EABCTDeepLinkAuthResult Result = VerifySigned(Action, ParamsJson, SignatureHex, NowSeconds);
+        ABCTStats::RecordCyclesSince(EABCTHistogram::DeepLinkVerifyMicros, StartCycles);
+
+        switch (Result)
+        {
+        case EABCTDeepLinkAuthResult::Verified:
+            ABCTStats::Increment(EABCTCounter::DeepLinkSignaturesVerified);
+            break;
+        case EABCTDeepLinkAuthResult::Replayed:
+        case EABCTDeepLinkAuthResult::ReplayCacheFull:
+            ABCTStats::Increment(EABCTCounter::DeepLinkReplaysRejected);
+            break;
+        default:
+            ABCTStats::Increment(EABCTCounter::DeepLinkSignaturesRejected);
+            break;
+        }
+        return Result;
+    }
+
+    FString Sign(const FString &Action, const FString &ParamsJson)
+    {
+        const FHmacRef Key = GetHmac();
+        TSharedPtr<FJsonObject> Params;
+        if (!Key.IsValid() || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ParamsJson), Params) || !Params.IsValid())
+        {
+            return FString();
+        }
+
+        uint8 Mac[FABCTSha256::DigestSize];
+        ComputeMac(*Key, BuildSignedText(Action, *Params), Mac);
+        return BytesToHex(Mac, sizeof(Mac)).ToLower();
+    }
+
+    void Submit(const FABCTEventRef &Event, TUniqueFunction<void()> &&Release)
+    {
+        FPendingLink Link;
+        Link.Event = Event;
+        Link.Release = MoveTemp(Release);
+        Link.TrackedBytes = Event->GetAllocatedSize();
+        ABCTMemory::Track(EABCTMemoryPool::Queues, Link.TrackedBytes);
+        ABCTStats::AddGauge(EABCTGauge::DeepLinkVerifyQueueDepth, 1);
+        PendingLinks.Enqueue(MoveTemp(Link));
+
+        // One worker at a time keeps release order; it runs until the queue is empty
+        if (NumPending.fetch_add(1, std::memory_order_acq_rel) == 0)
+        {
+            AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, []()
+                      { DrainPending(); });
+        }
+    }
+
+    void WaitForPending()
+    {
+        while (NumPending.load(std::memory_order_acquire) > 0)
+        {
+            FPlatformProcess::SleepNoStats(0.0f);
+        }
+    }
+
+    void ResetReplayCache()
+    {
+        GetReplayCache().Reset();
+    }
+
+    bool IsAccepted(EABCTDeepLinkAuthResult Result)
+    {
+        return Result == EABCTDeepLinkAuthResult::Unsigned || Result == EABCTDeepLinkAuthResult::Verified;
+    }
+
+    const TCHAR *LexToString(EABCTDeepLinkAuthResult Result)
+    {
+        switch (Result)
+        {
+        case EABCTDeepLinkAuthResult::Unsigned:
+            return TEXT("unsigned");
+        case EABCTDeepLinkAuthResult::Verified:
+            return TEXT("verified");
+        case EABCTDeepLinkAuthResult::MissingSignature:
+            return TEXT("missing signature");
+        case EABCTDeepLinkAuthResult::Malformed:
+            return TEXT("malformed signature params");
+        case EABCTDeepLinkAuthResult::Expired:
+            return TEXT("expired");
+        case EABCTDeepLinkAuthResult::BadSignature:
+            return TEXT("bad signature");
+        case EABCTDeepLinkAuthResult::Replayed:
+            return TEXT("replayed nonce");
+        case EABCTDeepLinkAuthResult::ReplayCacheFull:
+            return TEXT("replay cache full");
+        default:
+            return TEXT("unknown");
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Signed deep link verification.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_Event.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * FABCTSha256
+ *
+ * Incremental SHA-256. The state is plain data, so a partly fed hash can be copied and
+ * continued, which is what FABCTHmacSha256 precomputes its keyed pads into.
+ */
+class FABCTSha256
+{
+public:
+    static constexpr int32 DigestSize = 32;
+    static constexpr int32 BlockSize = 64;
+
+    FABCTSha256();
+
+    void Update(const uint8 *Data, int64 Size);
+
+    /** Pads and writes the digest; the hash cannot be updated afterwards */
+    void Final(uint8 (&OutDigest)[DigestSize]);
+
+private:
+    void Transform(const uint8 *Block);
+
+    uint32 State[8];
+    uint64 TotalBytes;
+    uint8 Buffer[BlockSize];
+    int32 BufferBytes;
+};
+
+/**
+ * FABCTHmacSha256
+ *
+ * HMAC-SHA256 with the key's inner and outer pads hashed once at construction. Each MAC
+ * copies the two states and hashes only the message and the inner digest. Const and
+ * thread-safe after construction.
+ */
+class FABCTHmacSha256
+{
+public:
+    explicit FABCTHmacSha256(TConstArrayView<uint8> Key);
+
+    void Compute(TConstArrayView<uint8> Message, uint8 (&OutMac)[FABCTSha256::DigestSize]) const;
+
+private:
+    FABCTSha256 Inner;
+    FABCTSha256 Outer;
+};
+
+/**
+ * FABCTReplayCache
+ *
+ * Nonces of accepted signed links, each kept until its link expires. Bounded: expired nonces
+ * are purged when the cache fills, and if it is still full new links are refused rather than
+ * forgetting a nonce whose link could still be replayed. Thread-safe.
+ */
+class FABCTReplayCache
+{
+public:
+    enum class EResult : uint8
+    {
+        Fresh,
+        Replayed,
+        Full,
+    };
+
+    explicit FABCTReplayCache(int32 InCapacity);
+
+    /**
+     * Records NonceHash until ExpirySeconds unless it is already recorded.
+     *
+     * @param NonceHash - 64-bit hash of the nonce
+     * @param ExpirySeconds - When the link expires, in seconds since the Unix epoch
+     * @param NowSeconds - Current time, in seconds since the Unix epoch
+     */
+    EResult CheckAndInsert(uint64 NonceHash, double ExpirySeconds, double NowSeconds);
+
+    void Reset();
+
+    int32 Num() const;
+
+private:
+    TMap<uint64, double> ExpiryByNonce;
+    int32 Capacity;
+    mutable FCriticalSection Lock;
+};
+
+/**
+ * Outcome of checking a deep link's signature. Unsigned and Verified links are delivered.
+ */
+enum class EABCTDeepLinkAuthResult : uint8
+{
+    /** No signature and the action (or none of a batch's sub-commands) requires one */
+    Unsigned,
+    /** Valid signature, unexpired, nonce not seen before */
+    Verified,
+    /** The action requires a signature and the link has none */
+    MissingSignature,
+    /** No nonce or expiry, or a signature that is not 64 hex digits */
+    Malformed,
+    /** Past its expiry, or an expiry further out than MaxLifetimeSeconds */
+    Expired,
+    /** The signature does not match (or no key is set) */
+    BadSignature,
+    /** The nonce was already used */
+    Replayed,
+    /** The replay cache is full of unexpired nonces */
+    ReplayCacheFull,
+};
+
+/**
+ * ABCTDeepLinkAuth
+ *
+ * Optional HMAC-SHA256 signed deep links, so actions like reward grants only run for links
+ * the game server issued:
+ *
+ *   uewebtest://grant?item=sword&_nonce=9f1c2e&_exp=1718000300&_sig=<64 hex digits>
+ *
+ * The signature covers the action and the params in key order. Keys and values are prefixed
+ * with their UTF-8 byte length, values also with their JSON type (s, n, b, or j for the rest):
+ *
+ *   5:grant4:_exps10:17180003006:_nonces6:9f1c2e4:items5:sword
+ *
+ * as UTF-8, with decoded values. Params starting with "_" are transport metadata added along
+ * the way (_t, _idk, _intent_age_us) and are not signed, except _nonce and _exp. Non-string
+ * values (the cmds array of batch links) are signed in compact JSON form.
+ *
+ * Once a key is set, every deep link goes through one worker thread: links carrying _sig are
+ * verified there, and links are released to the game thread in arrival order, so the game
+ * thread never hashes and a slow verification cannot reorder links. Rejected links are dropped
+ * with a warning.
+ */
+namespace ABCTDeepLinkAuth
+{
+    constexpr FStringView SignatureParam = TEXTVIEW("_sig");
+    constexpr FStringView NonceParam = TEXTVIEW("_nonce");
+    constexpr FStringView ExpiryParam = TEXTVIEW("_exp");
+
+    /** Longest accepted link lifetime; bounds how long nonces are kept */
+    constexpr double MaxLifetimeSeconds = 600.0;
+
+    /** Unexpired nonces remembered at most */
+    constexpr int32 ReplayCacheCapacity = 4096;
+
+    /** Sets the shared secret (raw bytes); an empty key turns verification off */
+    void SetKey(TConstArrayView<uint8> Key);
+
+    bool IsEnabled();
+
+    /**
+     * Actions dropped unless signed (case-insensitive). Links of other actions may be unsigned,
+     * except batches with a signed action among their sub-commands, which must be signed as a whole.
+     */
+    void SetSignedActions(const TArray<FString> &Actions);
+
+    bool IsSignedAction(const FString &Action);
+
+    /**
+     * Checks one link against the current key and records its nonce if it verifies.
+     * Thread-safe; normally called on the verification worker.
+     *
+     * @param Action - Deep link action
+     * @param ParamsJson - Params as delivered by the Java side
+     * @param NowSeconds - Current time, in seconds since the Unix epoch
+     */
+    EABCTDeepLinkAuthResult Verify(const FString &Action, const FString &ParamsJson, double NowSeconds);
+
+    /** Signature of a link with the current key, as 64 lower-case hex digits (tests, tools) */
+    FString Sign(const FString &Action, const FString &ParamsJson);
+
+    /**
+     * Queues Event for verification on the worker. Release runs on the worker, in submission
+     * order, for every link that is delivered.
+     */
+    void Submit(const FABCTEventRef &Event, TUniqueFunction<void()> &&Release);
+
+    /** Blocks until every submitted link has been verified (tests, shutdown) */
+    void WaitForPending();
+
+    /** Forgets every nonce */
+    void ResetReplayCache();
+
+    bool IsAccepted(EABCTDeepLinkAuthResult Result);
+
+    const TCHAR *LexToString(EABCTDeepLinkAuthResult Result);
+}
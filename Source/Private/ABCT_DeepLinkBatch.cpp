@@ -0,0 +1,132 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Multi-command batch deep links.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkBatch.h"
+#include "ABCT_JsonWriter.h"
+#include "ABCT_Memory.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    /** Returns the cmds array, parsing it first if the Java side delivered it as a string */
+    const TArray<TSharedPtr<FJsonValue>> *FindCommands(const FJsonObject &Params, TSharedPtr<FJsonValue> &OutParsed)
+    {
+        const TSharedPtr<FJsonValue> Field = Params.TryGetField(TEXT("cmds"));
+        if (!Field.IsValid())
+        {
+            return nullptr;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>> *Commands = nullptr;
+        if (Field->TryGetArray(Commands))
+        {
+            return Commands;
+        }
+
+        FString Encoded;
+        if (Field->Type == EJson::String && Field->TryGetString(Encoded))
+        {
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Encoded);
+            if (FJsonSerializer::Deserialize(Reader, OutParsed) && OutParsed.IsValid() && OutParsed->TryGetArray(Commands))
+            {
+                return Commands;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Writes a sub-command's params as the flat string map regular deep links carry */
+    bool WriteParams(const TSharedPtr<FJsonObject> &Params, FString &OutJson)
+    {
+        FABCTJsonWriter Writer(OutJson);
+        Writer.BeginObject();
+        if (Params.IsValid())
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>> &Pair : Params->Values)
+            {
+                FString Value;
+                const bool bScalar = Pair.Value.IsValid() &&
+                                     (Pair.Value->Type == EJson::String || Pair.Value->Type == EJson::Number || Pair.Value->Type == EJson::Boolean);
+                if (!bScalar || !Pair.Value->TryGetString(Value))
+                {
+                    return false;
+                }
+                Writer.Field(Pair.Key, Value);
+            }
+        }
+        Writer.EndObject();
+        return true;
+    }
+}
+
+namespace ABCTDeepLinkBatch
+{
+    bool IsBatchAction(const FString &Action)
+    {
+        return Action.Equals(BatchAction, ESearchCase::IgnoreCase);
+    }
+
+    bool Decode(const FString &ParamsJson, TArray<FABCTEventRef> &OutCommands, FString &OutError)
+    {
+        OutCommands.Reset();
+        LLM_SCOPE_BYTAG(ABCT_Parsing);
+
+        TSharedPtr<FJsonObject> Params;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ParamsJson);
+        if (!FJsonSerializer::Deserialize(Reader, Params) || !Params.IsValid())
+        {
+            OutError = TEXT("params are not a JSON object");
+            return false;
+        }
+
+        TSharedPtr<FJsonValue> Parsed;
+        const TArray<TSharedPtr<FJsonValue>> *Commands = FindCommands(*Params, Parsed);
+        if (!Commands)
+        {
+            OutError = TEXT("no cmds array");
+            return false;
+        }
+        if (Commands->Num() > MaxCommands)
+        {
+            OutError = FString::Printf(TEXT("%d commands, limit is %d"), Commands->Num(), MaxCommands);
+            return false;
+        }
+
+        TArray<FABCTEventRef> Decoded;
+        Decoded.Reserve(Commands->Num());
+        for (int32 Index = 0; Index < Commands->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject> *Command = nullptr;
+            FString Action;
+            if (!(*Commands)[Index].IsValid() || !(*Commands)[Index]->TryGetObject(Command) || !(*Command)->TryGetStringField(TEXT("action"), Action) || Action.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("command %d has no action"), Index);
+                return false;
+            }
+            if (IsBatchAction(Action))
+            {
+                OutError = FString::Printf(TEXT("command %d is a nested batch"), Index);
+                return false;
+            }
+
+            const TSharedPtr<FJsonObject> *CommandParams = nullptr;
+            (*Command)->TryGetObjectField(TEXT("params"), CommandParams);
+
+            FString CommandJson;
+            if (!WriteParams(CommandParams ? *CommandParams : nullptr, CommandJson))
+            {
+                OutError = FString::Printf(TEXT("command %d (%s) has a nested param value"), Index, *Action);
+                return false;
+            }
+            Decoded.Add(FABCTEvent::MakeDeepLink(MoveTemp(Action), MoveTemp(CommandJson)));
+        }
+
+        OutCommands = MoveTemp(Decoded);
+        return true;
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Multi-command batch deep links.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_Event.h"
+
+/**
+ * ABCTDeepLinkBatch
+ *
+ * Decodes batch deep links: one link that carries several sub-commands, so the page can
+ * grant items, set flags and navigate with a single intent and JNI crossing:
+ *
+ *   uewebtest://batch?cmds=[{"action":"grant","params":{"item":"sword"}},{"action":"setflag","params":{"name":"intro"}}]
+ *
+ * (URL-encoded in practice). The Java side passes cmds through as raw JSON, giving
+ * {"cmds":[...]}; a string-encoded array is accepted as well. Param values may be strings,
+ * numbers or booleans and reach the handlers as strings, like regular deep link params.
+ */
+namespace ABCTDeepLinkBatch
+{
+    /** Action name of batch links */
+    constexpr const TCHAR *BatchAction = TEXT("batch");
+
+    /** Sub-commands per batch */
+    constexpr int32 MaxCommands = 64;
+
+    /** Whether Action is the batch action (case-insensitive, like the URL host) */
+    bool IsBatchAction(const FString &Action);
+
+    /**
+     * Decodes every sub-command of a batch in one pass. The batch is all or nothing: if
+     * any sub-command is malformed (no action, nested batch, nested param values), nothing
+     * is returned.
+     *
+     * @param ParamsJson - Params of the batch link
+     * @param OutCommands - One deep link event per sub-command, in order
+     * @param OutError - Why the batch was rejected
+     * @return true if the batch decoded
+     */
+    bool Decode(const FString &ParamsJson, TArray<FABCTEventRef> &OutCommands, FString &OutError);
+}
@@ -0,0 +1,103 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - End-to-end deep link latency tracing.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkLatency.h"
+#include "ABCT_ClockSync.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_Stats.h"
+
+namespace
+{
+    /** Histogram of the stage that ends at each point; the first point starts the first stage */
+    const EABCTHistogram StageHistograms[] = {
+        EABCTHistogram::DeepLinkStageBrowserMicros,
+        EABCTHistogram::DeepLinkStageBridgeMicros,
+        EABCTHistogram::DeepLinkStageIngressMicros,
+        EABCTHistogram::DeepLinkStageQueueMicros,
+        EABCTHistogram::DeepLinkStageDecodeMicros,
+        EABCTHistogram::DeepLinkStageDispatchMicros,
+        EABCTHistogram::DeepLinkStageHandlerMicros,
+    };
+    static_assert(UE_ARRAY_COUNT(StageHistograms) == (int32)EABCTDeepLinkStamp::Count - 1, "StageHistograms out of sync with EABCTDeepLinkStamp");
+
+    /** Query params arrive as strings ({"_t":"1718000000123.5"}); plain numbers are accepted as well */
+    bool FindNumberParam(FStringView ParamsJson, FStringView Field, double &OutValue)
+    {
+        FStringView Value;
+        if (ABCTJsonScan::FindStringField(ParamsJson, Field, Value))
+        {
+            TStringBuilder<64> Terminated;
+            Terminated << Value;
+            OutValue = FCString::Atod(*Terminated);
+            return true;
+        }
+        return ABCTJsonScan::FindNumberField(ParamsJson, Field, OutValue);
+    }
+
+    uint64 MillisToMicros(double Millis)
+    {
+        return (uint64)FMath::Max(0.0, Millis * 1000.0);
+    }
+}
+
+void FABCTDeepLinkTrace::Stamp(EABCTDeepLinkStamp Point)
+{
+    StampMillis[(int32)Point] = ABCTClock::NowMillis();
+}
+
+namespace ABCTDeepLinkLatency
+{
+    FABCTDeepLinkTrace Begin(FStringView ParamsJson)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Parsing);
+        FABCTDeepLinkTrace Trace;
+        Trace.Stamp(EABCTDeepLinkStamp::JniEntry);
+
+        double PageTapMillis = 0.0;
+        if (FindNumberParam(ParamsJson, PageTapParam, PageTapMillis) && PageTapMillis > 0.0)
+        {
+            Trace.StampMillis[(int32)EABCTDeepLinkStamp::PageTap] = PageTapMillis;
+        }
+
+        double IntentAgeMicros = 0.0;
+        if (FindNumberParam(ParamsJson, IntentAgeParam, IntentAgeMicros) && IntentAgeMicros >= 0.0)
+        {
+            Trace.StampMillis[(int32)EABCTDeepLinkStamp::IntentReceived] = Trace.StampMillis[(int32)EABCTDeepLinkStamp::JniEntry] - IntentAgeMicros / 1000.0;
+        }
+        return Trace;
+    }
+
+    void Record(const FABCTDeepLinkTrace &Trace, FStringView Action)
+    {
+        // A new action label adds a histogram
+        LLM_SCOPE_BYTAG(ABCT);
+        // The page clock is the device wall clock unless the message channel measured otherwise
+        double Stamps[(int32)EABCTDeepLinkStamp::Count];
+        FMemory::Memcpy(Stamps, Trace.StampMillis, sizeof(Stamps));
+        const FABCTClockSync &ClockSync = FABCTMessageChannel::Get().GetClockSync();
+        if (Trace.HasStamp(EABCTDeepLinkStamp::PageTap) && ClockSync.HasEstimate())
+        {
+            Stamps[(int32)EABCTDeepLinkStamp::PageTap] = ClockSync.PageToGameMillis(Stamps[(int32)EABCTDeepLinkStamp::PageTap]);
+        }
+
+        for (int32 Point = 1; Point < (int32)EABCTDeepLinkStamp::Count; ++Point)
+        {
+            if (Stamps[Point - 1] > 0.0 && Stamps[Point] > 0.0)
+            {
+                ABCTStats::RecordHistogram(StageHistograms[Point - 1], MillisToMicros(Stamps[Point] - Stamps[Point - 1]));
+            }
+        }
+
+        const double PageTapMillis = Stamps[(int32)EABCTDeepLinkStamp::PageTap];
+        const double CompletedMillis = Stamps[(int32)EABCTDeepLinkStamp::Completed];
+        if (PageTapMillis > 0.0 && CompletedMillis > 0.0)
+        {
+            ABCTStats::RecordDeepLinkEndToEnd(Action, MillisToMicros(CompletedMillis - PageTapMillis));
+        }
+    }
+}
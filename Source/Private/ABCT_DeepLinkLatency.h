@@ -0,0 +1,81 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - End-to-end deep link latency tracing.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Points a deep link passes on its way from the page to gameplay code, in order.
+ * The stage histograms measure the time between consecutive points.
+ */
+enum class EABCTDeepLinkStamp : uint8
+{
+    PageTap,
+    IntentReceived,
+    JniEntry,
+    Queued,
+    Dequeued,
+    Decoded,
+    Dispatched,
+    Completed,
+
+    Count
+};
+
+/**
+ * FABCTDeepLinkTrace
+ *
+ * Timestamps of one deep link, in milliseconds on the game clock (ABCTClock::NowMillis), or 0
+ * if the link did not pass the point. PageTap stays on the page clock until Record, which
+ * converts it with the current clock sync estimate. Small enough to copy into the ingress task.
+ */
+struct FABCTDeepLinkTrace
+{
+    double StampMillis[(int32)EABCTDeepLinkStamp::Count] = {};
+
+    /** Stamps Point with the current time */
+    void Stamp(EABCTDeepLinkStamp Point);
+
+    bool HasStamp(EABCTDeepLinkStamp Point) const { return StampMillis[(int32)Point] > 0.0; }
+};
+
+/**
+ * ABCTDeepLinkLatency
+ *
+ * Measures how long a deep link takes from the tap in the page until the game handled it,
+ * split by stage so slowness can be pinned on the browser and activity relaunch, the bridge,
+ * the game-thread queue or the handlers. The page opts in by adding its tap time:
+ *
+ *   uewebtest://jump?height=500&_t=1718000000123.5
+ *
+ * The Java side adds "_intent_age_us", the time since it received the intent.
+ */
+namespace ABCTDeepLinkLatency
+{
+    /** Tap time supplied by the page, in milliseconds since the Unix epoch on the page clock */
+    constexpr FStringView PageTapParam = TEXTVIEW("_t");
+
+    /** Microseconds between intent receipt and the JNI call, added by ChromeCustomTabs.java */
+    constexpr FStringView IntentAgeParam = TEXTVIEW("_intent_age_us");
+
+    /**
+     * Starts a trace at JNI entry. Stamps JniEntry and places PageTap and IntentReceived from
+     * the link params when present. Any thread.
+     *
+     * @param ParamsJson - Params of the deep link
+     */
+    FABCTDeepLinkTrace Begin(FStringView ParamsJson);
+
+    /**
+     * Records the stage histograms and, if the page supplied a tap time, the per-action
+     * end-to-end latency. Game thread only.
+     *
+     * @param Trace - The completed trace
+     * @param Action - The deep link action, used as the end-to-end label
+     */
+    void Record(const FABCTDeepLinkTrace &Trace, FStringView Action);
+}
@@ -0,0 +1,104 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Compact network payloads for deep link actions.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkNet.h"
+#include "Engine/NetSerialization.h"
+
+namespace
+{
+    /** Packs a count, rejecting values above Max when reading */
+    bool SerializeCount(FArchive &Ar, int32 &Count, int32 Max)
+    {
+        uint32 Packed = (uint32)FMath::Max(Count, 0);
+        Ar.SerializeIntPacked(Packed);
+        if (Ar.IsLoading())
+        {
+            if (Packed > (uint32)Max)
+            {
+                return false;
+            }
+            Count = (int32)Packed;
+        }
+        return !Ar.IsError();
+    }
+
+    /** Zig-zag encodes so small negative numbers stay small */
+    void SerializeSignedPacked(FArchive &Ar, int32 &Value)
+    {
+        uint32 ZigZag = ((uint32)Value << 1) ^ (uint32)(Value >> 31);
+        Ar.SerializeIntPacked(ZigZag);
+        if (Ar.IsLoading())
+        {
+            Value = (int32)(ZigZag >> 1) ^ -(int32)(ZigZag & 1);
+        }
+    }
+
+    bool SerializeAction(FArchive &Ar, FABCTNetDeepLinkAction &Action)
+    {
+        int32 ActionId = Action.ActionId;
+        if (!SerializeCount(Ar, ActionId, MAX_uint16))
+        {
+            return false;
+        }
+        Action.ActionId = ActionId;
+
+        uint8 bHasLocation = Action.bHasLocation ? 1 : 0;
+        Ar.SerializeBits(&bHasLocation, 1);
+        Action.bHasLocation = bHasLocation != 0;
+        if (Action.bHasLocation)
+        {
+            // 0.1 unit precision, up to 2^24 scaled units per component
+            SerializePackedVector<10, 24>(Action.Location, Ar);
+        }
+
+        int32 NumInts = Action.Ints.Num();
+        if (!SerializeCount(Ar, NumInts, FABCTNetDeepLinkBatch::MaxValuesPerAction))
+        {
+            return false;
+        }
+        Action.Ints.SetNum(NumInts);
+        for (int32 &Value : Action.Ints)
+        {
+            SerializeSignedPacked(Ar, Value);
+        }
+
+        int32 NumFloats = Action.Floats.Num();
+        if (!SerializeCount(Ar, NumFloats, FABCTNetDeepLinkBatch::MaxValuesPerAction))
+        {
+            return false;
+        }
+        Action.Floats.SetNum(NumFloats);
+        for (float &Value : Action.Floats)
+        {
+            Ar << Value;
+        }
+        return !Ar.IsError();
+    }
+}
+
+bool FABCTNetDeepLinkBatch::NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess)
+{
+    bOutSuccess = false;
+
+    int32 NumActions = Actions.Num();
+    checkf(Ar.IsLoading() || NumActions <= MaxActions, TEXT("FABCTNetDeepLinkBatch - more than %d actions in one batch"), MaxActions);
+    if (!SerializeCount(Ar, NumActions, MaxActions))
+    {
+        return true;
+    }
+    Actions.SetNum(NumActions);
+
+    for (FABCTNetDeepLinkAction &Action : Actions)
+    {
+        if (!SerializeAction(Ar, Action))
+        {
+            return true;
+        }
+    }
+
+    bOutSuccess = true;
+    return true;
+}
@@ -0,0 +1,124 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Native gameplay tag dispatch for deep links.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkRouter.h"
+
+namespace
+{
+    using FHandlerList = TSharedRef<FABCTDeepLinkTagEvent>;
+
+    /** Handlers per tag; the lists are shared so a handler can add or remove handlers mid-dispatch */
+    TMap<FGameplayTag, FHandlerList> &GetHandlers()
+    {
+        static TMap<FGameplayTag, FHandlerList> Handlers;
+        return Handlers;
+    }
+}
+
+// ============================================================================
+// FABCTDeepLinkEvent
+// ============================================================================
+
+bool FABCTDeepLinkEvent::GetParamAsFloat(const FString &Key, float &OutValue) const
+{
+    const FString *Value = FindParam(Key);
+    if (!Value)
+    {
+        return false;
+    }
+    OutValue = FCString::Atof(**Value);
+    return true;
+}
+
+bool FABCTDeepLinkEvent::GetParamAsInt(const FString &Key, int32 &OutValue) const
+{
+    const FString *Value = FindParam(Key);
+    if (!Value)
+    {
+        return false;
+    }
+    OutValue = FCString::Atoi(**Value);
+    return true;
+}
+
+// ============================================================================
+// ABCTDeepLinkRouter
+// ============================================================================
+
+namespace ABCTDeepLinkRouter
+{
+    FDelegateHandle AddHandler(FGameplayTag Tag, FABCTDeepLinkTagEvent::FDelegate Handler)
+    {
+        check(IsInGameThread());
+        if (!Tag.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("ABCTDeepLinkRouter::AddHandler - invalid tag, handler ignored"));
+            return FDelegateHandle();
+        }
+
+        TMap<FGameplayTag, FHandlerList> &Handlers = GetHandlers();
+        if (FHandlerList *Found = Handlers.Find(Tag))
+        {
+            return (*Found)->Add(MoveTemp(Handler));
+        }
+        FHandlerList List = MakeShared<FABCTDeepLinkTagEvent>();
+        const FDelegateHandle Handle = List->Add(MoveTemp(Handler));
+        Handlers.Add(Tag, MoveTemp(List));
+        return Handle;
+    }
+
+    void RemoveHandler(FGameplayTag Tag, FDelegateHandle Handle)
+    {
+        check(IsInGameThread());
+        TMap<FGameplayTag, FHandlerList> &Handlers = GetHandlers();
+        if (FHandlerList *Found = Handlers.Find(Tag))
+        {
+            (*Found)->Remove(Handle);
+            if (!(*Found)->IsBound())
+            {
+                Handlers.Remove(Tag);
+            }
+        }
+    }
+
+    void RemoveAllHandlers(const void *UserObject)
+    {
+        check(IsInGameThread());
+        for (auto It = GetHandlers().CreateIterator(); It; ++It)
+        {
+            It.Value()->RemoveAll(UserObject);
+            if (!It.Value()->IsBound())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    int32 Dispatch(const FABCTDeepLinkEvent &Event)
+    {
+        check(IsInGameThread());
+        TMap<FGameplayTag, FHandlerList> &Handlers = GetHandlers();
+
+        int32 NumTagsHandled = 0;
+        for (FGameplayTag Current = Event.Tag; Current.IsValid(); Current = Current.RequestDirectParent())
+        {
+            const FHandlerList *Found = Handlers.Find(Current);
+            if (!Found)
+            {
+                continue;
+            }
+
+            // Held by value: the map may change under us if a handler (un)registers
+            const FHandlerList List = *Found;
+            if (List->IsBound())
+            {
+                List->Broadcast(Event);
+                ++NumTagsHandled;
+            }
+        }
+        return NumTagsHandled;
+    }
+}
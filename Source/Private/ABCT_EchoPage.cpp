@@ -0,0 +1,96 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Bundled echo page for the channel benchmark.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_EchoPage.h"
+
+namespace
+{
+    // Keep in step with FABCTSimulatedBackend's echo mode
+    const ANSICHAR EchoPageHtml[] = R"ABCT(<!doctype html>
+<html>
+<head>
+<meta charset="utf-8">
+<meta name="viewport" content="width=device-width, initial-scale=1">
+<title>ABCT Channel Benchmark</title>
+<style>body { font: 16px sans-serif; margin: 2em; } pre { white-space: pre-wrap; }</style>
+</head>
+<body>
+<h3>ABCT Channel Benchmark</h3>
+<pre id="status">Waiting for the game...</pre>
+<script>
+'use strict';
+const status = document.getElementById('status');
+const now = () => performance.timeOrigin + performance.now();
+const chunks = {};
+const pending = [];
+let port = null;
+let credits = 0;
+let echoed = 0;
+let rx = [];
+
+function flush() {
+  while (port && credits > 0 && pending.length) { credits--; port.postMessage(pending.shift()); }
+}
+
+function sendToGame(obj) {
+  pending.push(JSON.stringify(obj));
+  flush();
+}
+
+function onMessage(raw) {
+  let msg;
+  try { msg = JSON.parse(raw); } catch (e) { return; }
+  if (msg === null || typeof msg !== 'object') return;
+
+  switch (msg.abct) {
+    case 'chunk': {
+      const parts = (chunks[msg.id] ||= []);
+      parts[msg.seq] = msg.data;
+      if (Object.keys(parts).length === msg.of) {
+        delete chunks[msg.id];
+        onMessage(parts.join(''));
+      }
+      return;
+    }
+    case 'credit': credits += msg.grant; flush(); return;
+    case 'slowdown': credits = 0; return;
+    case 'ping': {
+      const t1 = now();
+      sendToGame({abct: 'pong', id: msg.id, t0: msg.t0, t1, t2: now(), rx});
+      rx = [];
+      return;
+    }
+  }
+
+  if (msg._ts && rx.length < 256) rx.push([msg.type || 'untyped', msg._ts, now()]);
+  if (msg.type === 'bench') {
+    sendToGame({_ts: now(), type: 'bench_ack', seq: msg.seq, chars: raw.length});
+    if (++echoed % 256 === 0) status.textContent = 'Echoed ' + echoed + ' messages';
+  }
+}
+
+window.addEventListener('message', (event) => {
+  if (event.ports && event.ports.length && event.ports[0] !== port) {
+    port = event.ports[0];
+    port.onmessage = (portEvent) => onMessage(portEvent.data);
+    status.textContent = 'Channel open';
+    flush();
+  }
+  if (typeof event.data === 'string') onMessage(event.data);
+});
+</script>
+</body>
+</html>
+)ABCT";
+}
+
+namespace ABCTEchoPage
+{
+    FAnsiStringView GetHtml()
+    {
+        return FAnsiStringView(EchoPageHtml, UE_ARRAY_COUNT(EchoPageHtml) - 1);
+    }
+}
@@ -0,0 +1,29 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Bundled echo page for the channel benchmark.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ABCTEchoPage
+ *
+ * The page the channel benchmark opens. It is compiled into the plugin and served by
+ * FABCTMetricsEndpoint at Path, so a benchmark needs no web server or network access.
+ *
+ * The page implements the page side of the channel protocol (chunk reassembly, credits,
+ * ping / pong) and answers every {"type":"bench","seq":N,...} message with
+ *   {"_ts":<page ms>,"type":"bench_ack","seq":N,"chars":<reassembled message length>}
+ * FABCTSimulatedBackend::bEchoPage behaves the same way without a browser.
+ */
+namespace ABCTEchoPage
+{
+    /** Request path the page is served at */
+    const ANSICHAR *const Path = "/abct/echo";
+
+    /** The complete HTML document (UTF-8) */
+    FAnsiStringView GetHtml();
+}
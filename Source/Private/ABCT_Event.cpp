@@ -0,0 +1,38 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Immutable shared event payloads.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Event.h"
+
+FABCTEvent::FABCTEvent(EABCTEventKind InKind, FString &&InName, FString &&InPayload, FString &&InOrigin, FABCTUrlRef &&InUrl, FString &&InSourceUrl)
+    : Kind(InKind), Name(MoveTemp(InName)), Payload(MoveTemp(InPayload)), Origin(MoveTemp(InOrigin)), Url(MoveTemp(InUrl)), SourceUrl(MoveTemp(InSourceUrl)), CreatedCycles(FPlatformTime::Cycles64())
+{
+}
+
+FABCTEventRef FABCTEvent::MakeNavigation(FString EventName, FABCTUrlRef Url, FString URL)
+{
+    return MakeShared<FABCTEvent, ESPMode::ThreadSafe>(EABCTEventKind::Navigation, MoveTemp(EventName), FString(), FString(), MoveTemp(Url), MoveTemp(URL));
+}
+
+FABCTEventRef FABCTEvent::MakeDeepLink(FString Action, FString ParamsJson)
+{
+    return MakeShared<FABCTEvent, ESPMode::ThreadSafe>(EABCTEventKind::DeepLink, MoveTemp(Action), MoveTemp(ParamsJson), FString(), FABCTUrlRef());
+}
+
+FABCTEventRef FABCTEvent::MakePageMessage(FString Message, FString Origin)
+{
+    return MakeShared<FABCTEvent, ESPMode::ThreadSafe>(EABCTEventKind::PageMessage, FString(), MoveTemp(Message), MoveTemp(Origin), FABCTUrlRef());
+}
+
+const FString &FABCTEvent::GetUrlString() const
+{
+    static const FString NoURL;
+    return Url.IsValid() ? Url->GetCanonical() : NoURL;
+}
+
+SIZE_T FABCTEvent::GetAllocatedSize() const
+{
+    return sizeof(FABCTEvent) + Name.GetAllocatedSize() + Payload.GetAllocatedSize() + Origin.GetAllocatedSize() + SourceUrl.GetAllocatedSize();
+}
@@ -0,0 +1,196 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Inbound event path (browser -> game).
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Ingress.h"
+#include "ABCT_Dedup.h"
+#include "ABCT_DeepLinkAuth.h"
+#include "ABCT_DeepLinkLatency.h"
+#include "ABCT_Event.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "Async/Async.h"
+#include "Hash/CityHash.h"
+
+// ============================================================================
+// External Declaration for Global Registry (defined in CPP_ABCT_Base.cpp)
+// ============================================================================
+
+namespace ChromeCustomTabsRegistry
+{
+    extern UCPP_ABCT_Base *GetActiveInstance();
+}
+
+namespace
+{
+    /** Seeds keep deep link and page message key spaces apart */
+    constexpr uint64 DeepLinkKeySeed = 0x4142435444454550ull;
+    constexpr uint64 PageMessageKeySeed = 0x414243544d534750ull;
+
+    FABCTDedupWindow &GetDedupWindow()
+    {
+        static FABCTDedupWindow DedupWindow;
+        return DedupWindow;
+    }
+
+    /**
+     * Looks up the idempotency key in Json (without decoding it) and checks it against the
+     * dedup window. Payloads without a key are never duplicates.
+     */
+    bool IsDuplicate(const FString &Json, FStringView Field, uint64 Seed)
+    {
+        FStringView Key;
+        if (!ABCTJsonScan::FindStringField(Json, Field, Key))
+        {
+            return false;
+        }
+
+        ABCTStats::Increment(EABCTCounter::IdempotencyKeysChecked);
+        const uint64 KeyHash = CityHash64WithSeed((const char *)Key.GetData(), Key.Len() * sizeof(TCHAR), Seed);
+        if (!GetDedupWindow().CheckAndInsert(KeyHash, FPlatformTime::Seconds()))
+        {
+            return false;
+        }
+        ABCTStats::Increment(EABCTCounter::DuplicatesDropped);
+        return true;
+    }
+
+    /**
+     * Hands Func to the game thread and runs it against the active instance.
+     * Tracks queue depth, queued bytes and the receipt -> dispatch latency for every event.
+     */
+    template <typename FuncType>
+    void DispatchToGameThread(const FABCTEventRef &Event, FuncType &&Func)
+    {
+        const int64 QueuedBytes = Event->GetAllocatedSize();
+        ABCTStats::AddGauge(EABCTGauge::IngressQueueDepth, 1);
+        ABCTMemory::Track(EABCTMemoryPool::Queues, QueuedBytes);
+        const uint64 ReceivedCycles = FPlatformTime::Cycles64();
+
+        AsyncTask(ENamedThreads::GameThread, [Func = Forward<FuncType>(Func), ReceivedCycles, QueuedBytes]()
+                  {
+            ABCTStats::AddGauge(EABCTGauge::IngressQueueDepth, -1);
+            ABCTMemory::Track(EABCTMemoryPool::Queues, -QueuedBytes);
+            ABCTStats::RecordCyclesSince(EABCTHistogram::IngressToDispatchMicros, ReceivedCycles);
+
+            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
+            if (Instance)
+            {
+                Func(Instance);
+            }
+            else
+            {
+                ABCTStats::Increment(EABCTCounter::EventsDroppedNoInstance);
+            } });
+    }
+
+    void QueueDeepLink(const FABCTEventRef &Event, FABCTDeepLinkTrace Trace, bool bTraced)
+    {
+        Trace.Stamp(EABCTDeepLinkStamp::Queued);
+        DispatchToGameThread(Event, [Event, Trace, bTraced](UCPP_ABCT_Base *Instance)
+                             {
+            FABCTDeepLinkTrace GameThreadTrace = Trace;
+            GameThreadTrace.Stamp(EABCTDeepLinkStamp::Dequeued);
+            Instance->HandleDeepLink(Event, bTraced ? &GameThreadTrace : nullptr); });
+    }
+}
+
+namespace ABCTIngress
+{
+    FString NavigationEventCodeToName(int32 EventCode)
+    {
+        switch (EventCode)
+        {
+        case 1:
+            return TEXT("NavigationStarted");
+        case 2:
+            return TEXT("NavigationFinished");
+        case 3:
+            return TEXT("NavigationFailed");
+        case 4:
+            return TEXT("NavigationAborted");
+        case 5:
+            return TEXT("TabShown");
+        case 6:
+            return TEXT("TabHidden");
+        default:
+            return FString::Printf(TEXT("Unknown(%d)"), EventCode);
+        }
+    }
+
+    void NavigationEvent(int32 EventCode, const FString &URL)
+    {
+        NamedNavigationEvent(NavigationEventCodeToName(EventCode), URL);
+    }
+
+    void NamedNavigationEvent(const FString &EventName, const FString &URL)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Queues);
+        ABCTStats::Increment(EABCTCounter::NavigationEventsReceived);
+
+        // Canonicalized once here; the event, state and logs share the interned entry
+        FABCTEventRef Event = FABCTEvent::MakeNavigation(EventName, ABCTUrlTable::Intern(URL), URL);
+        DispatchToGameThread(Event, [Event](UCPP_ABCT_Base *Instance)
+                             { Instance->HandleNavigationEvent(Event); });
+    }
+
+    void DeepLink(const FString &Action, const FString &ParamsJson)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Queues);
+        ABCTStats::Increment(EABCTCounter::DeepLinksReceived);
+
+        // Tracing is the last thing shed when the plugin is over its memory budget
+        const bool bTraced = ABCTMemory::IsTracingEnabled();
+        FABCTDeepLinkTrace Trace = bTraced ? ABCTDeepLinkLatency::Begin(ParamsJson) : FABCTDeepLinkTrace();
+        if (ABCTDeepLinkAuth::IsEnabled())
+        {
+            // Verified on the worker, which releases links in arrival order. The key only enters the
+            // dedup window once the link is accepted, so a forged link cannot use up a genuine link's key.
+            FABCTEventRef Event = FABCTEvent::MakeDeepLink(Action, ParamsJson);
+            ABCTDeepLinkAuth::Submit(Event, [Event, Trace, bTraced]()
+                                     {
+                if (!IsDuplicate(Event->GetPayload(), TEXTVIEW("_idk"), DeepLinkKeySeed))
+                {
+                    QueueDeepLink(Event, Trace, bTraced);
+                } });
+            return;
+        }
+        if (IsDuplicate(ParamsJson, TEXTVIEW("_idk"), DeepLinkKeySeed))
+        {
+            return;
+        }
+
+        // Copied once into the shared payload; every listener reads the same strings
+        QueueDeepLink(FABCTEvent::MakeDeepLink(Action, ParamsJson), Trace, bTraced);
+    }
+
+    void PageMessage(const FString &Message, const FString &Origin)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Queues);
+        ABCTStats::Increment(EABCTCounter::PostMessagesReceived);
+        if (IsDuplicate(Message, TEXTVIEW("idk"), PageMessageKeySeed))
+        {
+            // The page still spent a credit on it
+            FABCTMessageChannel::Get().ConsumeInboundCredit();
+            return;
+        }
+
+        // Page messages go through the flow-controlled channel queue instead of one task each
+        FABCTMessageChannel::Get().EnqueueInbound(Message, Origin);
+    }
+
+    void SetIdempotencyWindowSeconds(double WindowSeconds)
+    {
+        GetDedupWindow().SetWindowSeconds(WindowSeconds);
+    }
+
+    void ResetIdempotencyWindow()
+    {
+        GetDedupWindow().Reset();
+    }
+}
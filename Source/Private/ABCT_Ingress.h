@@ -0,0 +1,53 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Inbound event path (browser -> game).
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ABCTIngress
+ *
+ * Single entry point for everything the browser sends to the game. The JNI callbacks and
+ * FABCTSimulatedBackend both call these, so every backend exercises the same queueing,
+ * stats and dispatch code. Safe to call from any thread; delivery happens on the game thread.
+ */
+namespace ABCTIngress
+{
+    /**
+     * Converts a CustomTabsCallback navigation event code to its event name.
+     *
+     * @param EventCode - CustomTabsCallback.NAVIGATION_* / TAB_* constant
+     * @return Event name (e.g. "NavigationStarted"), or "Unknown(<code>)"
+     */
+    FString NavigationEventCodeToName(int32 EventCode);
+
+    /** Queues a navigation event identified by its CustomTabsCallback code */
+    void NavigationEvent(int32 EventCode, const FString &URL);
+
+    /** Queues a navigation event by name (TabOpened, TabClosed, MessageChannelReady, ...) */
+    void NamedNavigationEvent(const FString &EventName, const FString &URL);
+
+    /**
+     * Queues a deep link. Links whose params carry an "_idk" idempotency key already seen
+     * within the dedup window are dropped (e.g. replayed on back-navigation). Each link is
+     * traced through the pipeline stages (see ABCTDeepLinkLatency). With a signing key set,
+     * links pass the verification worker first (see ABCTDeepLinkAuth).
+     */
+    void DeepLink(const FString &Action, const FString &ParamsJson);
+
+    /**
+     * Queues a PostMessage received from the page. Messages with a top-level "idk" idempotency
+     * key already seen within the dedup window are dropped (e.g. re-sent after a reload).
+     */
+    void PageMessage(const FString &Message, const FString &Origin);
+
+    /** How long idempotency keys are remembered; keys live for between half and all of it */
+    void SetIdempotencyWindowSeconds(double WindowSeconds);
+
+    /** Forgets every idempotency key seen so far */
+    void ResetIdempotencyWindow();
+}
@@ -0,0 +1,125 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Allocation-free scanning of top-level JSON fields.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_JsonScan.h"
+
+namespace
+{
+    /** Returns the index of the first character of Field's value in Json, or INDEX_NONE */
+    int32 FindFieldValue(FStringView Json, FStringView Field)
+    {
+        const int32 Length = Json.Len();
+        int32 Depth = 0;
+        bool bInString = false;
+        int32 StringStart = 0;
+
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            const TCHAR Char = Json[Index];
+            if (bInString)
+            {
+                if (Char == TEXT('\\'))
+                {
+                    ++Index;
+                    continue;
+                }
+                if (Char != TEXT('"'))
+                {
+                    continue;
+                }
+                bInString = false;
+
+                // Only a top-level key followed by ':' counts
+                if (Depth != 1 || Json.Mid(StringStart, Index - StringStart) != Field)
+                {
+                    continue;
+                }
+                int32 Cursor = Index + 1;
+                while (Cursor < Length && FChar::IsWhitespace(Json[Cursor]))
+                {
+                    ++Cursor;
+                }
+                if (Cursor >= Length || Json[Cursor] != TEXT(':'))
+                {
+                    continue;
+                }
+                ++Cursor;
+                while (Cursor < Length && FChar::IsWhitespace(Json[Cursor]))
+                {
+                    ++Cursor;
+                }
+                return Cursor < Length ? Cursor : INDEX_NONE;
+            }
+
+            if (Char == TEXT('"'))
+            {
+                bInString = true;
+                StringStart = Index + 1;
+            }
+            else if (Char == TEXT('{') || Char == TEXT('['))
+            {
+                ++Depth;
+            }
+            else if (Char == TEXT('}') || Char == TEXT(']'))
+            {
+                --Depth;
+            }
+        }
+        return INDEX_NONE;
+    }
+}
+
+namespace ABCTJsonScan
+{
+    bool FindStringField(FStringView Json, FStringView Field, FStringView &OutValue)
+    {
+        int32 Cursor = FindFieldValue(Json, Field);
+        if (Cursor == INDEX_NONE || Json[Cursor] != TEXT('"'))
+        {
+            return false;
+        }
+        const int32 ValueStart = ++Cursor;
+        while (Cursor < Json.Len() && Json[Cursor] != TEXT('"'))
+        {
+            Cursor += Json[Cursor] == TEXT('\\') ? 2 : 1;
+        }
+        if (Cursor >= Json.Len() || Cursor == ValueStart)
+        {
+            return false;
+        }
+        OutValue = Json.Mid(ValueStart, Cursor - ValueStart);
+        return true;
+    }
+
+    bool FindNumberField(FStringView Json, FStringView Field, double &OutValue)
+    {
+        const int32 ValueStart = FindFieldValue(Json, Field);
+        if (ValueStart == INDEX_NONE)
+        {
+            return false;
+        }
+
+        // Copy the token into a small buffer so the parser sees a terminated string
+        TCHAR Buffer[64];
+        int32 Length = 0;
+        for (int32 Cursor = ValueStart; Cursor < Json.Len() && Length < UE_ARRAY_COUNT(Buffer) - 1; ++Cursor)
+        {
+            const TCHAR Char = Json[Cursor];
+            if (!FChar::IsDigit(Char) && Char != TEXT('-') && Char != TEXT('.'))
+            {
+                break;
+            }
+            Buffer[Length++] = Char;
+        }
+        Buffer[Length] = TEXT('\0');
+        if (Length == 0 || !FCString::IsNumeric(Buffer))
+        {
+            return false;
+        }
+        OutValue = FCString::Atod(Buffer);
+        return true;
+    }
+}
@@ -0,0 +1,41 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Allocation-free scanning of top-level JSON fields.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ABCTJsonScan
+ *
+ * Reads single top-level fields of a JSON object without decoding the document, for hot
+ * paths that only need one or two fields (idempotency keys, timestamps, message type).
+ * Nested objects and arrays are skipped; malformed input simply yields "not found".
+ */
+namespace ABCTJsonScan
+{
+    /**
+     * Finds a top-level string field, e.g. "idk" in {"idk":"a1b2","type":"buy"}.
+     * Escape sequences are left as-is.
+     *
+     * @param Json - Raw JSON text
+     * @param Field - Field name, without quotes
+     * @param OutValue - View into Json of the field value
+     * @return true if the field was found with a non-empty string value
+     */
+    bool FindStringField(FStringView Json, FStringView Field, FStringView &OutValue);
+
+    /**
+     * Finds a top-level number field, e.g. "_ts" in {"_ts":1718000000123.5,"type":"state"}.
+     * Plain decimal notation only (no exponent), which is what JSON.stringify gives timestamps.
+     *
+     * @param Json - Raw JSON text
+     * @param Field - Field name, without quotes
+     * @param OutValue - Parsed value
+     * @return true if the field was found with a numeric value
+     */
+    bool FindNumberField(FStringView Json, FStringView Field, double &OutValue);
+}
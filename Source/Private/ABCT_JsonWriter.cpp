@@ -0,0 +1,292 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Streaming JSON writer for outbound messages.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_JsonWriter.h"
+
+namespace
+{
+    /** Writes Number in decimal into the end of Buffer and returns the first character */
+    TCHAR *FormatUnsigned(uint64 Number, TCHAR *BufferEnd)
+    {
+        TCHAR *Cursor = BufferEnd;
+        do
+        {
+            *--Cursor = TCHAR('0' + (Number % 10));
+            Number /= 10;
+        } while (Number != 0);
+        return Cursor;
+    }
+
+    bool NeedsEscape(TCHAR Char)
+    {
+        return Char < 0x20 || Char == TEXT('"') || Char == TEXT('\\');
+    }
+}
+
+FABCTJsonWriter::FABCTJsonWriter(FString &InOut)
+    : Out(InOut), ObjectBits(0), NonEmptyBits(0), Depth(0), bAfterKey(false), bWroteRoot(false)
+{
+}
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+void FABCTJsonWriter::BeforeValue()
+{
+    if (bAfterKey)
+    {
+        bAfterKey = false;
+        return;
+    }
+    if (Depth == 0)
+    {
+        checkf(!bWroteRoot, TEXT("FABCTJsonWriter - only one top-level value may be written"));
+        bWroteRoot = true;
+        return;
+    }
+
+    const uint64 Bit = 1ull << (Depth - 1);
+    checkf((ObjectBits & Bit) == 0, TEXT("FABCTJsonWriter - object members need a Key() first"));
+    if (NonEmptyBits & Bit)
+    {
+        Out.AppendChar(TEXT(','));
+    }
+    NonEmptyBits |= Bit;
+}
+
+void FABCTJsonWriter::Push(bool bObject)
+{
+    BeforeValue();
+    checkf(Depth < MaxDepth, TEXT("FABCTJsonWriter - nesting deeper than %d"), MaxDepth);
+
+    const uint64 Bit = 1ull << Depth;
+    ObjectBits = bObject ? (ObjectBits | Bit) : (ObjectBits & ~Bit);
+    NonEmptyBits &= ~Bit;
+    ++Depth;
+    Out.AppendChar(bObject ? TEXT('{') : TEXT('['));
+}
+
+void FABCTJsonWriter::Pop(bool bObject)
+{
+    checkf(Depth > 0 && !bAfterKey, TEXT("FABCTJsonWriter - unbalanced End call"));
+    checkf(((ObjectBits >> (Depth - 1)) & 1) == (bObject ? 1u : 0u), TEXT("FABCTJsonWriter - End call does not match the open container"));
+    --Depth;
+    Out.AppendChar(bObject ? TEXT('}') : TEXT(']'));
+}
+
+void FABCTJsonWriter::BeginObject()
+{
+    Push(true);
+}
+
+void FABCTJsonWriter::EndObject()
+{
+    Pop(true);
+}
+
+void FABCTJsonWriter::BeginArray()
+{
+    Push(false);
+}
+
+void FABCTJsonWriter::EndArray()
+{
+    Pop(false);
+}
+
+void FABCTJsonWriter::BeforeKey()
+{
+    checkf(Depth > 0 && !bAfterKey, TEXT("FABCTJsonWriter - Key() outside of an object"));
+    const uint64 Bit = 1ull << (Depth - 1);
+    checkf((ObjectBits & Bit) != 0, TEXT("FABCTJsonWriter - Key() inside an array"));
+    if (NonEmptyBits & Bit)
+    {
+        Out.AppendChar(TEXT(','));
+    }
+    NonEmptyBits |= Bit;
+    bAfterKey = true;
+}
+
+void FABCTJsonWriter::Key(FStringView Name)
+{
+    BeforeKey();
+    Out.AppendChar(TEXT('"'));
+    AppendEscaped(Out, Name);
+    Out.Append(TEXT("\":"), 2);
+}
+
+void FABCTJsonWriter::PreEncodedKey(FStringView EncodedKey)
+{
+    BeforeKey();
+    Out.Append(EncodedKey.GetData(), EncodedKey.Len());
+}
+
+FString FABCTJsonWriter::EncodeKey(FStringView Name)
+{
+    FString Encoded;
+    Encoded.Reserve(Name.Len() + 3);
+    Encoded.AppendChar(TEXT('"'));
+    AppendEscaped(Encoded, Name);
+    Encoded.Append(TEXT("\":"), 2);
+    return Encoded;
+}
+
+// ============================================================================
+// Values
+// ============================================================================
+
+void FABCTJsonWriter::Value(FStringView String)
+{
+    BeforeValue();
+    Out.AppendChar(TEXT('"'));
+    AppendEscaped(Out, String);
+    Out.AppendChar(TEXT('"'));
+}
+
+void FABCTJsonWriter::Value(bool bValue)
+{
+    BeforeValue();
+    if (bValue)
+    {
+        Out.Append(TEXT("true"), 4);
+    }
+    else
+    {
+        Out.Append(TEXT("false"), 5);
+    }
+}
+
+void FABCTJsonWriter::Value(int64 Number)
+{
+    BeforeValue();
+    TCHAR Buffer[24];
+    TCHAR *const BufferEnd = Buffer + UE_ARRAY_COUNT(Buffer);
+    // Negate as unsigned so INT64_MIN does not overflow
+    TCHAR *First = FormatUnsigned(Number < 0 ? 0ull - (uint64)Number : (uint64)Number, BufferEnd);
+    if (Number < 0)
+    {
+        *--First = TEXT('-');
+    }
+    Out.Append(First, (int32)(BufferEnd - First));
+}
+
+void FABCTJsonWriter::Value(uint64 Number)
+{
+    BeforeValue();
+    TCHAR Buffer[24];
+    TCHAR *const BufferEnd = Buffer + UE_ARRAY_COUNT(Buffer);
+    TCHAR *First = FormatUnsigned(Number, BufferEnd);
+    Out.Append(First, (int32)(BufferEnd - First));
+}
+
+void FABCTJsonWriter::Value(double Number)
+{
+    if (!FMath::IsFinite(Number))
+    {
+        Null();
+        return;
+    }
+
+    // Whole numbers are common in state messages and much cheaper to format as integers
+    if (Number == FMath::RoundToDouble(Number) && FMath::Abs(Number) < 9007199254740992.0)
+    {
+        Value((int64)Number);
+        return;
+    }
+
+    BeforeValue();
+    TCHAR Buffer[40];
+    const int32 Length = FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("%.17g"), Number);
+    Out.Append(Buffer, FMath::Clamp(Length, 0, (int32)UE_ARRAY_COUNT(Buffer) - 1));
+}
+
+void FABCTJsonWriter::Null()
+{
+    BeforeValue();
+    Out.Append(TEXT("null"), 4);
+}
+
+void FABCTJsonWriter::RawValue(FStringView Json)
+{
+    BeforeValue();
+    Out.Append(Json.GetData(), Json.Len());
+}
+
+void FABCTJsonWriter::Base64Value(TConstArrayView<uint8> Bytes)
+{
+    static const TCHAR Alphabet[] = TEXT("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+
+    BeforeValue();
+    const int32 Count = Bytes.Num();
+    Out.Reserve(Out.Len() + (Count + 2) / 3 * 4 + 2);
+    Out.AppendChar(TEXT('"'));
+
+    const uint8 *Data = Bytes.GetData();
+    int32 Index = 0;
+    for (; Index + 3 <= Count; Index += 3)
+    {
+        const uint32 Triple = ((uint32)Data[Index] << 16) | ((uint32)Data[Index + 1] << 8) | Data[Index + 2];
+        const TCHAR Quad[] = {Alphabet[(Triple >> 18) & 63], Alphabet[(Triple >> 12) & 63], Alphabet[(Triple >> 6) & 63], Alphabet[Triple & 63]};
+        Out.Append(Quad, 4);
+    }
+    if (Index < Count)
+    {
+        const bool bTwo = Index + 1 < Count;
+        const uint32 Triple = ((uint32)Data[Index] << 16) | (bTwo ? (uint32)Data[Index + 1] << 8 : 0u);
+        const TCHAR Quad[] = {Alphabet[(Triple >> 18) & 63], Alphabet[(Triple >> 12) & 63], bTwo ? Alphabet[(Triple >> 6) & 63] : TEXT('='), TEXT('=')};
+        Out.Append(Quad, 4);
+    }
+    Out.AppendChar(TEXT('"'));
+}
+
+// ============================================================================
+// Escaping
+// ============================================================================
+
+void FABCTJsonWriter::AppendEscaped(FString &Out, FStringView Source)
+{
+    static const TCHAR HexDigits[] = TEXT("0123456789abcdef");
+
+    const TCHAR *Run = Source.GetData();
+    const TCHAR *const End = Run + Source.Len();
+    for (const TCHAR *Cursor = Run; Cursor < End; ++Cursor)
+    {
+        const TCHAR Char = *Cursor;
+        if (!NeedsEscape(Char))
+        {
+            continue;
+        }
+
+        Out.Append(Run, (int32)(Cursor - Run));
+        Run = Cursor + 1;
+        switch (Char)
+        {
+        case TEXT('"'):
+            Out.Append(TEXT("\\\""), 2);
+            break;
+        case TEXT('\\'):
+            Out.Append(TEXT("\\\\"), 2);
+            break;
+        case TEXT('\n'):
+            Out.Append(TEXT("\\n"), 2);
+            break;
+        case TEXT('\r'):
+            Out.Append(TEXT("\\r"), 2);
+            break;
+        case TEXT('\t'):
+            Out.Append(TEXT("\\t"), 2);
+            break;
+        default:
+        {
+            const TCHAR Escape[] = {TEXT('\\'), TEXT('u'), TEXT('0'), TEXT('0'), HexDigits[(Char >> 4) & 0xF], HexDigits[Char & 0xF]};
+            Out.Append(Escape, UE_ARRAY_COUNT(Escape));
+            break;
+        }
+        }
+    }
+    Out.Append(Run, (int32)(End - Run));
+}
@@ -0,0 +1,135 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Memory tagging and budget.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_Stats.h"
+#include "ABCT_UrlTable.h"
+#include <atomic>
+
+LLM_DEFINE_TAG(ABCT, TEXT("ABCT"));
+LLM_DEFINE_TAG(ABCT_Queues, TEXT("Queues"), TEXT("ABCT"));
+LLM_DEFINE_TAG(ABCT_Parsing, TEXT("Parsing"), TEXT("ABCT"));
+LLM_DEFINE_TAG(ABCT_Messaging, TEXT("Messaging"), TEXT("ABCT"));
+LLM_DEFINE_TAG(ABCT_Caches, TEXT("Caches"), TEXT("ABCT"));
+
+namespace
+{
+    const EABCTGauge PoolGauges[] = {
+        EABCTGauge::MemoryQueuesBytes,
+        EABCTGauge::MemoryMessagingBytes,
+        EABCTGauge::MemoryCachesBytes,
+    };
+    static_assert(UE_ARRAY_COUNT(PoolGauges) == (int32)EABCTMemoryPool::Count, "PoolGauges out of sync with EABCTMemoryPool");
+
+    const TCHAR *const ShedStepDescriptions[] = {
+        TEXT("within budget"),
+        TEXT("dropping bulk messages"),
+        TEXT("shrinking caches"),
+        TEXT("disabling tracing"),
+    };
+
+    std::atomic<int64> BudgetBytes{ABCTMemory::DefaultBudgetBytes};
+    std::atomic<uint8> ShedLevel{(uint8)EABCTShedLevel::None};
+
+    void SetShedLevel(EABCTShedLevel Level)
+    {
+        ShedLevel.store((uint8)Level, std::memory_order_relaxed);
+        ABCTStats::SetGauge(EABCTGauge::MemoryShedLevel, (int64)Level);
+    }
+}
+
+namespace ABCTMemory
+{
+    void Track(EABCTMemoryPool Pool, int64 DeltaBytes)
+    {
+        ABCTStats::AddGauge(PoolGauges[(int32)Pool], DeltaBytes);
+    }
+
+    int64 GetTrackedBytes(EABCTMemoryPool Pool)
+    {
+        return ABCTStats::GetGauge(PoolGauges[(int32)Pool]);
+    }
+
+    int64 GetTotalBytes()
+    {
+        int64 Total = 0;
+        for (int32 Pool = 0; Pool < (int32)EABCTMemoryPool::Count; ++Pool)
+        {
+            Total += GetTrackedBytes((EABCTMemoryPool)Pool);
+        }
+        return Total;
+    }
+
+    void SetBudgetBytes(int64 InBudgetBytes)
+    {
+        BudgetBytes.store(InBudgetBytes, std::memory_order_relaxed);
+        ABCTStats::SetGauge(EABCTGauge::MemoryBudgetBytes, InBudgetBytes);
+    }
+
+    int64 GetBudgetBytes()
+    {
+        return BudgetBytes.load(std::memory_order_relaxed);
+    }
+
+    EABCTShedLevel GetShedLevel()
+    {
+        return (EABCTShedLevel)ShedLevel.load(std::memory_order_relaxed);
+    }
+
+    bool IsTracingEnabled()
+    {
+        return GetShedLevel() < EABCTShedLevel::DisableTracing;
+    }
+
+    void Update()
+    {
+        check(IsInGameThread());
+
+        const int64 Budget = GetBudgetBytes();
+        const int64 Total = GetTotalBytes();
+        const EABCTShedLevel Level = GetShedLevel();
+        ABCTStats::SetGauge(EABCTGauge::MemoryBudgetBytes, FMath::Max<int64>(Budget, 0));
+
+        if (Budget <= 0 || Total <= (int64)(Budget * RecoverFraction))
+        {
+            if (Level != EABCTShedLevel::None)
+            {
+                UE_LOG(LogTemp, Log, TEXT("ABCTMemory - Back within budget (%lld of %lld bytes), shedding undone"), Total, Budget);
+                SetShedLevel(EABCTShedLevel::None);
+            }
+            return;
+        }
+        if (Total <= Budget || Level == EABCTShedLevel::DisableTracing)
+        {
+            return;
+        }
+
+        const EABCTShedLevel Next = (EABCTShedLevel)((uint8)Level + 1);
+        UE_LOG(LogTemp, Warning, TEXT("ABCTMemory - Over budget (%lld of %lld bytes), %s"), Total, Budget, ShedStepDescriptions[(int32)Next]);
+        ABCTStats::Increment(EABCTCounter::MemoryShedSteps);
+        SetShedLevel(Next);
+
+        switch (Next)
+        {
+        case EABCTShedLevel::DropBulk:
+            FABCTMessageChannel::Get().DropQueued(EABCTMessageLane::Bulk);
+            break;
+        case EABCTShedLevel::ShrinkCaches:
+            FABCTMessageChannel::Get().TrimBuffers();
+            ABCTUrlTable::Trim(ShrunkUrlEntries);
+            break;
+        default:
+            // Tracing checks IsTracingEnabled where it records
+            break;
+        }
+    }
+
+    void ResetShedding()
+    {
+        SetShedLevel(EABCTShedLevel::None);
+    }
+}
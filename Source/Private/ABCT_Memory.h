@@ -0,0 +1,105 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Memory tagging and budget.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// ============================================================================
+// Low-Level Memory Tracker Tags
+// ============================================================================
+//
+// Everything the plugin allocates on its own behalf is scoped to ABCT or one of its children:
+//   ABCT/Queues    - ingress tasks, strings from the JNI bridge, the inbound page message
+//                    queue, tab jobs and the timer wheel
+//   ABCT/Parsing   - JSON DOMs built to decode deep links, batches and protocol messages,
+//                    deep link trace params
+//   ABCT/Messaging - outbound lanes, frames and struct payloads
+//   ABCT/Caches    - URL table, payload buffer pool, struct reflection plans, deep link
+//                    dedup windows and prefetch bookkeeping
+//   ABCT           - debug log lines and labelled stats
+// Game handlers called from the plugin (Blueprint events, delegates) run outside these scopes.
+// Inspect with -llm and "stat LLMFULL" or LLM CSV captures.
+
+LLM_DECLARE_TAG(ABCT);
+LLM_DECLARE_TAG(ABCT_Queues);
+LLM_DECLARE_TAG(ABCT_Parsing);
+LLM_DECLARE_TAG(ABCT_Messaging);
+LLM_DECLARE_TAG(ABCT_Caches);
+
+/**
+ * Long-lived plugin memory counted against the budget. LLM is not available in shipping
+ * builds, so the holders report their bytes here themselves. Transient parse DOMs are only
+ * tagged, not counted.
+ */
+enum class EABCTMemoryPool : uint8
+{
+    Queues,
+    Messaging,
+    Caches,
+
+    Count
+};
+
+/**
+ * Load shedding steps, taken in order while the plugin stays over its memory budget.
+ */
+enum class EABCTShedLevel : uint8
+{
+    /** Within budget */
+    None,
+    /** Queued Bulk lane messages are dropped and new ones refused */
+    DropBulk,
+    /** The payload buffer pool is freed and the URL table cut to ShrunkUrlEntries */
+    ShrinkCaches,
+    /** Deep link traces, frame timestamps and clock sync pings stop */
+    DisableTracing,
+};
+
+/**
+ * ABCTMemory
+ *
+ * Byte accounting per pool (exported as abct_memory_<pool>_bytes gauges) and the budget
+ * controller. Update runs once per plugin tick: while the tracked total is over the budget
+ * it takes the next shedding step, one per tick so each step can take effect before the
+ * next; once the total falls to RecoverFraction of the budget every step is undone.
+ */
+namespace ABCTMemory
+{
+    /** Default budget for the tracked pools */
+    constexpr int64 DefaultBudgetBytes = 16 * 1024 * 1024;
+
+    /** Fraction of the budget the total must fall to before shedding is undone */
+    constexpr double RecoverFraction = 0.75;
+
+    /** URL table entries kept by the ShrinkCaches step */
+    constexpr int32 ShrunkUrlEntries = 256;
+
+    /** Adds DeltaBytes to Pool (negative to release). Any thread. */
+    void Track(EABCTMemoryPool Pool, int64 DeltaBytes);
+
+    int64 GetTrackedBytes(EABCTMemoryPool Pool);
+
+    /** Sum of every pool */
+    int64 GetTotalBytes();
+
+    /** Sets the budget for the tracked total; 0 or less disables it */
+    void SetBudgetBytes(int64 BudgetBytes);
+    int64 GetBudgetBytes();
+
+    /** Current shedding step. Any thread. */
+    EABCTShedLevel GetShedLevel();
+
+    /** false once shedding reached DisableTracing. Any thread. */
+    bool IsTracingEnabled();
+
+    /** Compares the total with the budget and sheds or recovers one step. Game thread only. */
+    void Update();
+
+    /** Undoes every shedding step (tests) */
+    void ResetShedding();
+}
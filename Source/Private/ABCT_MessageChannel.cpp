@@ -0,0 +1,563 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel scheduling.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_MessageChannel.h"
+#include "ABCT_Backend.h"
+#include "ABCT_Event.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+#include "ABCT_TimerWheel.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_JsonWriter.h"
+#include "CPP_ABCT_Base.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if PLATFORM_ANDROID
+#include "Android/ABCT_JavaBridge.h"
+#endif
+
+// ============================================================================
+// External Declaration for Global Registry (defined in CPP_ABCT_Base.cpp)
+// ============================================================================
+
+namespace ChromeCustomTabsRegistry
+{
+    extern UCPP_ABCT_Base *GetActiveInstance();
+}
+
+namespace
+{
+    const EABCTHistogram LaneQueueHistograms[] = {
+        EABCTHistogram::OutboundControlQueueMicros,
+        EABCTHistogram::OutboundInteractiveQueueMicros,
+        EABCTHistogram::OutboundBulkQueueMicros,
+    };
+    static_assert(UE_ARRAY_COUNT(LaneQueueHistograms) == (int32)EABCTMessageLane::Count, "LaneQueueHistograms out of sync with EABCTMessageLane");
+
+    /** Prefix of plugin protocol messages in both directions */
+    const TCHAR *const ControlPrefix = TEXT("{\"abct\":");
+
+    void RecordLatencyMillis(EABCTLatencyDirection Direction, FStringView MessageType, double LatencyMillis)
+    {
+        ABCTStats::RecordOneWayLatency(Direction, MessageType, (uint64)FMath::Max(0.0, LatencyMillis * 1000.0));
+    }
+}
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+FABCTMessageChannel &FABCTMessageChannel::Get()
+{
+    static FABCTMessageChannel Instance;
+    return Instance;
+}
+
+FABCTMessageChannel::FABCTMessageChannel()
+    : InboundQueued(0), InboundQueuedChars(0), OutstandingCredits(0), bSlowdownPending(false), NextPingId(1), NextMessageId(1), bReady(false)
+{
+}
+
+FABCTMessageChannel::~FABCTMessageChannel()
+{
+    Shutdown();
+}
+
+void FABCTMessageChannel::Shutdown()
+{
+    ABCTTimers::ClearTimer(PingTimer);
+    Reset();
+}
+
+// ============================================================================
+// Outbound
+// ============================================================================
+
+void FABCTMessageChannel::Send(EABCTMessageLane Lane, FString Message)
+{
+    check(IsInGameThread());
+    check(Lane < EABCTMessageLane::Count);
+    LLM_SCOPE_BYTAG(ABCT_Messaging);
+
+    if (Lane == EABCTMessageLane::Bulk && ABCTMemory::GetShedLevel() >= EABCTShedLevel::DropBulk)
+    {
+        ABCTStats::Increment(EABCTCounter::OutboundMessagesDropped);
+        return;
+    }
+
+    FOutboundMessage Outbound;
+    Outbound.ChunkCount = FMath::Max(1, FMath::DivideAndRoundUp(Message.Len(), Config.ChunkSizeChars));
+    Outbound.Payload = MoveTemp(Message);
+    Outbound.EnqueueCycles = FPlatformTime::Cycles64();
+    Outbound.MessageId = NextMessageId++;
+    Outbound.TrackedBytes = Outbound.Payload.GetAllocatedSize();
+    ABCTMemory::Track(EABCTMemoryPool::Messaging, Outbound.TrackedBytes);
+    Lanes[(int32)Lane].Queue.Add(MoveTemp(Outbound));
+
+    ABCTStats::Increment(EABCTCounter::OutboundMessagesQueued);
+    ABCTStats::AddGauge(EABCTGauge::OutboundQueuedMessages, 1);
+}
+
+FString FABCTMessageChannel::AcquirePayloadBuffer(int32 ReserveChars)
+{
+    check(IsInGameThread());
+
+    FString Buffer;
+    if (PayloadPool.Num() > 0)
+    {
+        Buffer = PayloadPool.Pop(EAllowShrinking::No);
+        ABCTMemory::Track(EABCTMemoryPool::Caches, -(int64)Buffer.GetAllocatedSize());
+        ABCTStats::Increment(EABCTCounter::OutboundPayloadBuffersReused);
+    }
+    // Grows a pooled buffer only if it is too small
+    Buffer.Reset(ReserveChars);
+    return Buffer;
+}
+
+void FABCTMessageChannel::ReleasePayloadBuffer(FString &&Buffer)
+{
+    check(IsInGameThread());
+
+    const int32 CapacityChars = Buffer.GetCharArray().Max();
+    if (CapacityChars == 0 || CapacityChars > Config.MaxPooledPayloadChars || PayloadPool.Num() >= Config.PayloadPoolSize)
+    {
+        return;
+    }
+    if (PayloadPool.Max() < Config.PayloadPoolSize)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Caches);
+        PayloadPool.Reserve(Config.PayloadPoolSize);
+    }
+    Buffer.Reset();
+    ABCTMemory::Track(EABCTMemoryPool::Caches, Buffer.GetAllocatedSize());
+    PayloadPool.Add(MoveTemp(Buffer));
+}
+
+void FABCTMessageChannel::SetReady(bool bInReady)
+{
+    bReady = bInReady;
+
+    // A new page may run on a different clock
+    ClockSync.Reset();
+    ABCTTimers::ClearTimer(PingTimer);
+
+    if (!bReady)
+    {
+        // Frames cannot reach a page that is gone; the next page starts from a clean channel
+        Reset();
+        return;
+    }
+
+    // A fresh page holds no credits; advertise the full receive window
+    OutstandingCredits = 0;
+    bSlowdownPending = false;
+    UpdateCredits(true);
+    StartPingTimer();
+}
+
+void FABCTMessageChannel::SetOutboundConfig(const FABCTOutboundConfig &InConfig)
+{
+    const bool bPingIntervalChanged = InConfig.PingIntervalSeconds != Config.PingIntervalSeconds;
+    Config = InConfig;
+    if (bPingIntervalChanged && bReady)
+    {
+        StartPingTimer();
+    }
+}
+
+void FABCTMessageChannel::Reset()
+{
+    ResetInbound();
+
+    for (FLane &Lane : Lanes)
+    {
+        const int32 Dropped = Lane.Queue.Num();
+        for (const FOutboundMessage &Message : Lane.Queue)
+        {
+            ABCTMemory::Track(EABCTMemoryPool::Messaging, -Message.TrackedBytes);
+        }
+        ABCTStats::Increment(EABCTCounter::OutboundMessagesDropped, Dropped);
+        ABCTStats::AddGauge(EABCTGauge::OutboundQueuedMessages, -Dropped);
+        Lane.Queue.Empty();
+        Lane.Deficit = 0;
+    }
+}
+
+void FABCTMessageChannel::DropQueued(EABCTMessageLane Lane)
+{
+    check(IsInGameThread());
+
+    // The page already holds the first chunks of a partly sent message; finish it
+    TRingBuffer<FOutboundMessage> &Queue = Lanes[(int32)Lane].Queue;
+    const int32 Keep = !Queue.IsEmpty() && Queue.First().ChunkIndex > 0 ? 1 : 0;
+    const int32 Dropped = Queue.Num() - Keep;
+    while (Queue.Num() > Keep)
+    {
+        ABCTMemory::Track(EABCTMemoryPool::Messaging, -Queue.Last().TrackedBytes);
+        Queue.PopBack();
+    }
+    ABCTStats::Increment(EABCTCounter::OutboundMessagesDropped, Dropped);
+    ABCTStats::AddGauge(EABCTGauge::OutboundQueuedMessages, -Dropped);
+}
+
+void FABCTMessageChannel::TrimBuffers()
+{
+    check(IsInGameThread());
+
+    for (const FString &Buffer : PayloadPool)
+    {
+        ABCTMemory::Track(EABCTMemoryPool::Caches, -(int64)Buffer.GetAllocatedSize());
+    }
+    PayloadPool.Empty();
+    FrameBuffer.Empty();
+}
+
+void FABCTMessageChannel::Pump()
+{
+    DrainInbound();
+    if (bReady)
+    {
+        LLM_SCOPE_BYTAG(ABCT_Messaging);
+        UpdateCredits(false);
+        PumpOutbound();
+    }
+}
+
+// ============================================================================
+// Inbound
+// ============================================================================
+
+void FABCTMessageChannel::ConsumeInboundCredit()
+{
+    // Every message spends one of the page's credits (pages without flow control hold none)
+    if (OutstandingCredits.fetch_sub(1, std::memory_order_relaxed) <= 0)
+    {
+        OutstandingCredits.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool FABCTMessageChannel::EnqueueInbound(FString Message, FString Origin)
+{
+    LLM_SCOPE_BYTAG(ABCT_Queues);
+    ConsumeInboundCredit();
+
+    const int32 MessageChars = Message.Len();
+    if (InboundQueued.load(std::memory_order_relaxed) >= InboundConfig.ReceiveWindow ||
+        InboundQueuedChars.load(std::memory_order_relaxed) + MessageChars > InboundConfig.MaxQueuedChars)
+    {
+        // Over the window: drop instead of growing, and ask the page to back off
+        ABCTStats::Increment(EABCTCounter::InboundMessagesDropped);
+        bSlowdownPending = true;
+        return false;
+    }
+
+    InboundQueued.fetch_add(1, std::memory_order_relaxed);
+    InboundQueuedChars.fetch_add(MessageChars, std::memory_order_relaxed);
+    ABCTStats::AddGauge(EABCTGauge::InboundQueuedMessages, 1);
+
+    FInboundMessage Inbound;
+    Inbound.Message = MoveTemp(Message);
+    Inbound.Origin = MoveTemp(Origin);
+    Inbound.ReceivedCycles = FPlatformTime::Cycles64();
+    Inbound.ReceivedMillis = ABCTClock::NowMillis();
+    Inbound.TrackedBytes = Inbound.Message.GetAllocatedSize() + Inbound.Origin.GetAllocatedSize();
+    ABCTMemory::Track(EABCTMemoryPool::Queues, Inbound.TrackedBytes);
+    InboundQueue.Enqueue(MoveTemp(Inbound));
+    return true;
+}
+
+void FABCTMessageChannel::DrainInbound()
+{
+    FInboundMessage Inbound;
+    for (int32 Dispatched = 0; Dispatched < InboundConfig.MaxDispatchPerTick && InboundQueue.Dequeue(Inbound); ++Dispatched)
+    {
+        UntrackInbound(Inbound);
+        ABCTStats::RecordCyclesSince(EABCTHistogram::IngressToDispatchMicros, Inbound.ReceivedCycles);
+
+        if (Inbound.Message.StartsWith(ControlPrefix, ESearchCase::CaseSensitive))
+        {
+            HandleControlMessage(Inbound);
+            continue;
+        }
+        RecordInboundLatency(Inbound);
+
+        // Looked up per message: a handler may close the tab
+        if (UCPP_ABCT_Base *Instance = ChromeCustomTabsRegistry::GetActiveInstance())
+        {
+            // The strings move into the shared payload; Inbound is overwritten by the next Dequeue
+            Instance->HandlePostMessage(FABCTEvent::MakePageMessage(MoveTemp(Inbound.Message), MoveTemp(Inbound.Origin)));
+        }
+        else
+        {
+            ABCTStats::Increment(EABCTCounter::EventsDroppedNoInstance);
+        }
+    }
+}
+
+void FABCTMessageChannel::UpdateCredits(bool bForceGrant)
+{
+    const int32 Window = InboundConfig.ReceiveWindow;
+
+    if (bSlowdownPending.exchange(false))
+    {
+        ABCTStats::Increment(EABCTCounter::InboundSlowdownsSent);
+        Send(EABCTMessageLane::Control, FString::Printf(TEXT("{\"abct\":\"slowdown\",\"queued\":%d,\"window\":%d}"), GetInboundQueuedCount(), Window));
+    }
+
+    // Free window space = credits the page could use without overflowing the queue
+    const int32 Outstanding = FMath::Max(0, OutstandingCredits.load(std::memory_order_relaxed));
+    const int32 Grant = Window - Outstanding - GetInboundQueuedCount();
+    if (Grant <= 0 || (!bForceGrant && Grant < FMath::Min(InboundConfig.GrantBatch, Window)))
+    {
+        return;
+    }
+
+    OutstandingCredits.fetch_add(Grant, std::memory_order_relaxed);
+    ABCTStats::Increment(EABCTCounter::InboundCreditsGranted, Grant);
+    ABCTStats::SetGauge(EABCTGauge::InboundOutstandingCredits, Outstanding + Grant);
+    Send(EABCTMessageLane::Control, FString::Printf(TEXT("{\"abct\":\"credit\",\"grant\":%d,\"window\":%d}"), Grant, Window));
+}
+
+void FABCTMessageChannel::HandleControlMessage(const FInboundMessage &Inbound)
+{
+    LLM_SCOPE_BYTAG(ABCT_Parsing);
+    TSharedPtr<FJsonObject> Json;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Inbound.Message), Json) || !Json.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FABCTMessageChannel - Malformed protocol message from page"));
+        return;
+    }
+    if (Json->GetStringField(TEXT("abct")) != TEXT("pong"))
+    {
+        return;
+    }
+
+    double T0 = 0.0, T1 = 0.0, T2 = 0.0;
+    if (!Json->TryGetNumberField(TEXT("t0"), T0) || !Json->TryGetNumberField(TEXT("t1"), T1) || !Json->TryGetNumberField(TEXT("t2"), T2))
+    {
+        return;
+    }
+    const double T3 = Inbound.ReceivedMillis;
+    ClockSync.AddSample(T0, T1, T2, T3);
+    ABCTStats::Increment(EABCTCounter::ClockSyncSamples);
+    ABCTStats::SetGauge(EABCTGauge::ClockOffsetMicros, (int64)(ClockSync.GetOffsetMillis() * 1000.0));
+    ABCTStats::SetGauge(EABCTGauge::ClockBestDelayMicros, (int64)(ClockSync.GetBestDelayMillis() * 1000.0));
+
+    RecordLatencyMillis(EABCTLatencyDirection::GameToPage, TEXTVIEW("ping"), ClockSync.PageToGameMillis(T1) - T0);
+    RecordLatencyMillis(EABCTLatencyDirection::PageToGame, TEXTVIEW("pong"), T3 - ClockSync.PageToGameMillis(T2));
+
+    // Receive times of stamped game messages, reported by the page
+    const TArray<TSharedPtr<FJsonValue>> *Received = nullptr;
+    if (Json->TryGetArrayField(TEXT("rx"), Received))
+    {
+        for (const TSharedPtr<FJsonValue> &Entry : *Received)
+        {
+            const TArray<TSharedPtr<FJsonValue>> *Fields = nullptr;
+            if (Entry.IsValid() && Entry->TryGetArray(Fields) && Fields->Num() == 3)
+            {
+                const FString Type = (*Fields)[0]->AsString();
+                const double SentMillis = (*Fields)[1]->AsNumber();
+                const double ReceivedMillis = (*Fields)[2]->AsNumber();
+                RecordLatencyMillis(EABCTLatencyDirection::GameToPage, Type, ClockSync.PageToGameMillis(ReceivedMillis) - SentMillis);
+            }
+        }
+    }
+}
+
+void FABCTMessageChannel::RecordInboundLatency(const FInboundMessage &Inbound) const
+{
+    double SentMillis = 0.0;
+    if (!ClockSync.HasEstimate() || !ABCTJsonScan::FindNumberField(Inbound.Message, TEXTVIEW("_ts"), SentMillis))
+    {
+        return;
+    }
+    FStringView Type = TEXTVIEW("untyped");
+    ABCTJsonScan::FindStringField(Inbound.Message, TEXTVIEW("type"), Type);
+    RecordLatencyMillis(EABCTLatencyDirection::PageToGame, Type, Inbound.ReceivedMillis - ClockSync.PageToGameMillis(SentMillis));
+}
+
+void FABCTMessageChannel::StartPingTimer()
+{
+    ABCTTimers::ClearTimer(PingTimer);
+    if (Config.PingIntervalSeconds > 0.0f)
+    {
+        PingTimer = ABCTTimers::SetTimer(0.0, [this]()
+                                         { SendPing(); }, Config.PingIntervalSeconds);
+    }
+}
+
+void FABCTMessageChannel::SendPing()
+{
+    if (!bReady || !ABCTMemory::IsTracingEnabled())
+    {
+        return;
+    }
+    LLM_SCOPE_BYTAG(ABCT_Messaging);
+    Send(EABCTMessageLane::Control, FString::Printf(TEXT("{\"abct\":\"ping\",\"id\":%u,\"t0\":%.3f}"), NextPingId++, ABCTClock::NowMillis()));
+}
+
+void FABCTMessageChannel::ResetInbound()
+{
+    FInboundMessage Inbound;
+    while (InboundQueue.Dequeue(Inbound))
+    {
+        UntrackInbound(Inbound);
+        ABCTStats::Increment(EABCTCounter::InboundMessagesDropped);
+    }
+    OutstandingCredits = 0;
+    ABCTStats::SetGauge(EABCTGauge::InboundOutstandingCredits, 0);
+}
+
+void FABCTMessageChannel::UntrackInbound(const FInboundMessage &Inbound)
+{
+    InboundQueued.fetch_sub(1, std::memory_order_relaxed);
+    InboundQueuedChars.fetch_sub(Inbound.Message.Len(), std::memory_order_relaxed);
+    ABCTStats::AddGauge(EABCTGauge::InboundQueuedMessages, -1);
+    ABCTMemory::Track(EABCTMemoryPool::Queues, -Inbound.TrackedBytes);
+}
+
+// ============================================================================
+// Outbound Scheduling
+// ============================================================================
+
+void FABCTMessageChannel::PumpOutbound()
+{
+    int32 Budget = Config.MaxCharsPerTick;
+    bool bMadeProgress = true;
+    FString &Frame = FrameBuffer;
+
+    // Deficit round robin: every round each non-empty lane earns Weight * ChunkSize characters
+    // and spends them frame by frame. Control is visited first, and no frame is larger than a
+    // chunk, so an urgent message waits for at most one in-flight chunk.
+    while (Budget > 0 && bMadeProgress)
+    {
+        bMadeProgress = false;
+
+        for (int32 LaneIndex = 0; LaneIndex < (int32)EABCTMessageLane::Count && Budget > 0; ++LaneIndex)
+        {
+            FLane &Lane = Lanes[LaneIndex];
+            if (Lane.Queue.IsEmpty())
+            {
+                Lane.Deficit = 0;
+                continue;
+            }
+
+            Lane.Deficit += FMath::Max(1, Config.LaneWeights[LaneIndex]) * Config.ChunkSizeChars;
+
+            while (!Lane.Queue.IsEmpty() && Budget > 0)
+            {
+                FOutboundMessage &Message = Lane.Queue.First();
+                const int32 FrameChars = BuildNextFrame(Message, Frame);
+                if (FrameChars > Lane.Deficit)
+                {
+                    break;
+                }
+                if (FrameChars > Budget && Budget < Config.MaxCharsPerTick)
+                {
+                    // Frame budget used up; an oversized frame only goes out first thing in a tick
+                    return;
+                }
+
+                if (!SendFrame(Frame))
+                {
+                    // The browser is busy or reconnecting; keep the frame and retry next tick
+                    ABCTStats::Increment(EABCTCounter::OutboundSendRetries);
+                    return;
+                }
+
+                Lane.Deficit -= FrameChars;
+                Budget -= FrameChars;
+                bMadeProgress = true;
+                ABCTStats::Increment(EABCTCounter::OutboundFramesSent);
+                ABCTStats::Increment(EABCTCounter::OutboundCharsSent, FrameChars);
+                if (Message.ChunkCount > 1)
+                {
+                    ABCTStats::Increment(EABCTCounter::OutboundChunksSent);
+                }
+
+                Message.Offset += FrameChars;
+                ++Message.ChunkIndex;
+                if (Message.ChunkIndex >= Message.ChunkCount)
+                {
+                    ABCTStats::RecordCyclesSince(LaneQueueHistograms[LaneIndex], Message.EnqueueCycles);
+                    ABCTStats::Increment(EABCTCounter::OutboundMessagesSent);
+                    ABCTStats::AddGauge(EABCTGauge::OutboundQueuedMessages, -1);
+                    ABCTMemory::Track(EABCTMemoryPool::Messaging, -Message.TrackedBytes);
+                    ReleasePayloadBuffer(MoveTemp(Message.Payload));
+                    Lane.Queue.PopFront();
+                }
+            }
+        }
+    }
+}
+
+int32 FABCTMessageChannel::BuildNextFrame(const FOutboundMessage &Message, FString &OutFrame) const
+{
+    const bool bStamp = Config.bStampFrames && ABCTMemory::IsTracingEnabled();
+    if (Message.ChunkCount <= 1)
+    {
+        const FString &Payload = Message.Payload;
+        if (!bStamp || !Payload.StartsWith(TEXT("{")) || Payload.StartsWith(ControlPrefix, ESearchCase::CaseSensitive))
+        {
+            // Reset keeps the frame buffer's allocation; plain assignment would resize it to fit
+            OutFrame.Reset(Payload.Len());
+            OutFrame.Append(Payload);
+            return Payload.Len();
+        }
+
+        // {"_ts":<send time>, + the rest of the object
+        int32 FirstMember = 1;
+        while (FirstMember < Payload.Len() && FChar::IsWhitespace(Payload[FirstMember]))
+        {
+            ++FirstMember;
+        }
+        const bool bEmptyObject = FirstMember < Payload.Len() && Payload[FirstMember] == TEXT('}');
+        OutFrame.Reset(Payload.Len() + 32);
+        OutFrame.Appendf(TEXT("{\"_ts\":%.3f%s"), ABCTClock::NowMillis(), bEmptyObject ? TEXT("") : TEXT(","));
+        OutFrame.Append(*Payload + FirstMember, Payload.Len() - FirstMember);
+        return Payload.Len();
+    }
+
+    // Never split a UTF-16 surrogate pair across chunks
+    int32 SliceChars = FMath::Min(Config.ChunkSizeChars, Message.Payload.Len() - Message.Offset);
+    const int32 SliceEnd = Message.Offset + SliceChars;
+    if (SliceEnd < Message.Payload.Len() && SliceChars > 1 && StringConv::IsHighSurrogate(Message.Payload[SliceEnd - 1]))
+    {
+        --SliceChars;
+    }
+    const bool bLastChunk = Message.ChunkIndex == Message.ChunkCount - 1;
+    if (bLastChunk)
+    {
+        SliceChars = Message.Payload.Len() - Message.Offset;
+    }
+
+    OutFrame.Reset(SliceChars + 128);
+    OutFrame.Appendf(TEXT("{\"abct\":\"chunk\",\"id\":%u,\"seq\":%d,\"of\":%d,"), Message.MessageId, Message.ChunkIndex, Message.ChunkCount);
+    if (bStamp)
+    {
+        OutFrame.Appendf(TEXT("\"ts\":%.3f,"), ABCTClock::NowMillis());
+    }
+    OutFrame += TEXT("\"data\":\"");
+    FABCTJsonWriter::AppendEscaped(OutFrame, FStringView(*Message.Payload + Message.Offset, SliceChars));
+    OutFrame += TEXT("\"}");
+    return SliceChars;
+}
+
+bool FABCTMessageChannel::SendFrame(const FString &Frame)
+{
+    if (TSharedPtr<IABCTBackend> Backend = ABCTBackend::GetOverride())
+    {
+        return Backend->PostMessageToPage(Frame);
+    }
+
+#if PLATFORM_ANDROID
+    return ABCTJavaBridge::ExecuteJava(Frame);
+#else
+    return false;
+#endif
+}
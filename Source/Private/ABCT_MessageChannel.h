@@ -0,0 +1,243 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel scheduling.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_ClockSync.h"
+#include "ABCT_MessageTypes.h"
+#include "ABCT_TimerWheel.h"
+#include "Containers/Queue.h"
+#include "Containers/RingBuffer.h"
+#include <atomic>
+
+/**
+ * Tuning for the outbound scheduler. Sizes are in UTF-16 characters of payload.
+ */
+struct FABCTOutboundConfig
+{
+    /** Messages longer than this are split into chunk frames */
+    int32 ChunkSizeChars = 16 * 1024;
+
+    /** Upper bound of payload sent per game frame across all lanes */
+    int32 MaxCharsPerTick = 256 * 1024;
+
+    /** Deficit round robin weights; each round a lane may send Weight * ChunkSizeChars */
+    int32 LaneWeights[(int32)EABCTMessageLane::Count] = {8, 4, 1};
+
+    /** Adds the send time ("_ts", or "ts" on chunk frames) to JSON object messages */
+    bool bStampFrames = true;
+
+    /** Seconds between clock sync pings while the channel is ready; 0 disables them */
+    float PingIntervalSeconds = 2.0f;
+
+    /** Payload buffers of sent messages kept for AcquirePayloadBuffer */
+    int32 PayloadPoolSize = 8;
+
+    /** Buffers larger than this are freed instead of pooled */
+    int32 MaxPooledPayloadChars = 64 * 1024;
+};
+
+/**
+ * Tuning for inbound flow control.
+ */
+struct FABCTInboundConfig
+{
+    /** Receive window advertised to the page: messages it may have in flight or queued */
+    int32 ReceiveWindow = 64;
+
+    /** Hard cap on queued payload characters, regardless of credits */
+    int32 MaxQueuedChars = 1024 * 1024;
+
+    /** Messages dispatched to the game per frame; the rest wait for the next frame */
+    int32 MaxDispatchPerTick = 32;
+
+    /** Credits are granted in batches of at least this many to keep control traffic low */
+    int32 GrantBatch = 16;
+};
+
+/**
+ * FABCTMessageChannel
+ *
+ * Game-side end of the PostMessage channel. Outbound messages are queued per lane and
+ * sent from the core ticker with deficit round robin scheduling: Control is visited first
+ * every round and large messages go out in chunks, so urgent messages interleave with a
+ * bulk transfer instead of waiting for it.
+ *
+ * Chunk frames have the form
+ *   {"abct":"chunk","id":<message id>,"seq":<index>,"of":<count>,"data":"<slice>"}
+ * and the page concatenates "data" in seq order to rebuild the original message.
+ *
+ * Inbound messages use credit-based flow control. The page may only send as many messages
+ * as it holds credits for; the game grants credits as it drains its bounded inbound queue:
+ *   {"abct":"credit","grant":<new credits>,"window":<receive window>}
+ * and tells the page to back off when the queue overflows (messages are dropped then):
+ *   {"abct":"slowdown","queued":<queued messages>,"window":<receive window>}
+ * Both go out on the Control lane. Memory stays bounded even if the page ignores credits.
+ *
+ * One-way latency: the game pings the page on the Control lane and the page answers with
+ * the NTP timestamps, plus the receive times of stamped messages since its last pong:
+ *   {"abct":"ping","id":<n>,"t0":<game ms>}
+ *   {"abct":"pong","id":<n>,"t0":<echoed>,"t1":<page receive ms>,"t2":<page send ms>,
+ *    "rx":[["<type>",<_ts of the message>,<page receive ms>],...]}
+ * FABCTClockSync turns the exchanges into a page clock offset. Outbound JSON objects carry
+ * "_ts" (game send time); inbound messages may carry "_ts" (page send time) and "type".
+ * Latencies are recorded per direction and message type (ABCTStats::RecordOneWayLatency).
+ * Page messages starting with {"abct": are protocol messages and are not dispatched.
+ *
+ * EnqueueInbound is thread-safe; everything else is game thread only.
+ */
+class FABCTMessageChannel
+{
+public:
+    static FABCTMessageChannel &Get();
+
+    FABCTMessageChannel();
+    ~FABCTMessageChannel();
+
+    /** Stops the clock sync ping and drops queued messages (module shutdown) */
+    void Shutdown();
+
+    /**
+     * Queues a message for the page. Bulk messages are dropped while the plugin sheds load
+     * (see ABCTMemory).
+     *
+     * @param Lane - Scheduling lane
+     * @param Message - Payload, sent as-is or chunked when longer than ChunkSizeChars
+     */
+    void Send(EABCTMessageLane Lane, FString Message);
+
+    /**
+     * Returns an empty buffer for building a message, reusing the allocation of a message that
+     * has been sent when one is pooled. Pass it back through Send.
+     *
+     * @param ReserveChars - Capacity the buffer should have
+     */
+    FString AcquirePayloadBuffer(int32 ReserveChars);
+
+    /** Returns a buffer from AcquirePayloadBuffer that will not be sent */
+    void ReleasePayloadBuffer(FString &&Buffer);
+
+    /**
+     * Queues a message received from the page. Called from the JNI / backend thread.
+     *
+     * @return false if the message was dropped because the inbound queue is full
+     */
+    bool EnqueueInbound(FString Message, FString Origin);
+
+    /** Accounts for a page message that spent a credit but is not queued (e.g. a duplicate). Thread-safe. */
+    void ConsumeInboundCredit();
+
+    /** Called when the browser reports the channel is ready (true) or the tab went away (false) */
+    void SetReady(bool bInReady);
+    bool IsReady() const { return bReady; }
+
+    /** Drops every queued inbound and outbound message */
+    void Reset();
+
+    /** Drops the messages queued in Lane; a message partly sent as chunks is finished first */
+    void DropQueued(EABCTMessageLane Lane);
+
+    /** Frees the payload buffer pool and the frame buffer */
+    void TrimBuffers();
+
+    /** A new PingIntervalSeconds restarts the ping timer of a ready channel */
+    void SetOutboundConfig(const FABCTOutboundConfig &InConfig);
+    const FABCTOutboundConfig &GetOutboundConfig() const { return Config; }
+
+    /** Applies from the next SetReady(true); the window is advertised when the channel opens */
+    void SetInboundConfig(const FABCTInboundConfig &InConfig) { InboundConfig = InConfig; }
+    const FABCTInboundConfig &GetInboundConfig() const { return InboundConfig; }
+
+    /** Inbound messages waiting for the game thread */
+    int32 GetInboundQueuedCount() const { return InboundQueued.load(std::memory_order_relaxed); }
+
+    /** Current page clock estimate (game thread) */
+    const FABCTClockSync &GetClockSync() const { return ClockSync; }
+
+    /** Messages waiting in Lane (partially sent messages included) */
+    int32 GetQueuedCount(EABCTMessageLane Lane) const { return Lanes[(int32)Lane].Queue.Num(); }
+
+    /** Dispatches queued inbound messages, updates credits and sends outbound frames; called every frame by the plugin tick (FP_AndroidBrowserCustomTabModule::Drain) */
+    void Pump();
+
+private:
+    struct FInboundMessage
+    {
+        FString Message;
+        FString Origin;
+        uint64 ReceivedCycles = 0;
+        double ReceivedMillis = 0.0;
+        int64 TrackedBytes = 0;
+    };
+
+    struct FOutboundMessage
+    {
+        FString Payload;
+        uint64 EnqueueCycles = 0;
+        uint32 MessageId = 0;
+        int32 Offset = 0;
+        int32 ChunkIndex = 0;
+        int32 ChunkCount = 1;
+        int64 TrackedBytes = 0;
+    };
+
+    struct FLane
+    {
+        TRingBuffer<FOutboundMessage> Queue;
+        int32 Deficit = 0;
+    };
+
+    /** Hands up to MaxDispatchPerTick inbound messages to the active instance */
+    void DrainInbound();
+
+    /** Tops the page's credits back up to the receive window, and sends a pending slowdown */
+    void UpdateCredits(bool bForceGrant);
+
+    /** Drops every queued inbound message */
+    void ResetInbound();
+
+    /** Releases the memory accounting of a dequeued inbound message */
+    void UntrackInbound(const FInboundMessage &Inbound);
+
+    /** Handles a protocol message from the page ({"abct":...}) */
+    void HandleControlMessage(const FInboundMessage &Inbound);
+
+    /** Records the page -> game latency of a stamped page message */
+    void RecordInboundLatency(const FInboundMessage &Inbound) const;
+
+    /** Schedules clock sync pings every PingIntervalSeconds, the first on the next tick */
+    void StartPingTimer();
+
+    /** Sends a clock sync ping (PingTimer) */
+    void SendPing();
+
+    /** Runs one outbound scheduling round */
+    void PumpOutbound();
+
+    /** Builds the next frame of Message and returns the payload characters it carries */
+    int32 BuildNextFrame(const FOutboundMessage &Message, FString &OutFrame) const;
+
+    /** Hands one frame to the backend / browser */
+    bool SendFrame(const FString &Frame);
+
+    FLane Lanes[(int32)EABCTMessageLane::Count];
+    FABCTOutboundConfig Config;
+    TArray<FString> PayloadPool;
+    FString FrameBuffer;
+
+    TQueue<FInboundMessage, EQueueMode::Mpsc> InboundQueue;
+    FABCTInboundConfig InboundConfig;
+    std::atomic<int32> InboundQueued;
+    std::atomic<int32> InboundQueuedChars;
+    std::atomic<int32> OutstandingCredits;
+    std::atomic<bool> bSlowdownPending;
+    FABCTClockSync ClockSync;
+    FABCTTimerHandle PingTimer;
+    uint32 NextPingId;
+    uint32 NextMessageId;
+    bool bReady;
+};
@@ -0,0 +1,192 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Loopback Prometheus metrics endpoint.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_MetricsEndpoint.h"
+#include "ABCT_EchoPage.h"
+#include "ABCT_Stats.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/StringBuilder.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+
+namespace
+{
+    /** How long the accept loop waits before re-checking bStopRequested */
+    const FTimespan AcceptPollInterval = FTimespan::FromMilliseconds(250);
+
+    /** How long a client gets to send its request line */
+    const FTimespan RequestReadTimeout = FTimespan::FromMilliseconds(500);
+
+    void SendAll(FSocket *Client, const ANSICHAR *Data, int32 Length)
+    {
+        int32 Offset = 0;
+        while (Offset < Length)
+        {
+            int32 BytesSent = 0;
+            if (!Client->Send(reinterpret_cast<const uint8 *>(Data) + Offset, Length - Offset, BytesSent) || BytesSent <= 0)
+            {
+                return;
+            }
+            Offset += BytesSent;
+        }
+    }
+
+    void SendResponse(FSocket *Client, const ANSICHAR *Status, const ANSICHAR *ContentType, FAnsiStringView Body)
+    {
+        TAnsiStringBuilder<256> Header;
+        Header << "HTTP/1.0 " << Status << "\r\n";
+        Header << "Content-Type: " << ContentType << "\r\n";
+        Header << "Content-Length: " << Body.Len() << "\r\n";
+        Header << "Connection: close\r\n\r\n";
+        SendAll(Client, Header.GetData(), Header.Len());
+        SendAll(Client, Body.GetData(), Body.Len());
+    }
+}
+
+FABCTMetricsEndpoint::FABCTMetricsEndpoint()
+    : ListenSocket(nullptr), Thread(nullptr), bStopRequested(false), bServeMetrics(true)
+{
+}
+
+FABCTMetricsEndpoint::~FABCTMetricsEndpoint()
+{
+    Shutdown();
+}
+
+bool FABCTMetricsEndpoint::Start(uint16 Port, bool bInServeMetrics)
+{
+    if (IsRunning())
+    {
+        return true;
+    }
+
+    // Loopback only - never expose plugin internals to the network
+    ListenSocket = FTcpSocketBuilder(TEXT("ABCT Metrics Listener"))
+                       .AsReusable()
+                       .BoundToAddress(FIPv4Address(127, 0, 0, 1))
+                       .BoundToPort(Port)
+                       .Listening(4)
+                       .Build();
+
+    if (ListenSocket == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FABCTMetricsEndpoint::Start - Failed to bind 127.0.0.1:%d"), Port);
+        return false;
+    }
+
+    bStopRequested = false;
+    bServeMetrics = bInServeMetrics;
+    Thread = FRunnableThread::Create(this, TEXT("ABCT Metrics Endpoint"), 64 * 1024, TPri_BelowNormal);
+    if (Thread == nullptr)
+    {
+        UE_LOG(LogTemp, Error, TEXT("FABCTMetricsEndpoint::Start - Failed to create serving thread"));
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+        ListenSocket = nullptr;
+        return false;
+    }
+
+    if (bServeMetrics)
+    {
+        UE_LOG(LogTemp, Log, TEXT("FABCTMetricsEndpoint: Serving Prometheus metrics on http://127.0.0.1:%d/metrics"), Port);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Log, TEXT("FABCTMetricsEndpoint: Serving the echo page on http://127.0.0.1:%d%s"), Port, ANSI_TO_TCHAR(ABCTEchoPage::Path));
+    }
+    return true;
+}
+
+void FABCTMetricsEndpoint::Shutdown()
+{
+    if (Thread != nullptr)
+    {
+        // Kill(true) calls Stop() and waits for Run() to return
+        Thread->Kill(true);
+        delete Thread;
+        Thread = nullptr;
+    }
+
+    if (ListenSocket != nullptr)
+    {
+        ListenSocket->Close();
+        ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+        ListenSocket = nullptr;
+    }
+}
+
+uint32 FABCTMetricsEndpoint::Run()
+{
+    ISocketSubsystem *SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+    while (!bStopRequested)
+    {
+        bool bHasPendingConnection = false;
+        if (!ListenSocket->WaitForPendingConnection(bHasPendingConnection, AcceptPollInterval))
+        {
+            // The wait failed without waiting; back off instead of spinning on the error
+            FPlatformProcess::Sleep((float)AcceptPollInterval.GetTotalSeconds());
+            continue;
+        }
+        if (!bHasPendingConnection)
+        {
+            continue;
+        }
+
+        if (FSocket *Client = ListenSocket->Accept(TEXT("ABCT Metrics Client")))
+        {
+            ServeClient(Client);
+            Client->Close();
+            SocketSubsystem->DestroySocket(Client);
+        }
+    }
+    return 0;
+}
+
+void FABCTMetricsEndpoint::Stop()
+{
+    bStopRequested = true;
+}
+
+void FABCTMetricsEndpoint::ServeClient(FSocket *Client)
+{
+    // Only the request line matters; headers and body are ignored
+    ANSICHAR Request[512];
+    int32 Received = 0;
+    while (Received < (int32)sizeof(Request) - 1 && Client->Wait(ESocketWaitConditions::WaitForRead, RequestReadTimeout))
+    {
+        int32 BytesRead = 0;
+        if (!Client->Recv(reinterpret_cast<uint8 *>(Request) + Received, sizeof(Request) - 1 - Received, BytesRead) || BytesRead <= 0)
+        {
+            break;
+        }
+        Received += BytesRead;
+        Request[Received] = '\0';
+        if (FCStringAnsi::Strstr(Request, "\r\n") != nullptr)
+        {
+            break;
+        }
+    }
+    Request[Received] = '\0';
+
+    const FAnsiStringView RequestLine(Request, Received);
+    if (bServeMetrics && (RequestLine.StartsWith("GET /metrics ") || RequestLine.StartsWith("GET /metrics?")))
+    {
+        TAnsiStringBuilder<16 * 1024> Body;
+        ABCTStats::WritePrometheus(Body);
+        SendResponse(Client, "200 OK", "text/plain; version=0.0.4; charset=utf-8", Body.ToView());
+    }
+    else if (RequestLine.StartsWith(WriteToAnsiString<64>("GET ", ABCTEchoPage::Path, " ")))
+    {
+        SendResponse(Client, "200 OK", "text/html; charset=utf-8", ABCTEchoPage::GetHtml());
+    }
+    else
+    {
+        SendResponse(Client, "404 Not Found", "text/plain; charset=utf-8",
+                     bServeMetrics ? "Only GET /metrics and GET /abct/echo are served\n" : "Only GET /abct/echo is served\n");
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Loopback Prometheus metrics endpoint.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+
+class FSocket;
+class FRunnableThread;
+
+/**
+ * FABCTMetricsEndpoint
+ *
+ * Minimal HTTP/1.0 server bound to 127.0.0.1 that answers "GET /metrics" with
+ * ABCTStats::WritePrometheus(). It runs on its own thread and only reads the
+ * lock-free stats storage, so a scrape never touches or blocks the game thread.
+ * It also serves the channel benchmark's echo page (ABCTEchoPage) at /abct/echo; the
+ * benchmark starts its own instance that serves only that page.
+ *
+ * Disabled by default. Enable with the command line switch: -ABCTMetricsPort=9464
+ */
+class FABCTMetricsEndpoint : public FRunnable
+{
+public:
+    FABCTMetricsEndpoint();
+    virtual ~FABCTMetricsEndpoint();
+
+    /**
+     * Binds the loopback listener and starts the serving thread.
+     *
+     * @param Port - TCP port to listen on (127.0.0.1 only)
+     * @param bServeMetrics - Answer /metrics; false serves only the echo page (channel benchmark)
+     * @return true if the listener is running
+     */
+    bool Start(uint16 Port, bool bServeMetrics = true);
+
+    /** Stops the serving thread and closes the listener */
+    void Shutdown();
+
+    bool IsRunning() const { return Thread != nullptr; }
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    /** Reads one request from Client and writes the response */
+    void ServeClient(FSocket *Client);
+
+    FSocket *ListenSocket;
+    FRunnableThread *Thread;
+    std::atomic<bool> bStopRequested;
+
+    /** Set before the serving thread starts */
+    bool bServeMetrics;
+};
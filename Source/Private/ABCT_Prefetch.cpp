@@ -0,0 +1,212 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Async loads started by the prefetch map.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Prefetch.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+namespace
+{
+    FStreamableManager &GetStreamableManager()
+    {
+        if (UAssetManager::IsInitialized())
+        {
+            return UAssetManager::GetStreamableManager();
+        }
+        // Commandlets and early startup run without an asset manager
+        static FStreamableManager FallbackManager;
+        return FallbackManager;
+    }
+}
+
+FABCTPrefetcher::~FABCTPrefetcher()
+{
+    Reset();
+}
+
+void FABCTPrefetcher::SetPage(FABCTPrefetchRequest &&Request, int32 MaxRetained)
+{
+    check(IsInGameThread());
+    if (!Request.IsEmpty() && Request.Key == Page.Key)
+    {
+        // Same assets (NavigationFinished after NavigationStarted, reload, another variant of the page)
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(ABCT_Caches);
+    FLoad Previous = MoveTemp(Page);
+    Page = FLoad();
+    if (Previous.Handle.IsValid())
+    {
+        if (Previous.Handle->IsLoadingInProgress())
+        {
+            Drop(Previous);
+        }
+        else
+        {
+            Retain(MoveTemp(Previous), MaxRetained);
+        }
+    }
+
+    if (Request.IsEmpty() || Touch(Request.Key))
+    {
+        UpdateTrackedBytes();
+        return;
+    }
+    Page = Start(MoveTemp(Request));
+    UpdateTrackedBytes();
+}
+
+void FABCTPrefetcher::AddDeepLink(FABCTPrefetchRequest &&Request, int32 MaxRetained)
+{
+    check(IsInGameThread());
+    if (Request.IsEmpty() || Touch(Request.Key))
+    {
+        return;
+    }
+
+    LLM_SCOPE_BYTAG(ABCT_Caches);
+    if (Request.Key == Page.Key)
+    {
+        // Already loading for the page; navigation no longer cancels it
+        FLoad Load = MoveTemp(Page);
+        Page = FLoad();
+        Retain(MoveTemp(Load), MaxRetained);
+        return;
+    }
+    Retain(Start(MoveTemp(Request)), MaxRetained);
+}
+
+void FABCTPrefetcher::Reset()
+{
+    Drop(Page);
+    Page = FLoad();
+    for (FLoad &Load : Retained)
+    {
+        Drop(Load);
+    }
+    Retained.Empty();
+    UpdateTrackedBytes();
+}
+
+bool FABCTPrefetcher::IsRetained(const FString &Key) const
+{
+    return Retained.ContainsByPredicate([&Key](const FLoad &Load)
+                                        { return Load.Key == Key; });
+}
+
+bool FABCTPrefetcher::IsLoading(const FString &Key) const
+{
+    if (Page.Key == Key)
+    {
+        return Page.Handle.IsValid() && Page.Handle->IsLoadingInProgress();
+    }
+    const FLoad *Load = Retained.FindByPredicate([&Key](const FLoad &Entry)
+                                                 { return Entry.Key == Key; });
+    return Load && Load->Handle.IsValid() && Load->Handle->IsLoadingInProgress();
+}
+
+FABCTPrefetcher::FLoad FABCTPrefetcher::Start(FABCTPrefetchRequest &&Request)
+{
+    FLoad Load;
+    Load.Key = MoveTemp(Request.Key);
+
+    TArray<FSoftObjectPath> Paths = MoveTemp(Request.ObjectPaths);
+    if (!Request.PrimaryAssets.IsEmpty())
+    {
+        // Resolved to paths so the load is ours to cancel or release; LoadPrimaryAssets would
+        // keep the assets resident until someone unloads them
+        if (UAssetManager *AssetManager = UAssetManager::GetIfInitialized())
+        {
+            TSet<FSoftObjectPath> LoadSet;
+            for (const FPrimaryAssetId &Id : Request.PrimaryAssets)
+            {
+                AssetManager->GetPrimaryAssetLoadSet(LoadSet, Id, Request.Bundles, true);
+            }
+            for (const FSoftObjectPath &Path : LoadSet)
+            {
+                Paths.AddUnique(Path);
+            }
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("FABCTPrefetcher - No asset manager, %d primary asset(s) not prefetched"), Request.PrimaryAssets.Num());
+        }
+    }
+
+    if (Paths.IsEmpty())
+    {
+        return Load;
+    }
+
+    ABCTStats::Increment(EABCTCounter::PrefetchLoadsStarted);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    Load.Handle = GetStreamableManager().RequestAsyncLoad(MoveTemp(Paths), FStreamableDelegate::CreateLambda([StartCycles]()
+                                                                                                            {
+        ABCTStats::Increment(EABCTCounter::PrefetchLoadsCompleted);
+        ABCTStats::RecordCyclesSince(EABCTHistogram::PrefetchLoadMicros, StartCycles); }),
+                                                          Request.Priority, false, false, FString::Printf(TEXT("ABCT Prefetch %s"), *Load.Key));
+    return Load;
+}
+
+void FABCTPrefetcher::Drop(FLoad &Load)
+{
+    if (!Load.Handle.IsValid())
+    {
+        return;
+    }
+    if (Load.Handle->IsLoadingInProgress())
+    {
+        Load.Handle->CancelHandle();
+        ABCTStats::Increment(EABCTCounter::PrefetchLoadsCancelled);
+    }
+    else
+    {
+        Load.Handle->ReleaseHandle();
+    }
+    Load.Handle.Reset();
+}
+
+void FABCTPrefetcher::Retain(FLoad &&Load, int32 MaxRetained)
+{
+    Retained.Insert(MoveTemp(Load), 0);
+    while (Retained.Num() > FMath::Max(MaxRetained, 1))
+    {
+        Drop(Retained.Last());
+        Retained.Pop();
+    }
+    UpdateTrackedBytes();
+}
+
+bool FABCTPrefetcher::Touch(const FString &Key)
+{
+    const int32 Index = Retained.IndexOfByPredicate([&Key](const FLoad &Load)
+                                                    { return Load.Key == Key; });
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+    if (Index > 0)
+    {
+        FLoad Load = MoveTemp(Retained[Index]);
+        Retained.RemoveAt(Index);
+        Retained.Insert(MoveTemp(Load), 0);
+    }
+    return true;
+}
+
+void FABCTPrefetcher::UpdateTrackedBytes()
+{
+    int64 Bytes = Retained.GetAllocatedSize() + Page.Key.GetAllocatedSize();
+    for (const FLoad &Load : Retained)
+    {
+        Bytes += Load.Key.GetAllocatedSize();
+    }
+    ABCTMemory::Track(EABCTMemoryPool::Caches, Bytes - TrackedBytes);
+    TrackedBytes = Bytes;
+}
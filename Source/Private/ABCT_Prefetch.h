@@ -0,0 +1,85 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Async loads started by the prefetch map.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CPP_ABCT_PrefetchMap.h"
+
+struct FStreamableHandle;
+
+/**
+ * FABCTPrefetcher
+ *
+ * Runs the loads a UCPP_ABCT_PrefetchMap resolves, for one UCPP_ABCT_Base. The current page
+ * has at most one load, which is cancelled if the player navigates to a page with other
+ * assets before it finishes. Finished page loads and every deep link load are retained, most
+ * recent first, until MaxRetained newer ones push them out; navigation never cancels a deep
+ * link load. Releasing a load lets garbage collection have its assets again. The bookkeeping
+ * (not the loaded assets) counts against the ABCTMemory caches pool. Game thread only.
+ */
+class FABCTPrefetcher
+{
+public:
+    ~FABCTPrefetcher();
+
+    /**
+     * Makes Request the load of the page the tab is on. A request already made for the page,
+     * or still retained, is not started again.
+     *
+     * @param Request - The page's loads; empty when the page has none or the tab closed
+     * @param MaxRetained - Retained loads to keep (UCPP_ABCT_PrefetchMap::MaxRetainedLoads)
+     */
+    void SetPage(FABCTPrefetchRequest &&Request, int32 MaxRetained);
+
+    /**
+     * Starts the loads of a deep link, or keeps them if they are already loading.
+     *
+     * @param Request - The link's loads
+     * @param MaxRetained - Retained loads to keep
+     */
+    void AddDeepLink(FABCTPrefetchRequest &&Request, int32 MaxRetained);
+
+    /** Cancels or releases every load */
+    void Reset();
+
+    /** Key of the current page's load, empty if it has none */
+    const FString &GetPageKey() const { return Page.Key; }
+
+    /** Whether the load for Key is retained (finished page loads, deep link loads) */
+    bool IsRetained(const FString &Key) const;
+
+    /** Whether the load for Key, current or retained, is still loading */
+    bool IsLoading(const FString &Key) const;
+
+private:
+    struct FLoad
+    {
+        FString Key;
+        TSharedPtr<FStreamableHandle> Handle;
+    };
+
+    /** Starts the async load of Request */
+    static FLoad Start(FABCTPrefetchRequest &&Request);
+
+    /** Cancels Load if it is still loading, otherwise releases it */
+    static void Drop(FLoad &Load);
+
+    /** Puts Load at the front of the retained list and trims it to MaxRetained */
+    void Retain(FLoad &&Load, int32 MaxRetained);
+
+    /** Moves the retained load for Key to the front; false if there is none */
+    bool Touch(const FString &Key);
+
+    /** Counts the keys and the retained list in the ABCTMemory caches pool */
+    void UpdateTrackedBytes();
+
+    FLoad Page;
+    TArray<FLoad> Retained;
+
+    /** Bytes counted in ABCTMemory */
+    int64 TrackedBytes = 0;
+};
@@ -0,0 +1,270 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Frame-spread restore work when the game returns from the tab.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_ResumePipeline.h"
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_Stats.h"
+#include "Algo/BinarySearch.h"
+#include "AudioDevice.h"
+#include "Engine/Engine.h"
+#include "Misc/App.h"
+
+namespace
+{
+    struct FRegisteredStep
+    {
+        FName Name;
+        int32 Priority = 0;
+        FABCTResumeStep Step;
+        FDelegateHandle Handle;
+    };
+
+    /** State of the resume in progress */
+    struct FResume
+    {
+        bool bActive = false;
+        bool bProfileReported = false;
+        int32 Frame = 0;
+        TArray<FRegisteredStep> PendingSteps;
+        FABCTResumeProfile Profile;
+        FABCTResumeProfileReady OnProfileReady;
+
+        /** Transient primary volume to ramp back to, or negative when audio is left alone */
+        float SavedVolume = -1.0f;
+    };
+
+    FABCTResumeConfig Config;
+    TArray<FRegisteredStep> Steps;
+    FResume Current;
+    FABCTResumeProfile LastProfile;
+
+    void SetTransientVolume(float Volume)
+    {
+        if (GEngine)
+        {
+            FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+            if (AudioDevice.IsValid())
+            {
+                AudioDevice->SetTransientPrimaryVolume(Volume);
+            }
+        }
+    }
+
+    float GetTransientVolume()
+    {
+        if (GEngine)
+        {
+            FAudioDeviceHandle AudioDevice = GEngine->GetMainAudioDevice();
+            if (AudioDevice.IsValid())
+            {
+                return AudioDevice->GetTransientPrimaryVolume();
+            }
+        }
+        return -1.0f;
+    }
+
+    /** Runs pending steps until the frame's budget is spent; the first step always runs */
+    void RunSteps()
+    {
+        const double StartSeconds = FPlatformTime::Seconds();
+        const double BudgetSeconds = Config.StepBudgetMillis / 1000.0;
+
+        int32 Index = 0;
+        while (Index < Current.PendingSteps.Num())
+        {
+            if (Index > 0 && FPlatformTime::Seconds() - StartSeconds >= BudgetSeconds)
+            {
+                break;
+            }
+
+            // Copy the delegate: a step may add or remove steps, itself included
+            FABCTResumeStep Step = Current.PendingSteps[Index].Step;
+            const FDelegateHandle Handle = Current.PendingSteps[Index].Handle;
+            const bool bDone = !Step.IsBound() || Step.Execute();
+
+            // Find the step again by handle; removals during Execute shift the indices
+            const int32 StepIndex = Current.PendingSteps.IndexOfByPredicate([Handle](const FRegisteredStep &Entry)
+                                                                            { return Entry.Handle == Handle; });
+            if (bDone)
+            {
+                if (StepIndex != INDEX_NONE)
+                {
+                    Current.PendingSteps.RemoveAt(StepIndex);
+                    Index = StepIndex;
+                }
+                ++Current.Profile.StepsRun;
+                ABCTStats::Increment(EABCTCounter::ResumeStepsRun);
+            }
+            else if (StepIndex != INDEX_NONE)
+            {
+                Index = StepIndex + 1;
+            }
+        }
+    }
+
+    void ReportProfile()
+    {
+        Current.bProfileReported = true;
+        for (const float FrameMillis : Current.Profile.FrameMillis)
+        {
+            Current.Profile.WorstFrameMillis = FMath::Max(Current.Profile.WorstFrameMillis, FrameMillis);
+        }
+        ABCTStats::RecordHistogram(EABCTHistogram::ResumeWorstFrameMicros, (uint64)(Current.Profile.WorstFrameMillis * 1000.0f));
+        if (!Current.PendingSteps.IsEmpty())
+        {
+            Current.Profile.RestoreFrames = -1;
+        }
+
+        LastProfile = Current.Profile;
+        FABCTResumeProfileReady OnProfileReady = MoveTemp(Current.OnProfileReady);
+        OnProfileReady.ExecuteIfBound(LastProfile);
+    }
+}
+
+namespace ABCTResumePipeline
+{
+    FDelegateHandle AddStep(FName Name, int32 Priority, FABCTResumeStep Step)
+    {
+        check(IsInGameThread());
+        FRegisteredStep Registered;
+        Registered.Name = Name;
+        Registered.Priority = Priority;
+        Registered.Step = MoveTemp(Step);
+        Registered.Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+        const FDelegateHandle Handle = Registered.Handle;
+
+        // Highest priority first, registration order within a priority
+        const int32 InsertAt = Algo::UpperBoundBy(Steps, -Priority, [](const FRegisteredStep &Entry)
+                                                  { return -Entry.Priority; });
+        Steps.Insert(MoveTemp(Registered), InsertAt);
+        return Handle;
+    }
+
+    void RemoveStep(FDelegateHandle Handle)
+    {
+        check(IsInGameThread());
+        Steps.RemoveAll([Handle](const FRegisteredStep &Entry)
+                        { return Entry.Handle == Handle; });
+        Current.PendingSteps.RemoveAll([Handle](const FRegisteredStep &Entry)
+                                       { return Entry.Handle == Handle; });
+    }
+
+    void RemoveAllSteps(const void *UserObject)
+    {
+        check(IsInGameThread());
+        Steps.RemoveAll([UserObject](const FRegisteredStep &Entry)
+                        { return Entry.Step.IsBoundToObject(UserObject); });
+        Current.PendingSteps.RemoveAll([UserObject](const FRegisteredStep &Entry)
+                                       { return Entry.Step.IsBoundToObject(UserObject); });
+    }
+
+    void SetConfig(const FABCTResumeConfig &InConfig)
+    {
+        Config = InConfig;
+    }
+
+    const FABCTResumeConfig &GetConfig()
+    {
+        return Config;
+    }
+
+    bool Begin(EABCTResumeReason Reason, FABCTResumeProfileReady OnProfileReady)
+    {
+        check(IsInGameThread());
+        if (Current.bActive)
+        {
+            return false;
+        }
+
+        Current = FResume();
+        Current.bActive = true;
+        Current.PendingSteps = Steps;
+        Current.Profile.Reason = Reason;
+        Current.OnProfileReady = MoveTemp(OnProfileReady);
+
+        // Silence until the first frame back, then ramp up instead of restarting at full volume
+        if (Config.AudioRampFrames > 0)
+        {
+            Current.SavedVolume = GetTransientVolume();
+            if (Current.SavedVolume >= 0.0f)
+            {
+                SetTransientVolume(0.0f);
+            }
+        }
+        return true;
+    }
+
+    void Tick()
+    {
+        if (!Current.bActive || ABCTReturnToGame::IsPending())
+        {
+            return;
+        }
+        const int32 Frame = ++Current.Frame;
+
+        if (!Current.bProfileReported)
+        {
+            const float FrameMillis = (float)(FApp::GetDeltaTime() * 1000.0);
+            Current.Profile.FrameMillis.Add(FrameMillis);
+            ABCTStats::RecordHistogram(EABCTHistogram::ResumeFrameMicros, (uint64)(FrameMillis * 1000.0f));
+        }
+
+        if (!Current.PendingSteps.IsEmpty())
+        {
+            RunSteps();
+            if (Current.PendingSteps.IsEmpty())
+            {
+                Current.Profile.RestoreFrames = Frame;
+            }
+            else if (Frame >= Config.MaxResumeFrames)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("ABCTResumePipeline - %d resume step(s) unfinished after %d frames, dropped (first: %s)"),
+                       Current.PendingSteps.Num(), Frame, *Current.PendingSteps[0].Name.ToString());
+                Current.PendingSteps.Reset();
+                Current.Profile.RestoreFrames = -1;
+            }
+            else if (GEngine)
+            {
+                // Collect once the restore work is through, not on top of it
+                GEngine->DelayGarbageCollection();
+            }
+        }
+
+        const bool bAudioStaged = Current.SavedVolume < 0.0f || Frame >= Config.AudioRampFrames;
+        if (Current.SavedVolume >= 0.0f)
+        {
+            SetTransientVolume(Current.SavedVolume * FMath::Min(1.0f, (float)Frame / Config.AudioRampFrames));
+        }
+
+        if (!Current.bProfileReported && Current.Profile.FrameMillis.Num() >= Config.ProfileFrames)
+        {
+            ReportProfile();
+        }
+        if (Current.bProfileReported && Current.PendingSteps.IsEmpty() && bAudioStaged)
+        {
+            Current = FResume();
+        }
+    }
+
+    bool IsRunning()
+    {
+        return Current.bActive;
+    }
+
+    const FABCTResumeProfile &GetLastProfile()
+    {
+        return LastProfile;
+    }
+
+    void Cancel()
+    {
+        if (Current.bActive && Current.SavedVolume >= 0.0f)
+        {
+            SetTransientVolume(Current.SavedVolume);
+        }
+        Current = FResume();
+    }
+}
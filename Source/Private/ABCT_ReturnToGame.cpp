@@ -0,0 +1,95 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Return-to-game latency after closing the tab.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_Stats.h"
+#include "ABCT_TimerWheel.h"
+#include <atomic>
+
+namespace
+{
+    /** Cycles64 of the pending close request, 0 when none is pending */
+    std::atomic<uint64> CloseRequestedCycles{0};
+    std::atomic<bool> bGameVisible{false};
+    std::atomic<int64> LastReturnMicros{-1};
+
+    /** Abandons the pending close after MaxPendingSeconds (game thread) */
+    FABCTTimerHandle AbandonTimer;
+}
+
+namespace ABCTReturnToGame
+{
+    void BeginClose(bool bWaitForActivity)
+    {
+        bGameVisible.store(!bWaitForActivity, std::memory_order_relaxed);
+        CloseRequestedCycles.store(FPlatformTime::Cycles64(), std::memory_order_release);
+
+        ABCTTimers::ClearTimer(AbandonTimer);
+        AbandonTimer = ABCTTimers::SetTimer(MaxPendingSeconds, []()
+                                            {
+            if (bGameVisible.load(std::memory_order_acquire) || CloseRequestedCycles.load(std::memory_order_acquire) == 0)
+            {
+                // Back in front (Update records it later this tick), or cancelled
+                return;
+            }
+            // The activity never came back for this close (no tab was showing, or the app went
+            // to the background instead); a late resume would measure the wrong thing
+            UE_LOG(LogTemp, Verbose, TEXT("ABCTReturnToGame - Close still pending after %.0f s, not recorded"), MaxPendingSeconds);
+            CloseRequestedCycles.store(0, std::memory_order_relaxed); });
+    }
+
+    void NotifyGameVisible(bool bRelaunched)
+    {
+        if (bRelaunched)
+        {
+            ABCTStats::Increment(EABCTCounter::TabCloseRelaunches);
+        }
+        bGameVisible.store(true, std::memory_order_release);
+    }
+
+    void CancelClose()
+    {
+        // The abandon timer finds nothing pending and lets it go
+        CloseRequestedCycles.store(0, std::memory_order_release);
+    }
+
+    void Update()
+    {
+        const uint64 StartCycles = CloseRequestedCycles.load(std::memory_order_acquire);
+        if (StartCycles == 0)
+        {
+            return;
+        }
+
+        if (bGameVisible.load(std::memory_order_acquire))
+        {
+            const uint64 ElapsedMicros = ABCTStats::CyclesToMicros(FPlatformTime::Cycles64() - StartCycles);
+            ABCTStats::RecordHistogram(EABCTHistogram::TabReturnToGameMicros, ElapsedMicros);
+            LastReturnMicros.store((int64)ElapsedMicros, std::memory_order_relaxed);
+            CloseRequestedCycles.store(0, std::memory_order_relaxed);
+            ABCTTimers::ClearTimer(AbandonTimer);
+        }
+    }
+
+    bool IsPending()
+    {
+        return CloseRequestedCycles.load(std::memory_order_relaxed) != 0;
+    }
+
+    double GetLastMillis()
+    {
+        const int64 Micros = LastReturnMicros.load(std::memory_order_relaxed);
+        return Micros < 0 ? -1.0 : Micros / 1000.0;
+    }
+
+    void Reset()
+    {
+        ABCTTimers::ClearTimer(AbandonTimer);
+        CloseRequestedCycles.store(0, std::memory_order_relaxed);
+        bGameVisible.store(false, std::memory_order_relaxed);
+        LastReturnMicros.store(-1, std::memory_order_relaxed);
+    }
+}
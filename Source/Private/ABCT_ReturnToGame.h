@@ -0,0 +1,62 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Return-to-game latency after closing the tab.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ABCTReturnToGame
+ *
+ * Measures how long the player waits between CloseChromeCustomTab and the first game frame
+ * with the game back in front:
+ *
+ *   BeginClose        game thread, when the close is requested
+ *   NotifyGameVisible GameActivity.onResume after the tab is gone (Java), any thread
+ *   Update            next plugin tick, records abct_tab_return_to_game_microseconds
+ *   CancelClose       instead of NotifyGameVisible when no tab covered the game (Java)
+ *
+ * ChromeCustomTabs.java reports whether it could finish the tab in place or had to relaunch
+ * the game activity (counted as TabCloseRelaunches), so the cost of the fallback path shows up
+ * separately. A close that has not brought the game back after MaxPendingSeconds is dropped by
+ * a plugin timer (ABCTTimers).
+ */
+namespace ABCTReturnToGame
+{
+    /** A pending close older than this is abandoned instead of recorded */
+    constexpr double MaxPendingSeconds = 10.0;
+
+    /**
+     * Starts timing a close. Game thread.
+     *
+     * @param bWaitForActivity - true on Android, where the game is back only once the activity
+     *                           resumes; false when the game never left the screen (simulated
+     *                           backends, desktop), so the next frame ends the measurement
+     */
+    void BeginClose(bool bWaitForActivity);
+
+    /**
+     * The game activity is in front again. Any thread.
+     *
+     * @param bRelaunched - The tab was closed by relaunching the game activity
+     */
+    void NotifyGameVisible(bool bRelaunched);
+
+    /** Drops the pending close without recording it; nothing was covering the game. Any thread. */
+    void CancelClose();
+
+    /** Records the pending close if the game is visible again. Game thread, once per frame. */
+    void Update();
+
+    /** Whether a close is waiting for its first game frame */
+    bool IsPending();
+
+    /** Latency of the last recorded return, in milliseconds, or -1 if none was recorded */
+    double GetLastMillis();
+
+    /** Drops any pending close and forgets the last latency (tests) */
+    void Reset();
+}
@@ -0,0 +1,195 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Simulated browser backend.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_ClockSync.h"
+#include "ABCT_Ingress.h"
+#include "ABCT_JsonScan.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+// CustomTabsCallback navigation event codes (see ABCTIngress::NavigationEventCodeToName)
+namespace
+{
+    const int32 NavigationStarted = 1;
+    const int32 NavigationFinished = 2;
+    const int32 TabShown = 5;
+    const int32 TabHidden = 6;
+
+    /** Receipts kept between pongs, like the echo page */
+    const int32 MaxEchoReceipts = 256;
+}
+
+FABCTSimulatedBackend::FABCTSimulatedBackend()
+    : bFailOpen(false), bRejectPostMessages(false), bEchoPage(false), bTabOpen(false), LiveHandles(0), NavigationCounter(0), EchoCredits(0), EchoReceiptCount(0)
+{
+}
+
+bool FABCTSimulatedBackend::OpenTab(const FString &URL, const FString &ToolbarColor, const FString &UserAgent, const FString &CustomHeader)
+{
+    if (bFailOpen || URL.IsEmpty())
+    {
+        return false;
+    }
+
+    // Same order ChromeCustomTabs.java reports for a fresh tab
+    if (!bTabOpen)
+    {
+        ++LiveHandles; // Custom Tabs session
+    }
+    bTabOpen = true;
+    CurrentURL = URL;
+    EchoChunks.Reset();
+    EchoBacklog.Reset();
+    EchoCredits = 0;
+    EchoReceipts.Reset();
+    EchoReceiptCount = 0;
+    ABCTIngress::NavigationEvent(NavigationStarted, URL);
+    ABCTIngress::NavigationEvent(TabShown, URL);
+    ABCTIngress::NamedNavigationEvent(TEXT("TabOpened"), TEXT(""));
+    ABCTIngress::NavigationEvent(NavigationFinished, URL);
+    ABCTIngress::NamedNavigationEvent(TEXT("MessageChannelReady"), TEXT(""));
+    return true;
+}
+
+void FABCTSimulatedBackend::CloseTab()
+{
+    if (!bTabOpen)
+    {
+        return;
+    }
+
+    ABCTIngress::NavigationEvent(TabHidden, CurrentURL);
+    ABCTIngress::NamedNavigationEvent(TEXT("TabClosed"), TEXT(""));
+    bTabOpen = false;
+    CurrentURL.Reset();
+    --LiveHandles;
+}
+
+bool FABCTSimulatedBackend::PostMessageToPage(const FString &Message)
+{
+    if (!bTabOpen || bRejectPostMessages)
+    {
+        return false;
+    }
+    if (bEchoPage)
+    {
+        EchoFrame(Message);
+        return true;
+    }
+    SentMessages.Add(Message);
+    return true;
+}
+
+void FABCTSimulatedBackend::SimulateNavigationBurst(int32 Count)
+{
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FString URL = FString::Printf(TEXT("%s/page/%d"), *CurrentURL, ++NavigationCounter);
+        ABCTIngress::NavigationEvent(NavigationStarted, URL);
+        ABCTIngress::NavigationEvent(NavigationFinished, URL);
+    }
+}
+
+void FABCTSimulatedBackend::SimulateDeepLink(const FString &Action, const FString &ParamsJson)
+{
+    ABCTIngress::DeepLink(Action, ParamsJson);
+}
+
+void FABCTSimulatedBackend::SimulatePostMessage(const FString &Message)
+{
+    ABCTIngress::PageMessage(Message, CurrentURL);
+}
+
+// ============================================================================
+// Echo Page (mirrors ABCT_EchoPage.cpp)
+// ============================================================================
+
+void FABCTSimulatedBackend::EchoFrame(const FString &Frame)
+{
+    if (!Frame.StartsWith(TEXT("{\"abct\":"), ESearchCase::CaseSensitive))
+    {
+        EchoMessage(Frame);
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Control;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Frame), Control) || !Control.IsValid())
+    {
+        return;
+    }
+
+    const FString Kind = Control->GetStringField(TEXT("abct"));
+    if (Kind == TEXT("chunk"))
+    {
+        // The channel sends the chunks of a message in order
+        const int64 MessageId = (int64)Control->GetNumberField(TEXT("id"));
+        FString &Partial = EchoChunks.FindOrAdd(MessageId);
+        Partial += Control->GetStringField(TEXT("data"));
+        if ((int32)Control->GetNumberField(TEXT("seq")) + 1 == (int32)Control->GetNumberField(TEXT("of")))
+        {
+            const FString Message = MoveTemp(Partial);
+            EchoChunks.Remove(MessageId);
+            EchoMessage(Message);
+        }
+    }
+    else if (Kind == TEXT("credit"))
+    {
+        EchoCredits += (int32)Control->GetNumberField(TEXT("grant"));
+        while (EchoCredits > 0 && !EchoBacklog.IsEmpty())
+        {
+            --EchoCredits;
+            ABCTIngress::PageMessage(EchoBacklog[0], CurrentURL);
+            EchoBacklog.RemoveAt(0, 1, EAllowShrinking::No);
+        }
+    }
+    else if (Kind == TEXT("slowdown"))
+    {
+        EchoCredits = 0;
+    }
+    else if (Kind == TEXT("ping"))
+    {
+        const double T1 = ABCTClock::NowMillis();
+        SendFromEchoPage(FString::Printf(TEXT("{\"abct\":\"pong\",\"id\":%u,\"t0\":%.3f,\"t1\":%.3f,\"t2\":%.3f,\"rx\":[%s]}"),
+                                         (uint32)Control->GetNumberField(TEXT("id")), Control->GetNumberField(TEXT("t0")), T1, ABCTClock::NowMillis(), *EchoReceipts));
+        EchoReceipts.Reset();
+        EchoReceiptCount = 0;
+    }
+}
+
+void FABCTSimulatedBackend::EchoMessage(const FString &Message)
+{
+    FStringView Type;
+    const bool bHasType = ABCTJsonScan::FindStringField(Message, TEXTVIEW("type"), Type);
+
+    double SentMillis = 0.0;
+    if (EchoReceiptCount < MaxEchoReceipts && ABCTJsonScan::FindNumberField(Message, TEXTVIEW("_ts"), SentMillis))
+    {
+        const FString TypeName = bHasType ? FString(Type) : FString(TEXT("untyped"));
+        EchoReceipts.Appendf(TEXT("%s[\"%s\",%.3f,%.3f]"), EchoReceiptCount > 0 ? TEXT(",") : TEXT(""), *TypeName, SentMillis, ABCTClock::NowMillis());
+        ++EchoReceiptCount;
+    }
+
+    double Seq = 0.0;
+    if (bHasType && Type == TEXTVIEW("bench") && ABCTJsonScan::FindNumberField(Message, TEXTVIEW("seq"), Seq))
+    {
+        SendFromEchoPage(FString::Printf(TEXT("{\"_ts\":%.3f,\"type\":\"bench_ack\",\"seq\":%u,\"chars\":%d}"), ABCTClock::NowMillis(), (uint32)Seq, Message.Len()));
+    }
+}
+
+void FABCTSimulatedBackend::SendFromEchoPage(FString Message)
+{
+    if (EchoCredits > 0)
+    {
+        --EchoCredits;
+        ABCTIngress::PageMessage(Message, CurrentURL);
+    }
+    else
+    {
+        EchoBacklog.Add(MoveTemp(Message));
+    }
+}
@@ -0,0 +1,418 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Lock-free pipeline statistics.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Stats.h"
+#include "Misc/StringBuilder.h"
+
+// ============================================================================
+// Metric Names (Prometheus naming: snake_case, unit suffix, _total for counters)
+// ============================================================================
+
+namespace
+{
+    struct FABCTMetricName
+    {
+        const ANSICHAR *Name;
+        const ANSICHAR *Help;
+    };
+
+    const FABCTMetricName CounterNames[] = {
+        {"abct_tab_open_requests_total", "Calls to OpenChromeCustomTab"},
+        {"abct_tab_open_failures_total", "OpenChromeCustomTab calls that returned false"},
+        {"abct_tab_close_requests_total", "Calls to CloseChromeCustomTab"},
+        {"abct_tab_close_relaunches_total", "Tab closes that fell back to relaunching the game activity"},
+        {"abct_navigation_events_received_total", "Navigation events received from the browser"},
+        {"abct_navigation_events_dispatched_total", "Navigation events delivered to an instance"},
+        {"abct_deep_links_received_total", "Deep links received from the browser"},
+        {"abct_deep_links_dispatched_total", "Deep links delivered to an instance"},
+        {"abct_deep_links_routed_by_tag_total", "Deep links dispatched natively through their gameplay tag"},
+        {"abct_deep_link_batches_received_total", "Batch deep links received"},
+        {"abct_deep_link_batches_rejected_total", "Batch deep links rejected as malformed (no sub-command dispatched)"},
+        {"abct_deep_link_signatures_verified_total", "Signed deep links whose signature, expiry and nonce checked out"},
+        {"abct_deep_link_signatures_rejected_total", "Deep links dropped for a missing, malformed, expired or wrong signature"},
+        {"abct_deep_link_replays_rejected_total", "Signed deep links dropped because their nonce was already used"},
+        {"abct_deep_link_net_actions_queued_total", "Deep link actions queued for replication to the server"},
+        {"abct_deep_link_net_batches_sent_total", "Deep link action batches sent to the server"},
+        {"abct_deep_link_net_actions_rejected_total", "Replicated deep link actions the server rejected as malformed"},
+        {"abct_post_messages_received_total", "PostMessages received from the page"},
+        {"abct_post_messages_dispatched_total", "PostMessages delivered to an instance"},
+        {"abct_events_dropped_no_instance_total", "Events dropped because no instance was active"},
+        {"abct_parameter_lookups_total", "GetDeepLinkParameter calls"},
+        {"abct_parameter_parse_failures_total", "GetDeepLinkParameter calls with invalid JSON"},
+        {"abct_outbound_messages_queued_total", "Messages queued for the page"},
+        {"abct_outbound_messages_sent_total", "Messages fully delivered to the page"},
+        {"abct_outbound_messages_dropped_total", "Queued messages dropped because the tab closed"},
+        {"abct_outbound_frames_sent_total", "PostMessage frames sent (whole messages and chunks)"},
+        {"abct_outbound_chunks_sent_total", "Chunk frames sent for large messages"},
+        {"abct_outbound_chars_sent_total", "Payload characters sent to the page"},
+        {"abct_outbound_send_retries_total", "Frames the browser rejected and that will be retried"},
+        {"abct_outbound_payload_buffers_reused_total", "Outbound payload buffers served from the pool"},
+        {"abct_inbound_messages_dropped_total", "Page messages dropped by flow control or on close"},
+        {"abct_inbound_credits_granted_total", "Send credits granted to the page"},
+        {"abct_inbound_slowdowns_sent_total", "Slowdown signals sent to the page"},
+        {"abct_idempotency_keys_checked_total", "Deep links and page messages that carried an idempotency key"},
+        {"abct_duplicates_dropped_total", "Deep links and page messages dropped as duplicates"},
+        {"abct_clock_sync_samples_total", "Ping/pong exchanges used to estimate the page clock offset"},
+        {"abct_memory_shed_steps_total", "Load shedding steps taken because the plugin exceeded its memory budget"},
+        {"abct_resume_steps_run_total", "Resume pipeline steps run to completion after returning from the tab"},
+        {"abct_tab_job_slices_total", "Background job slices run while the tab covered the game"},
+        {"abct_tab_jobs_completed_total", "Background jobs finished while the tab covered the game"},
+        {"abct_tab_job_microseconds_total", "CPU time spent in background job slices"},
+        {"abct_prefetch_loads_started_total", "Asset prefetch loads started for a page or deep link"},
+        {"abct_prefetch_loads_completed_total", "Asset prefetch loads that finished"},
+        {"abct_prefetch_loads_cancelled_total", "Asset prefetch loads cancelled before finishing (page left, pushed out or released)"},
+        {"abct_timers_fired_total", "Plugin timers (timeouts, retries, intervals) fired by the timer wheel"},
+    };
+    static_assert(UE_ARRAY_COUNT(CounterNames) == (int32)EABCTCounter::Count, "CounterNames out of sync with EABCTCounter");
+
+    const FABCTMetricName GaugeNames[] = {
+        {"abct_tab_open", "1 while a Chrome Custom Tab is open"},
+        {"abct_ingress_queue_depth", "Events queued for the game thread but not yet dispatched"},
+        {"abct_deep_link_verify_queue_depth", "Deep links waiting for the signature verification worker"},
+        {"abct_live_instances", "UCPP_ABCT_Base objects currently alive"},
+        {"abct_outbound_queued_messages", "Messages waiting in the outbound lanes"},
+        {"abct_inbound_queued_messages", "Page messages waiting for the game thread"},
+        {"abct_inbound_outstanding_credits", "Credits granted to the page and not yet used"},
+        {"abct_interned_urls", "Canonical URLs held by the URL table"},
+        {"abct_clock_offset_microseconds", "Estimated page clock minus game clock"},
+        {"abct_clock_best_delay_microseconds", "Round-trip delay of the best ping/pong sample in the filter window"},
+        {"abct_memory_queues_bytes", "Bytes held by ingress tasks and the inbound page message queue"},
+        {"abct_memory_messaging_bytes", "Bytes held by queued outbound messages"},
+        {"abct_memory_caches_bytes", "Bytes held by the URL table and the payload buffer pool"},
+        {"abct_memory_budget_bytes", "Memory budget for the tracked pools (0 = unlimited)"},
+        {"abct_memory_shed_level", "Load shedding step: 0 none, 1 drop bulk, 2 shrink caches, 3 disable tracing"},
+        {"abct_tab_jobs_pending", "Background jobs not yet finished in the current tab session"},
+        {"abct_timers_scheduled", "Plugin timers waiting on the timer wheel"},
+    };
+    static_assert(UE_ARRAY_COUNT(GaugeNames) == (int32)EABCTGauge::Count, "GaugeNames out of sync with EABCTGauge");
+
+    const FABCTMetricName HistogramNames[] = {
+        {"abct_ingress_to_dispatch_microseconds", "Time from JNI receipt to game-thread dispatch"},
+        {"abct_navigation_handler_microseconds", "Time spent in HandleNavigationEvent"},
+        {"abct_deep_link_handler_microseconds", "Time spent in HandleDeepLink"},
+        {"abct_deep_link_stage_browser_microseconds", "Deep link stage: page tap to intent received in Java (browser and activity relaunch)"},
+        {"abct_deep_link_stage_bridge_microseconds", "Deep link stage: intent received to JNI entry"},
+        {"abct_deep_link_stage_ingress_microseconds", "Deep link stage: JNI entry to queued for the game thread"},
+        {"abct_deep_link_stage_queue_microseconds", "Deep link stage: queued to picked up by the game thread"},
+        {"abct_deep_link_stage_decode_microseconds", "Deep link stage: picked up to params decoded"},
+        {"abct_deep_link_stage_dispatch_microseconds", "Deep link stage: decoded to event listeners notified"},
+        {"abct_deep_link_stage_handler_microseconds", "Deep link stage: listeners notified to gameplay handler complete"},
+        {"abct_deep_link_verify_microseconds", "Time spent verifying a signed deep link on the worker thread"},
+        {"abct_parameter_parse_microseconds", "Time spent parsing deep link parameter JSON"},
+        {"abct_outbound_control_queue_microseconds", "Control lane time from enqueue to last frame sent"},
+        {"abct_outbound_interactive_queue_microseconds", "Interactive lane time from enqueue to last frame sent"},
+        {"abct_outbound_bulk_queue_microseconds", "Bulk lane time from enqueue to last frame sent"},
+        {"abct_tab_return_to_game_microseconds", "Time from CloseChromeCustomTab to the first game frame with the game back in front"},
+        {"abct_resume_frame_microseconds", "Game frame time of the profiled frames after returning from the tab"},
+        {"abct_resume_worst_frame_microseconds", "Worst profiled frame time of each return from the tab"},
+        {"abct_tab_job_session_work_microseconds", "CPU time spent on background jobs per tab session"},
+        {"abct_prefetch_load_microseconds", "Time from starting an asset prefetch load to all of its assets loaded"},
+    };
+    static_assert(UE_ARRAY_COUNT(HistogramNames) == (int32)EABCTHistogram::Count, "HistogramNames out of sync with EABCTHistogram");
+
+    const FABCTMetricName OneWayLatencyName = {"abct_oneway_latency_microseconds", "One-way message latency by direction and message type, corrected for the page clock offset"};
+
+    const FABCTMetricName DeepLinkEndToEndName = {"abct_deep_link_end_to_end_microseconds", "Deep link latency from page tap (_t param) to gameplay handler complete, by action"};
+
+    const ANSICHAR *const LatencyDirectionLabels[] = {"page_to_game", "game_to_page"};
+    static_assert(UE_ARRAY_COUNT(LatencyDirectionLabels) == (int32)EABCTLatencyDirection::Count, "LatencyDirectionLabels out of sync with EABCTLatencyDirection");
+
+    // ============================================================================
+    // Storage - plain arrays of atomics, no locks anywhere
+    // ============================================================================
+
+    std::atomic<uint64> Counters[(int32)EABCTCounter::Count];
+    std::atomic<int64> Gauges[(int32)EABCTGauge::Count];
+    FABCTHistogram Histograms[(int32)EABCTHistogram::Count];
+
+    /** One labelled histogram; Label is written once, before the slot is published through NumTypes */
+    struct FLabelledHistogram
+    {
+        ANSICHAR Label[32];
+        FABCTHistogram Histogram;
+    };
+
+    struct FLatencyFamily
+    {
+        FLabelledHistogram Slots[ABCTStats::MaxLatencyTypes];
+        std::atomic<int32> NumTypes{0};
+    };
+
+    FLatencyFamily OneWayLatencies[(int32)EABCTLatencyDirection::Count];
+    FLatencyFamily DeepLinkEndToEnd;
+
+    /** Writes MessageType into Out as a label value, returns false if it does not fit */
+    bool SanitizeLabel(FStringView MessageType, ANSICHAR (&Out)[32])
+    {
+        if (MessageType.IsEmpty() || MessageType.Len() >= UE_ARRAY_COUNT(Out))
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < MessageType.Len(); ++Index)
+        {
+            const TCHAR Char = MessageType[Index];
+            const bool bAllowed = FChar::IsAlnum(Char) || Char == TEXT('_') || Char == TEXT('.') || Char == TEXT('-');
+            Out[Index] = bAllowed && Char < 0x80 ? (ANSICHAR)Char : '_';
+        }
+        Out[MessageType.Len()] = '\0';
+        return true;
+    }
+
+    FABCTHistogram *FindLatencySlot(FLatencyFamily &Family, const ANSICHAR *Label)
+    {
+        const int32 NumTypes = Family.NumTypes.load(std::memory_order_acquire);
+        for (int32 Index = 0; Index < NumTypes; ++Index)
+        {
+            if (FCStringAnsi::Strcmp(Family.Slots[Index].Label, Label) == 0)
+            {
+                return &Family.Slots[Index].Histogram;
+            }
+        }
+        return nullptr;
+    }
+
+    /** Records into the slot of LabelValue, registering it on first use (game thread only) */
+    void RecordLabelled(FLatencyFamily &Family, FStringView LabelValue, uint64 ValueMicros)
+    {
+        ANSICHAR Label[32];
+        if (!SanitizeLabel(LabelValue, Label))
+        {
+            FCStringAnsi::Strcpy(Label, "other");
+        }
+
+        FABCTHistogram *Histogram = FindLatencySlot(Family, Label);
+        if (Histogram == nullptr)
+        {
+            const int32 NumTypes = Family.NumTypes.load(std::memory_order_relaxed);
+            if (NumTypes < ABCTStats::MaxLatencyTypes - 1 || (NumTypes == ABCTStats::MaxLatencyTypes - 1 && FCStringAnsi::Strcmp(Label, "other") == 0))
+            {
+                FLabelledHistogram &Slot = Family.Slots[NumTypes];
+                FCStringAnsi::Strcpy(Slot.Label, Label);
+                Slot.Histogram.Reset();
+                Family.NumTypes.store(NumTypes + 1, std::memory_order_release);
+                Histogram = &Slot.Histogram;
+            }
+            else
+            {
+                // Out of labels: the last slot is reserved for "other"
+                RecordLabelled(Family, TEXTVIEW("other"), ValueMicros);
+                return;
+            }
+        }
+        Histogram->Record(ValueMicros);
+    }
+
+    const FABCTHistogram *FindLabelled(FLatencyFamily &Family, FStringView LabelValue)
+    {
+        ANSICHAR Label[32];
+        return SanitizeLabel(LabelValue, Label) ? FindLatencySlot(Family, Label) : nullptr;
+    }
+
+    void ResetLabelled(FLatencyFamily &Family)
+    {
+        const int32 NumTypes = Family.NumTypes.load(std::memory_order_acquire);
+        for (int32 Index = 0; Index < NumTypes; ++Index)
+        {
+            Family.Slots[Index].Histogram.Reset();
+        }
+    }
+
+    void WriteHeader(FAnsiStringBuilderBase &Out, const FABCTMetricName &Metric, const ANSICHAR *Type)
+    {
+        Out << "# HELP " << Metric.Name << " " << Metric.Help << "\n";
+        Out << "# TYPE " << Metric.Name << " " << Type << "\n";
+    }
+
+    /**
+     * Writes the bucket, sum and count series of one histogram.
+     *
+     * @param Labels - Extra labels ("name=\"value\",..."), or empty
+     */
+    void WriteHistogramSeries(FAnsiStringBuilderBase &Out, const ANSICHAR *Name, FAnsiStringView Labels, const FABCTHistogram &Histogram)
+    {
+        // Buckets are read one by one while writers keep going, so derive _count from the
+        // cumulative bucket total to keep the exposition self-consistent.
+        uint64 Cumulative = 0;
+        for (int32 Bucket = 0; Bucket < FABCTHistogram::NumBuckets; ++Bucket)
+        {
+            Cumulative += Histogram.Buckets[Bucket].load(std::memory_order_relaxed);
+            Out << Name << "_bucket{" << Labels << (Labels.IsEmpty() ? "" : ",") << "le=\"";
+            if (Bucket == FABCTHistogram::NumBuckets - 1)
+            {
+                Out << "+Inf";
+            }
+            else
+            {
+                Out << FABCTHistogram::GetBucketUpperBound(Bucket);
+            }
+            Out << "\"} " << Cumulative << "\n";
+        }
+
+        const ANSICHAR *Open = Labels.IsEmpty() ? "" : "{";
+        const ANSICHAR *Close = Labels.IsEmpty() ? "" : "}";
+        Out << Name << "_sum" << Open << Labels << Close << " " << Histogram.Sum.load(std::memory_order_relaxed) << "\n";
+        Out << Name << "_count" << Open << Labels << Close << " " << Cumulative << "\n";
+    }
+}
+
+// ============================================================================
+// FABCTHistogram
+// ============================================================================
+
+void FABCTHistogram::Record(uint64 Value)
+{
+    const int32 Index = FMath::Min<int32>((int32)FMath::CeilLogTwo64(Value), NumBuckets - 1);
+    Buckets[Index].fetch_add(1, std::memory_order_relaxed);
+    Sum.fetch_add(Value, std::memory_order_relaxed);
+    Count.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FABCTHistogram::Reset()
+{
+    for (std::atomic<uint64> &Bucket : Buckets)
+    {
+        Bucket.store(0, std::memory_order_relaxed);
+    }
+    Sum.store(0, std::memory_order_relaxed);
+    Count.store(0, std::memory_order_relaxed);
+}
+
+uint64 FABCTHistogram::GetBucketUpperBound(int32 Index)
+{
+    return Index >= NumBuckets - 1 ? MAX_uint64 : (uint64(1) << Index);
+}
+
+// ============================================================================
+// ABCTStats
+// ============================================================================
+
+namespace ABCTStats
+{
+    void Increment(EABCTCounter Counter, uint64 Delta)
+    {
+        Counters[(int32)Counter].fetch_add(Delta, std::memory_order_relaxed);
+    }
+
+    uint64 GetCounter(EABCTCounter Counter)
+    {
+        return Counters[(int32)Counter].load(std::memory_order_relaxed);
+    }
+
+    void SetGauge(EABCTGauge Gauge, int64 Value)
+    {
+        Gauges[(int32)Gauge].store(Value, std::memory_order_relaxed);
+    }
+
+    void AddGauge(EABCTGauge Gauge, int64 Delta)
+    {
+        Gauges[(int32)Gauge].fetch_add(Delta, std::memory_order_relaxed);
+    }
+
+    int64 GetGauge(EABCTGauge Gauge)
+    {
+        return Gauges[(int32)Gauge].load(std::memory_order_relaxed);
+    }
+
+    void RecordHistogram(EABCTHistogram Histogram, uint64 ValueMicros)
+    {
+        Histograms[(int32)Histogram].Record(ValueMicros);
+    }
+
+    const FABCTHistogram &GetHistogram(EABCTHistogram Histogram)
+    {
+        return Histograms[(int32)Histogram];
+    }
+
+    void RecordCyclesSince(EABCTHistogram Histogram, uint64 StartCycles)
+    {
+        RecordHistogram(Histogram, CyclesToMicros(FPlatformTime::Cycles64() - StartCycles));
+    }
+
+    void RecordOneWayLatency(EABCTLatencyDirection Direction, FStringView MessageType, uint64 ValueMicros)
+    {
+        RecordLabelled(OneWayLatencies[(int32)Direction], MessageType, ValueMicros);
+    }
+
+    const FABCTHistogram *FindOneWayLatency(EABCTLatencyDirection Direction, FStringView MessageType)
+    {
+        return FindLabelled(OneWayLatencies[(int32)Direction], MessageType);
+    }
+
+    void RecordDeepLinkEndToEnd(FStringView Action, uint64 ValueMicros)
+    {
+        RecordLabelled(DeepLinkEndToEnd, Action, ValueMicros);
+    }
+
+    const FABCTHistogram *FindDeepLinkEndToEnd(FStringView Action)
+    {
+        return FindLabelled(DeepLinkEndToEnd, Action);
+    }
+
+    uint64 CyclesToMicros(uint64 Cycles)
+    {
+        return (uint64)(FPlatformTime::ToSeconds64(Cycles) * 1000000.0);
+    }
+
+    void ResetAll()
+    {
+        for (std::atomic<uint64> &Counter : Counters)
+        {
+            Counter.store(0, std::memory_order_relaxed);
+        }
+        for (FABCTHistogram &Histogram : Histograms)
+        {
+            Histogram.Reset();
+        }
+        for (FLatencyFamily &Family : OneWayLatencies)
+        {
+            ResetLabelled(Family);
+        }
+        ResetLabelled(DeepLinkEndToEnd);
+    }
+
+    void WritePrometheus(FAnsiStringBuilderBase &Out)
+    {
+        for (int32 Index = 0; Index < (int32)EABCTCounter::Count; ++Index)
+        {
+            WriteHeader(Out, CounterNames[Index], "counter");
+            Out << CounterNames[Index].Name << " " << Counters[Index].load(std::memory_order_relaxed) << "\n";
+        }
+
+        for (int32 Index = 0; Index < (int32)EABCTGauge::Count; ++Index)
+        {
+            WriteHeader(Out, GaugeNames[Index], "gauge");
+            Out << GaugeNames[Index].Name << " " << Gauges[Index].load(std::memory_order_relaxed) << "\n";
+        }
+
+        for (int32 Index = 0; Index < (int32)EABCTHistogram::Count; ++Index)
+        {
+            WriteHeader(Out, HistogramNames[Index], "histogram");
+            WriteHistogramSeries(Out, HistogramNames[Index].Name, FAnsiStringView(), Histograms[Index]);
+        }
+
+        WriteHeader(Out, OneWayLatencyName, "histogram");
+        for (int32 Direction = 0; Direction < (int32)EABCTLatencyDirection::Count; ++Direction)
+        {
+            const FLatencyFamily &Family = OneWayLatencies[Direction];
+            const int32 NumTypes = Family.NumTypes.load(std::memory_order_acquire);
+            for (int32 Index = 0; Index < NumTypes; ++Index)
+            {
+                TAnsiStringBuilder<96> Labels;
+                Labels << "direction=\"" << LatencyDirectionLabels[Direction] << "\",type=\"" << Family.Slots[Index].Label << "\"";
+                WriteHistogramSeries(Out, OneWayLatencyName.Name, Labels.ToView(), Family.Slots[Index].Histogram);
+            }
+        }
+
+        WriteHeader(Out, DeepLinkEndToEndName, "histogram");
+        const int32 NumActions = DeepLinkEndToEnd.NumTypes.load(std::memory_order_acquire);
+        for (int32 Index = 0; Index < NumActions; ++Index)
+        {
+            TAnsiStringBuilder<64> Labels;
+            Labels << "action=\"" << DeepLinkEndToEnd.Slots[Index].Label << "\"";
+            WriteHistogramSeries(Out, DeepLinkEndToEndName.Name, Labels.ToView(), DeepLinkEndToEnd.Slots[Index].Histogram);
+        }
+    }
+}
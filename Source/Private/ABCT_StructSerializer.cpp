@@ -0,0 +1,709 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Reflection-driven struct serialization.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_StructSerializer.h"
+#include "ABCT_JsonWriter.h"
+#include "ABCT_Memory.h"
+#include "Misc/Crc.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Class.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/Package.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+static_assert(PLATFORM_LITTLE_ENDIAN, "The binary struct format is little-endian and written with memcpy");
+
+namespace
+{
+    enum class EPlanOp : uint8
+    {
+        Bool,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float,
+        Double,
+        String,
+        Name,
+        Text,
+        BeginStruct,
+        EndStruct,
+        Array,
+    };
+
+    /** Schema type names, indexed by EPlanOp */
+    const TCHAR *const OpTypeNames[] = {
+        TEXT("bool"),
+        TEXT("i8"),
+        TEXT("u8"),
+        TEXT("i16"),
+        TEXT("u16"),
+        TEXT("i32"),
+        TEXT("u32"),
+        TEXT("i64"),
+        TEXT("u64"),
+        TEXT("f32"),
+        TEXT("f64"),
+        TEXT("str"),
+        TEXT("str"),
+        TEXT("str"),
+        TEXT("struct"),
+        TEXT("struct"),
+        TEXT("array"),
+    };
+    static_assert(UE_ARRAY_COUNT(OpTypeNames) == (int32)EPlanOp::Array + 1, "OpTypeNames out of sync with EPlanOp");
+
+    /** Binary width of fixed-size ops, indexed by EPlanOp (0 = variable or none) */
+    const int32 OpSizes[] = {1, 1, 1, 2, 2, 4, 4, 8, 8, 4, 8, 0, 0, 0, 0, 0, 0};
+    static_assert(UE_ARRAY_COUNT(OpSizes) == (int32)EPlanOp::Array + 1, "OpSizes out of sync with EPlanOp");
+
+    struct FPlan;
+
+    struct FPlanStep
+    {
+        EPlanOp Op = EPlanOp::Bool;
+
+        /** Offset from the start of the outermost struct (or array element) */
+        int32 Offset = 0;
+
+        /** Pre-encoded "Name": for struct members; empty for array elements and EndStruct */
+        FString JsonKey;
+
+        /** Bool: reads bitfield and native bools alike */
+        const FBoolProperty *BoolProperty = nullptr;
+
+        /** Array: plan of one element and the distance between elements */
+        const FPlan *Element = nullptr;
+        int32 Stride = 0;
+
+        /** Array: Element is the root plan of a recursive struct, which has no BeginStruct/EndStruct */
+        bool bWrapElement = false;
+
+        /** Integers: index into FPlan::EnumNames when the field is an enum */
+        int32 EnumIndex = INDEX_NONE;
+    };
+
+    struct FEnumName
+    {
+        int64 Value;
+
+        /** Quoted and escaped, ready for RawValue */
+        FString Json;
+    };
+
+    struct FPlan
+    {
+        TArray<FPlanStep> Steps;
+        TArray<TArray<FEnumName>> EnumNames;
+
+        /** Owned element plans; steps of recursive structs point back at an enclosing plan instead */
+        TArray<TUniquePtr<FPlan>> Elements;
+    };
+
+    struct FStructPlan
+    {
+        FPlan Root;
+        FString TypeName;
+
+        /** {"type":"<Struct>","fields":[...]} */
+        FString SchemaDef;
+        uint32 SchemaHash = 0;
+
+        /** Every struct and enum in the plan is native; Blueprint ones can be recompiled in the editor */
+        bool bCompiledIn = true;
+    };
+
+    using FStructPlanRef = TSharedRef<const FStructPlan, ESPMode::ThreadSafe>;
+
+    // ============================================================================
+    // Plan Building
+    // ============================================================================
+
+    /** Maps a scalar property to its op; false for unsupported types */
+    bool GetScalarOp(const FProperty *Property, EPlanOp &OutOp, const UEnum *&OutEnum)
+    {
+        if (const FEnumProperty *EnumProperty = CastField<FEnumProperty>(Property))
+        {
+            const UEnum *Unused = nullptr;
+            OutEnum = EnumProperty->GetEnum();
+            return GetScalarOp(EnumProperty->GetUnderlyingProperty(), OutOp, Unused);
+        }
+        if (const FByteProperty *ByteProperty = CastField<FByteProperty>(Property))
+        {
+            OutEnum = ByteProperty->Enum;
+            OutOp = EPlanOp::UInt8;
+            return true;
+        }
+
+        if (Property->IsA<FBoolProperty>())
+        {
+            OutOp = EPlanOp::Bool;
+        }
+        else if (Property->IsA<FInt8Property>())
+        {
+            OutOp = EPlanOp::Int8;
+        }
+        else if (Property->IsA<FInt16Property>())
+        {
+            OutOp = EPlanOp::Int16;
+        }
+        else if (Property->IsA<FUInt16Property>())
+        {
+            OutOp = EPlanOp::UInt16;
+        }
+        else if (Property->IsA<FIntProperty>())
+        {
+            OutOp = EPlanOp::Int32;
+        }
+        else if (Property->IsA<FUInt32Property>())
+        {
+            OutOp = EPlanOp::UInt32;
+        }
+        else if (Property->IsA<FInt64Property>())
+        {
+            OutOp = EPlanOp::Int64;
+        }
+        else if (Property->IsA<FUInt64Property>())
+        {
+            OutOp = EPlanOp::UInt64;
+        }
+        else if (Property->IsA<FFloatProperty>())
+        {
+            OutOp = EPlanOp::Float;
+        }
+        else if (Property->IsA<FDoubleProperty>())
+        {
+            OutOp = EPlanOp::Double;
+        }
+        else if (Property->IsA<FStrProperty>())
+        {
+            OutOp = EPlanOp::String;
+        }
+        else if (Property->IsA<FNameProperty>())
+        {
+            OutOp = EPlanOp::Name;
+        }
+        else if (Property->IsA<FTextProperty>())
+        {
+            OutOp = EPlanOp::Text;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    bool IsSupported(const FProperty *Property)
+    {
+        if (Property->ArrayDim != 1)
+        {
+            return false;
+        }
+        if (Property->IsA<FStructProperty>())
+        {
+            return true;
+        }
+        if (const FArrayProperty *ArrayProperty = CastField<FArrayProperty>(Property))
+        {
+            return IsSupported(ArrayProperty->Inner);
+        }
+        EPlanOp Op;
+        const UEnum *Enum = nullptr;
+        return GetScalarOp(Property, Op, Enum);
+    }
+
+    /** Walks reflection data once, emitting plan steps and the schema side by side */
+    class FPlanBuilder
+    {
+    public:
+        FPlanBuilder(const UScriptStruct *InRoot, FABCTJsonWriter &InSchema)
+            : Root(InRoot), Schema(InSchema), bCompiledIn(true)
+        {
+        }
+
+        /** Whether every struct and enum the plan uses is native */
+        bool IsCompiledIn() const { return bCompiledIn; }
+
+        /** Adds the root struct's fields to Plan */
+        void AddRoot(FPlan &Plan)
+        {
+            OpenPlans.Add({Root, &Plan, true});
+            AddFields(Plan, Root, 0);
+            OpenPlans.Pop();
+        }
+
+        /** Adds Struct's fields at BaseOffset to Plan and writes them as a schema "fields" array */
+        void AddFields(FPlan &Plan, const UStruct *Struct, int32 BaseOffset)
+        {
+            NoteType(Struct);
+            Schema.BeginArray();
+            for (TFieldIterator<FProperty> It(Struct); It; ++It)
+            {
+                const FProperty *Property = *It;
+                if (!IsSupported(Property))
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("ABCTStructSerializer - %s: field %s (%s) is not supported and is skipped"),
+                           *Root->GetName(), *Property->GetName(), *Property->GetCPPType());
+                    continue;
+                }
+                const FString Name = Property->GetAuthoredName();
+                AddValue(Plan, Property, BaseOffset + Property->GetOffset_ForInternal(), &Name);
+            }
+            Schema.EndArray();
+        }
+
+        /** Adds a supported value; Name is null for array elements */
+        void AddValue(FPlan &Plan, const FProperty *Property, int32 Offset, const FString *Name)
+        {
+            if (const FStructProperty *StructProperty = CastField<FStructProperty>(Property))
+            {
+                BeginSchemaEntry(Name, TEXT("struct"));
+                Schema.Field(TEXT("struct"), StructProperty->Struct->GetName());
+                Schema.Key(TEXT("fields"));
+                AddStep(Plan, EPlanOp::BeginStruct, Offset, Name);
+                AddFields(Plan, StructProperty->Struct, Offset);
+                AddStep(Plan, EPlanOp::EndStruct, Offset, nullptr);
+                Schema.EndObject();
+                return;
+            }
+
+            if (const FArrayProperty *ArrayProperty = CastField<FArrayProperty>(Property))
+            {
+                BeginSchemaEntry(Name, TEXT("array"));
+                Schema.Key(TEXT("of"));
+                FPlanStep &Step = AddStep(Plan, EPlanOp::Array, Offset, Name);
+                Step.Stride = ArrayProperty->Inner->GetElementSize();
+
+                // A struct that holds an array of itself (or of a struct that leads back to it)
+                // reuses the plan already being built for it; expanding it again never ends
+                const FStructProperty *ElementStruct = CastField<FStructProperty>(ArrayProperty->Inner);
+                const FOpenPlan *Open = ElementStruct ? OpenPlans.FindByPredicate([ElementStruct](const FOpenPlan &Entry)
+                                                                                 { return Entry.Struct == ElementStruct->Struct; })
+                                                      : nullptr;
+                if (Open != nullptr)
+                {
+                    Step.Element = Open->Plan;
+                    Step.bWrapElement = Open->bRoot;
+                    Schema.BeginObject();
+                    Schema.Field(TEXT("type"), TEXT("struct"));
+                    Schema.Field(TEXT("ref"), ElementStruct->Struct->GetName());
+                    Schema.EndObject();
+                    Schema.EndObject();
+                    return;
+                }
+
+                TUniquePtr<FPlan> Element = MakeUnique<FPlan>();
+                Step.Element = Element.Get();
+                if (ElementStruct != nullptr)
+                {
+                    OpenPlans.Add({ElementStruct->Struct, Element.Get(), false});
+                }
+                AddValue(*Element, ArrayProperty->Inner, 0, nullptr);
+                if (ElementStruct != nullptr)
+                {
+                    OpenPlans.Pop();
+                }
+                Plan.Elements.Add(MoveTemp(Element));
+                Schema.EndObject();
+                return;
+            }
+
+            EPlanOp Op = EPlanOp::Bool;
+            const UEnum *Enum = nullptr;
+            verify(GetScalarOp(Property, Op, Enum));
+
+            BeginSchemaEntry(Name, OpTypeNames[(int32)Op]);
+            FPlanStep &Step = AddStep(Plan, Op, Offset, Name);
+            Step.BoolProperty = CastField<FBoolProperty>(Property);
+            if (Enum != nullptr)
+            {
+                Step.EnumIndex = AddEnum(Plan, Enum);
+            }
+            Schema.EndObject();
+        }
+
+    private:
+        void BeginSchemaEntry(const FString *Name, const TCHAR *Type)
+        {
+            Schema.BeginObject();
+            if (Name != nullptr)
+            {
+                Schema.Field(TEXT("name"), *Name);
+            }
+            Schema.Field(TEXT("type"), Type);
+        }
+
+        FPlanStep &AddStep(FPlan &Plan, EPlanOp Op, int32 Offset, const FString *Name)
+        {
+            FPlanStep &Step = Plan.Steps.AddDefaulted_GetRef();
+            Step.Op = Op;
+            Step.Offset = Offset;
+            if (Name != nullptr)
+            {
+                Step.JsonKey = FABCTJsonWriter::EncodeKey(*Name);
+            }
+            return Step;
+        }
+
+        void NoteType(const UObject *Type)
+        {
+            bCompiledIn &= Type->GetPackage()->HasAnyPackageFlags(PKG_CompiledIn);
+        }
+
+        /** Pre-encodes Enum's names for JSON and writes them to the schema entry as "enum" */
+        int32 AddEnum(FPlan &Plan, const UEnum *Enum)
+        {
+            NoteType(Enum);
+            TArray<FEnumName> &Names = Plan.EnumNames.AddDefaulted_GetRef();
+            Schema.Key(TEXT("enum"));
+            Schema.BeginObject();
+            const int32 Count = Enum->NumEnums() - (Enum->ContainsExistingMax() ? 1 : 0);
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                FEnumName &Entry = Names.AddDefaulted_GetRef();
+                Entry.Value = Enum->GetValueByIndex(Index);
+                const FString Name = Enum->GetNameStringByIndex(Index);
+                Entry.Json = TEXT("\"");
+                FABCTJsonWriter::AppendEscaped(Entry.Json, Name);
+                Entry.Json += TEXT("\"");
+                Schema.Field(LexToString(Entry.Value), Name);
+            }
+            Schema.EndObject();
+            return Plan.EnumNames.Num() - 1;
+        }
+
+        /** A struct whose plan starts at offset 0 and is still being built */
+        struct FOpenPlan
+        {
+            const UStruct *Struct;
+            const FPlan *Plan;
+            bool bRoot;
+        };
+
+        const UScriptStruct *Root;
+        FABCTJsonWriter &Schema;
+        bool bCompiledIn;
+
+        /** Root and array element structs on the current build path */
+        TArray<FOpenPlan, TInlineAllocator<4>> OpenPlans;
+    };
+
+    FStructPlanRef BuildPlan(const UScriptStruct *Struct)
+    {
+        TSharedRef<FStructPlan, ESPMode::ThreadSafe> Plan = MakeShared<FStructPlan, ESPMode::ThreadSafe>();
+        Plan->TypeName = Struct->GetName();
+
+        FABCTJsonWriter Schema(Plan->SchemaDef);
+        Schema.BeginObject();
+        Schema.Field(TEXT("type"), Plan->TypeName);
+        Schema.Key(TEXT("fields"));
+        FPlanBuilder Builder(Struct, Schema);
+        Builder.AddRoot(Plan->Root);
+        Schema.EndObject();
+
+        Plan->SchemaHash = FCrc::StrCrc32(*Plan->SchemaDef);
+        Plan->bCompiledIn = Builder.IsCompiledIn();
+        return Plan;
+    }
+
+    /**
+     * Returns the cached plan of Struct, building it on first use. In the editor, plans using
+     * user defined structs or enums are rebuilt on every call instead: recompiling one changes
+     * its layout under the same pointer, and a cached plan would read at the old offsets.
+     */
+    FStructPlanRef GetPlan(const UScriptStruct *Struct)
+    {
+        check(Struct != nullptr);
+
+        static FRWLock PlansLock;
+        static TMap<const UScriptStruct *, FStructPlanRef> Plans;
+        {
+            FReadScopeLock ReadLock(PlansLock);
+            if (const FStructPlanRef *Found = Plans.Find(Struct))
+            {
+                return *Found;
+            }
+        }
+
+        FWriteScopeLock WriteLock(PlansLock);
+        if (const FStructPlanRef *Found = Plans.Find(Struct))
+        {
+            return *Found;
+        }
+        LLM_SCOPE_BYTAG(ABCT_Caches);
+        FStructPlanRef Plan = BuildPlan(Struct);
+#if WITH_EDITOR
+        if (!Plan->bCompiledIn)
+        {
+            return Plan;
+        }
+#endif
+        Plans.Add(Struct, Plan);
+        return Plan;
+    }
+
+    // ============================================================================
+    // Plan Execution
+    // ============================================================================
+
+    /** Per-thread buffer for FName text, so names are converted without allocating */
+    FString &GetNameScratch()
+    {
+        static thread_local FString Scratch;
+        return Scratch;
+    }
+
+    /** Reads Int8 .. Int64 (not UInt64) as int64 */
+    int64 ReadInteger(EPlanOp Op, const uint8 *Ptr)
+    {
+        switch (Op)
+        {
+        case EPlanOp::Int8:
+            return *(const int8 *)Ptr;
+        case EPlanOp::UInt8:
+            return *Ptr;
+        case EPlanOp::Int16:
+            return *(const int16 *)Ptr;
+        case EPlanOp::UInt16:
+            return *(const uint16 *)Ptr;
+        case EPlanOp::Int32:
+            return *(const int32 *)Ptr;
+        case EPlanOp::UInt32:
+            return *(const uint32 *)Ptr;
+        case EPlanOp::Int64:
+            return *(const int64 *)Ptr;
+        default:
+            return 0;
+        }
+    }
+
+    void WriteJsonSteps(const FPlan &Plan, const uint8 *Base, FABCTJsonWriter &Writer)
+    {
+        for (const FPlanStep &Step : Plan.Steps)
+        {
+            if (!Step.JsonKey.IsEmpty())
+            {
+                Writer.PreEncodedKey(Step.JsonKey);
+            }
+            const uint8 *Ptr = Base + Step.Offset;
+
+            switch (Step.Op)
+            {
+            case EPlanOp::Bool:
+                Writer.Value(Step.BoolProperty->GetPropertyValue(Ptr));
+                break;
+            case EPlanOp::Int8:
+            case EPlanOp::UInt8:
+            case EPlanOp::Int16:
+            case EPlanOp::UInt16:
+            case EPlanOp::Int32:
+            case EPlanOp::UInt32:
+            case EPlanOp::Int64:
+            {
+                const int64 Value = ReadInteger(Step.Op, Ptr);
+                if (Step.EnumIndex != INDEX_NONE)
+                {
+                    const FEnumName *Name = Plan.EnumNames[Step.EnumIndex].FindByPredicate([Value](const FEnumName &Entry)
+                                                                                           { return Entry.Value == Value; });
+                    if (Name != nullptr)
+                    {
+                        Writer.RawValue(Name->Json);
+                        break;
+                    }
+                }
+                Writer.Value(Value);
+                break;
+            }
+            case EPlanOp::UInt64:
+                Writer.Value(*(const uint64 *)Ptr);
+                break;
+            case EPlanOp::Float:
+                Writer.Value(*(const float *)Ptr);
+                break;
+            case EPlanOp::Double:
+                Writer.Value(*(const double *)Ptr);
+                break;
+            case EPlanOp::String:
+                Writer.Value(*(const FString *)Ptr);
+                break;
+            case EPlanOp::Name:
+            {
+                FString &Scratch = GetNameScratch();
+                ((const FName *)Ptr)->ToString(Scratch);
+                Writer.Value(Scratch);
+                break;
+            }
+            case EPlanOp::Text:
+                Writer.Value(((const FText *)Ptr)->ToString());
+                break;
+            case EPlanOp::BeginStruct:
+                Writer.BeginObject();
+                break;
+            case EPlanOp::EndStruct:
+                Writer.EndObject();
+                break;
+            case EPlanOp::Array:
+            {
+                const FScriptArray &Array = *(const FScriptArray *)Ptr;
+                const uint8 *Elements = (const uint8 *)Array.GetData();
+                Writer.BeginArray();
+                for (int32 Index = 0; Index < Array.Num(); ++Index)
+                {
+                    if (Step.bWrapElement)
+                    {
+                        Writer.BeginObject();
+                    }
+                    WriteJsonSteps(*Step.Element, Elements + (SIZE_T)Index * Step.Stride, Writer);
+                    if (Step.bWrapElement)
+                    {
+                        Writer.EndObject();
+                    }
+                }
+                Writer.EndArray();
+                break;
+            }
+            }
+        }
+    }
+
+    void AppendBytes(TArray<uint8> &Out, const void *Source, int32 Size)
+    {
+        const int32 At = Out.AddUninitialized(Size);
+        FMemory::Memcpy(Out.GetData() + At, Source, Size);
+    }
+
+    /** u32 byte length + UTF-8 bytes, converted in place */
+    void AppendUtf8(TArray<uint8> &Out, FStringView String)
+    {
+        const int32 LengthAt = Out.AddUninitialized(sizeof(uint32));
+        const int32 ByteCount = FPlatformString::ConvertedLength<UTF8CHAR>(String.GetData(), String.Len());
+        const int32 At = Out.AddUninitialized(ByteCount);
+        FPlatformString::Convert((UTF8CHAR *)(Out.GetData() + At), ByteCount, String.GetData(), String.Len());
+
+        const uint32 Length = (uint32)ByteCount;
+        FMemory::Memcpy(Out.GetData() + LengthAt, &Length, sizeof(Length));
+    }
+
+    void WriteBinarySteps(const FPlan &Plan, const uint8 *Base, TArray<uint8> &Out)
+    {
+        for (const FPlanStep &Step : Plan.Steps)
+        {
+            const uint8 *Ptr = Base + Step.Offset;
+
+            switch (Step.Op)
+            {
+            case EPlanOp::Bool:
+                Out.Add(Step.BoolProperty->GetPropertyValue(Ptr) ? 1 : 0);
+                break;
+            case EPlanOp::String:
+                AppendUtf8(Out, *(const FString *)Ptr);
+                break;
+            case EPlanOp::Name:
+            {
+                FString &Scratch = GetNameScratch();
+                ((const FName *)Ptr)->ToString(Scratch);
+                AppendUtf8(Out, Scratch);
+                break;
+            }
+            case EPlanOp::Text:
+                AppendUtf8(Out, ((const FText *)Ptr)->ToString());
+                break;
+            case EPlanOp::BeginStruct:
+            case EPlanOp::EndStruct:
+                break;
+            case EPlanOp::Array:
+            {
+                const FScriptArray &Array = *(const FScriptArray *)Ptr;
+                const uint8 *Elements = (const uint8 *)Array.GetData();
+                const uint32 Count = (uint32)Array.Num();
+                AppendBytes(Out, &Count, sizeof(Count));
+                for (int32 Index = 0; Index < Array.Num(); ++Index)
+                {
+                    WriteBinarySteps(*Step.Element, Elements + (SIZE_T)Index * Step.Stride, Out);
+                }
+                break;
+            }
+            default:
+                AppendBytes(Out, Ptr, OpSizes[(int32)Step.Op]);
+                break;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+namespace ABCTStructSerializer
+{
+    void WriteMessage(const UScriptStruct *Struct, const void *Data, EABCTStructFormat Format, FABCTJsonWriter &Writer)
+    {
+        const FStructPlanRef PlanRef = GetPlan(Struct);
+        const FStructPlan &Plan = *PlanRef;
+
+        Writer.BeginObject();
+        Writer.Field(TEXT("type"), Plan.TypeName);
+        if (Format == EABCTStructFormat::Binary)
+        {
+            static thread_local TArray<uint8> Bytes;
+            Bytes.Reset();
+            WriteBinarySteps(Plan.Root, (const uint8 *)Data, Bytes);
+            Writer.Field(TEXT("schema"), Plan.SchemaHash);
+            Writer.Key(TEXT("bin"));
+            Writer.Base64Value(Bytes);
+        }
+        else
+        {
+            Writer.Key(TEXT("data"));
+            Writer.BeginObject();
+            WriteJsonSteps(Plan.Root, (const uint8 *)Data, Writer);
+            Writer.EndObject();
+        }
+        Writer.EndObject();
+    }
+
+    void WriteJson(const UScriptStruct *Struct, const void *Data, FABCTJsonWriter &Writer)
+    {
+        const FStructPlanRef Plan = GetPlan(Struct);
+        Writer.BeginObject();
+        WriteJsonSteps(Plan->Root, (const uint8 *)Data, Writer);
+        Writer.EndObject();
+    }
+
+    void WriteBinary(const UScriptStruct *Struct, const void *Data, TArray<uint8> &Out)
+    {
+        WriteBinarySteps(GetPlan(Struct)->Root, (const uint8 *)Data, Out);
+    }
+
+    void WriteSchemaMessage(const UScriptStruct *Struct, FABCTJsonWriter &Writer)
+    {
+        const FStructPlanRef Plan = GetPlan(Struct);
+        Writer.BeginObject();
+        Writer.Field(TEXT("type"), TEXT("abct_schema"));
+        Writer.Field(TEXT("schema"), Plan->SchemaHash);
+        Writer.Key(TEXT("def"));
+        Writer.RawValue(Plan->SchemaDef);
+        Writer.EndObject();
+    }
+
+    uint32 GetSchemaHash(const UScriptStruct *Struct)
+    {
+        return GetPlan(Struct)->SchemaHash;
+    }
+
+    FString GetTypeName(const UScriptStruct *Struct)
+    {
+        return GetPlan(Struct)->TypeName;
+    }
+}
@@ -0,0 +1,433 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Background jobs run while the tab covers the game.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_TabJobs.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "ShaderPipelineCache.h"
+#include <atomic>
+
+namespace
+{
+    /** How long the idle worker sleeps before re-checking the tab state on its own */
+    constexpr uint32 IdleWaitMillis = 250;
+
+    /** Shortest sleep after a slice, so a job that yields at once cannot spin the worker */
+    constexpr double MinIdleSeconds = 0.001;
+
+    struct FJob
+    {
+        FName Name;
+        int32 Priority = 0;
+        FABCTTabJob Work;
+        bool bEverySession = false;
+        bool bDoneThisSession = false;
+        FDelegateHandle Handle;
+    };
+
+    /**
+     * FScheduler
+     *
+     * Owns the job list and the worker thread. The list is guarded by JobsLock; RunLock is held
+     * for the duration of a slice so RemoveJob can wait one out.
+     */
+    class FScheduler : public FRunnable
+    {
+    public:
+        static FScheduler &Get()
+        {
+            static FScheduler Scheduler;
+            return Scheduler;
+        }
+
+        FDelegateHandle AddJob(FName Name, int32 Priority, FABCTTabJob &&Work, bool bEverySession)
+        {
+            LLM_SCOPE_BYTAG(ABCT_Queues);
+            TSharedRef<FJob> Job = MakeShared<FJob>();
+            Job->Name = Name;
+            Job->Priority = Priority;
+            Job->Work = MoveTemp(Work);
+            Job->bEverySession = bEverySession;
+            Job->Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+            {
+                FScopeLock Lock(&JobsLock);
+                // Highest priority first, registration order within a priority
+                int32 InsertAt = 0;
+                while (InsertAt < Jobs.Num() && Jobs[InsertAt]->Priority >= Priority)
+                {
+                    ++InsertAt;
+                }
+                Jobs.Insert(Job, InsertAt);
+                UpdateTrackedBytes();
+            }
+            UpdatePendingGauge();
+            StartThread();
+            WakeWorker();
+            return Job->Handle;
+        }
+
+        void RemoveJob(FDelegateHandle Handle)
+        {
+            {
+                FScopeLock Lock(&JobsLock);
+                Jobs.RemoveAll([Handle](const TSharedRef<FJob> &Job)
+                               { return Job->Handle == Handle; });
+                UpdateTrackedBytes();
+            }
+            // A slice of the job may be running; it is not picked again once removed
+            FScopeLock WaitForSlice(&RunLock);
+            UpdatePendingGauge();
+        }
+
+        int32 NumPending()
+        {
+            FScopeLock Lock(&JobsLock);
+            int32 Pending = 0;
+            for (const TSharedRef<FJob> &Job : Jobs)
+            {
+                Pending += Job->bDoneThisSession ? 0 : 1;
+            }
+            return Pending;
+        }
+
+        void SetConfig(const FABCTTabJobConfig &InConfig)
+        {
+            FScopeLock Lock(&JobsLock);
+            Config = InConfig;
+            Config.CpuBudget = FMath::Clamp(Config.CpuBudget, 0.01f, 1.0f);
+        }
+
+        FABCTTabJobConfig GetConfig()
+        {
+            FScopeLock Lock(&JobsLock);
+            return Config;
+        }
+
+        void OnTabStateChanged(const FABCTTabStateSnapshot &Snapshot)
+        {
+            if (Snapshot.IsOpen() && !bSessionOpen)
+            {
+                BeginSession();
+            }
+            else if (!Snapshot.IsOpen() && bSessionOpen)
+            {
+                EndSession();
+            }
+
+            const bool bCovering = Snapshot.IsCoveringGame();
+            if (bCovering)
+            {
+                WakeWorker();
+            }
+            SetFastPSOPrecompile(bCovering && GetConfig().bFastPSOPrecompile);
+        }
+
+        FABCTTabJobSessionStats GetSessionStats() const
+        {
+            FABCTTabJobSessionStats Stats;
+            Stats.SlicesRun = SessionSlices.load(std::memory_order_relaxed);
+            Stats.JobsCompleted = SessionJobsCompleted.load(std::memory_order_relaxed);
+            Stats.WorkMillis = SessionWorkMicros.load(std::memory_order_relaxed) / 1000.0f;
+            return Stats;
+        }
+
+        FABCTTabJobSessionStats GetLastSessionStats() const
+        {
+            return LastSession;
+        }
+
+        void Shutdown()
+        {
+            if (Thread)
+            {
+                // Kill(true) calls Stop() and waits for Run() to return
+                Thread->Kill(true);
+                delete Thread;
+                Thread = nullptr;
+            }
+            if (WakeEvent)
+            {
+                FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+                WakeEvent = nullptr;
+            }
+            SetFastPSOPrecompile(false);
+
+            FScopeLock Lock(&JobsLock);
+            Jobs.Empty();
+            UpdateTrackedBytes();
+        }
+
+        // FRunnable interface
+        virtual uint32 Run() override
+        {
+            while (!bStopRequested.load(std::memory_order_relaxed))
+            {
+                TSharedPtr<FJob> Job = ABCTTabState::Read().IsCoveringGame() ? PickJob() : nullptr;
+                if (!Job.IsValid())
+                {
+                    WakeEvent->Wait(IdleWaitMillis);
+                    continue;
+                }
+
+                const FABCTTabJobConfig SliceConfig = GetConfig();
+                const double ElapsedSeconds = RunSlice(*Job, SliceConfig);
+
+                // Idle long enough after each slice to stay within the CPU budget, and never less
+                // than MinIdleSeconds so short slices are throttled too
+                const double IdleSeconds = FMath::Max(MinIdleSeconds, ElapsedSeconds * (1.0 / SliceConfig.CpuBudget - 1.0));
+                WakeEvent->Wait(FTimespan::FromSeconds(IdleSeconds));
+            }
+            return 0;
+        }
+
+        virtual void Stop() override
+        {
+            bStopRequested = true;
+            WakeWorker();
+        }
+
+    private:
+        FScheduler()
+            : Thread(nullptr), WakeEvent(nullptr), bStopRequested(false), bSessionOpen(false), bFastPSOPrecompile(false), GameBatchMode(FShaderPipelineCache::BatchMode::Background)
+        {
+        }
+
+        void StartThread()
+        {
+            if (Thread)
+            {
+                return;
+            }
+            WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+            bStopRequested = false;
+            Thread = FRunnableThread::Create(this, TEXT("ABCT Tab Jobs"), 128 * 1024, TPri_Lowest);
+        }
+
+        void WakeWorker()
+        {
+            if (WakeEvent)
+            {
+                WakeEvent->Trigger();
+            }
+        }
+
+        TSharedPtr<FJob> PickJob()
+        {
+            FScopeLock Lock(&JobsLock);
+            for (const TSharedRef<FJob> &Job : Jobs)
+            {
+                if (!Job->bDoneThisSession)
+                {
+                    return Job;
+                }
+            }
+            return nullptr;
+        }
+
+        /** Runs one slice of Job and returns how long it took */
+        double RunSlice(FJob &Job, const FABCTTabJobConfig &SliceConfig)
+        {
+            FScopeLock Running(&RunLock);
+            {
+                // Removed since it was picked
+                FScopeLock Lock(&JobsLock);
+                if (!Jobs.ContainsByPredicate([&Job](const TSharedRef<FJob> &Entry)
+                                              { return &Entry.Get() == &Job; }))
+                {
+                    return 0.0;
+                }
+            }
+
+            const double StartSeconds = FPlatformTime::Seconds();
+            FABCTTabJobContext Context;
+            Context.DeadlineSeconds = StartSeconds + SliceConfig.SliceMillis / 1000.0;
+            const EABCTTabJobResult Result = Job.Work(Context);
+            const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+
+            const uint64 ElapsedMicros = (uint64)(ElapsedSeconds * 1000000.0);
+            ABCTStats::Increment(EABCTCounter::TabJobSlicesRun);
+            ABCTStats::Increment(EABCTCounter::TabJobMicros, ElapsedMicros);
+            SessionSlices.fetch_add(1, std::memory_order_relaxed);
+            SessionWorkMicros.fetch_add(ElapsedMicros, std::memory_order_relaxed);
+
+            if (Result == EABCTTabJobResult::Done)
+            {
+                // Counted before the job leaves the pending set, so NumPending() == 0 implies the stats are in
+                ABCTStats::Increment(EABCTCounter::TabJobsCompleted);
+                SessionJobsCompleted.fetch_add(1, std::memory_order_relaxed);
+                {
+                    FScopeLock Lock(&JobsLock);
+                    if (Job.bEverySession)
+                    {
+                        Job.bDoneThisSession = true;
+                    }
+                    else
+                    {
+                        Jobs.RemoveAll([&Job](const TSharedRef<FJob> &Entry)
+                                       { return &Entry.Get() == &Job; });
+                        UpdateTrackedBytes();
+                    }
+                }
+                UpdatePendingGauge();
+            }
+            return ElapsedSeconds;
+        }
+
+        void BeginSession()
+        {
+            bSessionOpen = true;
+            SessionSlices = 0;
+            SessionJobsCompleted = 0;
+            SessionWorkMicros = 0;
+            {
+                FScopeLock Lock(&JobsLock);
+                for (const TSharedRef<FJob> &Job : Jobs)
+                {
+                    Job->bDoneThisSession = false;
+                }
+            }
+            UpdatePendingGauge();
+        }
+
+        void EndSession()
+        {
+            bSessionOpen = false;
+            LastSession = GetSessionStats();
+            ABCTStats::RecordHistogram(EABCTHistogram::TabJobSessionWorkMicros, SessionWorkMicros.load(std::memory_order_relaxed));
+        }
+
+        void UpdatePendingGauge()
+        {
+            ABCTStats::SetGauge(EABCTGauge::TabJobsPending, NumPending());
+        }
+
+        /** Reports the job list to the Queues pool; JobsLock must be held. Closure captures are not seen. */
+        void UpdateTrackedBytes()
+        {
+            const int64 Bytes = Jobs.GetAllocatedSize() + Jobs.Num() * (int64)sizeof(FJob);
+            ABCTMemory::Track(EABCTMemoryPool::Queues, Bytes - TrackedBytes);
+            TrackedBytes = Bytes;
+        }
+
+        void SetFastPSOPrecompile(bool bFast)
+        {
+            if (bFast == bFastPSOPrecompile)
+            {
+                return;
+            }
+            // Only undo the mode this scheduler set, back to the one the game had
+            bFastPSOPrecompile = bFast;
+            FShaderPipelineCache::SetBatchMode(bFast ? FShaderPipelineCache::BatchMode::Fast : GameBatchMode);
+        }
+
+        void SetGameBatchMode(FShaderPipelineCache::BatchMode Mode)
+        {
+            GameBatchMode = Mode;
+            // While the tab is up the fast mode stays; Mode is applied once it hides
+            if (!bFastPSOPrecompile)
+            {
+                FShaderPipelineCache::SetBatchMode(Mode);
+            }
+        }
+
+        TArray<TSharedRef<FJob>> Jobs;
+        FABCTTabJobConfig Config;
+        FCriticalSection JobsLock;
+        FCriticalSection RunLock;
+
+        FRunnableThread *Thread;
+        FEvent *WakeEvent;
+        std::atomic<bool> bStopRequested;
+
+        /** Bytes of Jobs counted in ABCTMemory; guarded by JobsLock */
+        int64 TrackedBytes = 0;
+
+        /** Game thread only */
+        bool bSessionOpen;
+        bool bFastPSOPrecompile;
+        /** Batch mode to restore when the tab hides; the engine does not expose the current one */
+        FShaderPipelineCache::BatchMode GameBatchMode;
+        FABCTTabJobSessionStats LastSession;
+
+        std::atomic<int32> SessionSlices{0};
+        std::atomic<int32> SessionJobsCompleted{0};
+        std::atomic<uint64> SessionWorkMicros{0};
+    };
+}
+
+// ============================================================================
+// FABCTTabJobContext
+// ============================================================================
+
+bool FABCTTabJobContext::ShouldYield() const
+{
+    return FPlatformTime::Seconds() >= DeadlineSeconds || !ABCTTabState::Read().IsCoveringGame();
+}
+
+// ============================================================================
+// ABCTTabJobs
+// ============================================================================
+
+namespace ABCTTabJobs
+{
+    FDelegateHandle AddJob(FName Name, int32 Priority, FABCTTabJob Job, bool bEverySession)
+    {
+        check(IsInGameThread());
+        return FScheduler::Get().AddJob(Name, Priority, MoveTemp(Job), bEverySession);
+    }
+
+    void RemoveJob(FDelegateHandle Handle)
+    {
+        check(IsInGameThread());
+        FScheduler::Get().RemoveJob(Handle);
+    }
+
+    int32 NumPending()
+    {
+        return FScheduler::Get().NumPending();
+    }
+
+    void SetConfig(const FABCTTabJobConfig &Config)
+    {
+        FScheduler::Get().SetConfig(Config);
+    }
+
+    FABCTTabJobConfig GetConfig()
+    {
+        return FScheduler::Get().GetConfig();
+    }
+
+    void OnTabStateChanged(const FABCTTabStateSnapshot &Snapshot)
+    {
+        check(IsInGameThread());
+        FScheduler::Get().OnTabStateChanged(Snapshot);
+    }
+
+    void SetPSOBatchMode(FShaderPipelineCache::BatchMode Mode)
+    {
+        check(IsInGameThread());
+        FScheduler::Get().SetGameBatchMode(Mode);
+    }
+
+    FABCTTabJobSessionStats GetSessionStats()
+    {
+        return FScheduler::Get().GetSessionStats();
+    }
+
+    FABCTTabJobSessionStats GetLastSessionStats()
+    {
+        return FScheduler::Get().GetLastSessionStats();
+    }
+
+    void Shutdown()
+    {
+        FScheduler::Get().Shutdown();
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Tab state snapshot readable from any thread.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_TabState.h"
+#include <atomic>
+
+namespace
+{
+    /**
+     * Seqlock storage. Sequence is odd while a publish is in progress. The payload words are
+     * relaxed atomics so a torn read is merely discarded rather than a data race.
+     */
+    struct FTabStateSeqlock
+    {
+        std::atomic<uint32> Sequence{0};
+        std::atomic<uint64> LifecycleAndUrl{0};
+        std::atomic<uint64> OpenedCycles{0};
+        std::atomic<uint64> LifecycleChangedCycles{0};
+    };
+
+    FTabStateSeqlock State;
+
+    uint64 Pack(EABCTTabLifecycle Lifecycle, uint32 UrlId)
+    {
+        return ((uint64)Lifecycle << 32) | UrlId;
+    }
+}
+
+namespace ABCTTabState
+{
+    FABCTTabStateSnapshot Read()
+    {
+        FABCTTabStateSnapshot Snapshot;
+        for (;;)
+        {
+            const uint32 Before = State.Sequence.load(std::memory_order_acquire);
+            if (Before & 1)
+            {
+                FPlatformProcess::Yield();
+                continue;
+            }
+
+            const uint64 LifecycleAndUrl = State.LifecycleAndUrl.load(std::memory_order_relaxed);
+            Snapshot.OpenedCycles = State.OpenedCycles.load(std::memory_order_relaxed);
+            Snapshot.LifecycleChangedCycles = State.LifecycleChangedCycles.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (State.Sequence.load(std::memory_order_relaxed) == Before)
+            {
+                Snapshot.Lifecycle = (EABCTTabLifecycle)(LifecycleAndUrl >> 32);
+                Snapshot.UrlId = (uint32)LifecycleAndUrl;
+                Snapshot.Sequence = Before / 2;
+                return Snapshot;
+            }
+        }
+    }
+
+    void Publish(const FABCTTabStateSnapshot &Snapshot)
+    {
+        check(IsInGameThread());
+
+        const uint32 Sequence = State.Sequence.load(std::memory_order_relaxed);
+        State.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        State.LifecycleAndUrl.store(Pack(Snapshot.Lifecycle, Snapshot.UrlId), std::memory_order_relaxed);
+        State.OpenedCycles.store(Snapshot.OpenedCycles, std::memory_order_relaxed);
+        State.LifecycleChangedCycles.store(Snapshot.LifecycleChangedCycles, std::memory_order_relaxed);
+
+        State.Sequence.store(Sequence + 2, std::memory_order_release);
+    }
+}
@@ -0,0 +1,443 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Hierarchical timer wheel for plugin timeouts and retries.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_TimerWheel.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+
+namespace
+{
+    constexpr uint64 SlotMask = FABCTTimerWheel::SlotsPerLevel - 1;
+
+    /** Ticks covered by levels below Level (the span of one Level slot) */
+    constexpr uint64 LevelSpan(int32 Level)
+    {
+        return 1ull << (FABCTTimerWheel::SlotBits * Level);
+    }
+
+    /** Rotates Bits right so that bit Shift becomes bit 0 */
+    uint64 RotateRight(uint64 Bits, uint32 Shift)
+    {
+        Shift &= 63;
+        return Shift == 0 ? Bits : (Bits >> Shift) | (Bits << (64 - Shift));
+    }
+}
+
+// ============================================================================
+// FABCTTimerWheel
+// ============================================================================
+
+FABCTTimerWheel::FABCTTimerWheel()
+    : CurrentTick(0), NumScheduled(0), NextSerial(1)
+{
+    for (int32 List = 0; List < NumLists; ++List)
+    {
+        Heads[List] = INDEX_NONE;
+        Tails[List] = INDEX_NONE;
+    }
+    FMemory::Memzero(Occupied);
+}
+
+FABCTTimerHandle FABCTTimerWheel::Add(uint64 DelayTicks, TFunction<void()> Callback, uint64 RepeatTicks)
+{
+    const int32 Index = FreeTimers.IsEmpty() ? Timers.AddDefaulted() : FreeTimers.Pop(EAllowShrinking::No);
+    FTimer &Timer = Timers[Index];
+    Timer.Callback = MoveTemp(Callback);
+    Timer.ExpiryTick = CurrentTick + DelayTicks;
+    Timer.RepeatTicks = RepeatTicks;
+    Timer.Serial = NextSerial++;
+    ++NumScheduled;
+
+    if (DelayTicks == 0)
+    {
+        // Not into the current tick's slot, which has already fired
+        PushBack(DueList, Index);
+    }
+    else
+    {
+        Schedule(Index);
+    }
+
+    FABCTTimerHandle Handle;
+    Handle.Id = (uint32)Index + 1;
+    Handle.Serial = Timer.Serial;
+    return Handle;
+}
+
+bool FABCTTimerWheel::Cancel(FABCTTimerHandle &Handle)
+{
+    const int32 Index = Find(Handle);
+    Handle.Invalidate();
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    FTimer &Timer = Timers[Index];
+    if (Timer.List == INDEX_NONE)
+    {
+        // Firing: Fire frees it once the callback returns instead of scheduling it again
+        const bool bWasRepeating = Timer.RepeatTicks > 0;
+        Timer.RepeatTicks = 0;
+        return bWasRepeating;
+    }
+
+    Unlink(Index);
+    Free(Index);
+    return true;
+}
+
+bool FABCTTimerWheel::IsActive(const FABCTTimerHandle &Handle) const
+{
+    const int32 Index = Find(Handle);
+    return Index != INDEX_NONE && (Timers[Index].List != INDEX_NONE || Timers[Index].RepeatTicks > 0);
+}
+
+int64 FABCTTimerWheel::GetRemainingTicks(const FABCTTimerHandle &Handle) const
+{
+    if (!IsActive(Handle))
+    {
+        return -1;
+    }
+    const FTimer &Timer = Timers[Handle.Id - 1];
+    return Timer.List == INDEX_NONE ? (int64)Timer.RepeatTicks : (int64)(Timer.ExpiryTick - FMath::Min(Timer.ExpiryTick, CurrentTick));
+}
+
+int32 FABCTTimerWheel::AdvanceTo(uint64 Tick)
+{
+    int32 Fired = Fire(DueList, Tick);
+
+    while (CurrentTick < Tick)
+    {
+        // Ticks before the next occupied slot would neither fire nor cascade anything
+        const uint64 NextTick = FindNextEventTick();
+        if (NextTick > Tick)
+        {
+            CurrentTick = Tick;
+            break;
+        }
+        CurrentTick = NextTick;
+
+        if ((CurrentTick & SlotMask) == 0)
+        {
+            // Level 0 wrapped; bring down the next slot of every level that wrapped with it,
+            // coarsest first so its timers can fall through the finer levels in this tick
+            int32 TopLevel = 1;
+            while (TopLevel < NumLevels && (CurrentTick & (LevelSpan(TopLevel + 1) - 1)) == 0)
+            {
+                ++TopLevel;
+            }
+            if (TopLevel == NumLevels)
+            {
+                Cascade(OverflowList);
+                TopLevel = NumLevels - 1;
+            }
+            for (int32 Level = TopLevel; Level >= 1; --Level)
+            {
+                Cascade(Level * SlotsPerLevel + (int32)((CurrentTick >> (SlotBits * Level)) & SlotMask));
+            }
+        }
+
+        Fired += Fire((int32)(CurrentTick & SlotMask), Tick);
+    }
+    return Fired;
+}
+
+uint64 FABCTTimerWheel::FindNextEventTick() const
+{
+    uint64 NextTick = MAX_uint64;
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        if (Occupied[Level] == 0)
+        {
+            continue;
+        }
+        // Slots after the current one come first; the current slot's bit means its next turn
+        const uint64 LevelTick = CurrentTick >> (SlotBits * Level);
+        const uint64 Rotated = RotateRight(Occupied[Level], (uint32)((LevelTick + 1) & SlotMask));
+        const uint64 Slots = FMath::CountTrailingZeros64(Rotated) + 1;
+        NextTick = FMath::Min(NextTick, (LevelTick + Slots) << (SlotBits * Level));
+    }
+    if (Heads[OverflowList] != INDEX_NONE)
+    {
+        const int32 TopBits = SlotBits * NumLevels;
+        NextTick = FMath::Min(NextTick, ((CurrentTick >> TopBits) + 1) << TopBits);
+    }
+    return NextTick;
+}
+
+void FABCTTimerWheel::Reset()
+{
+    Timers.Empty();
+    FreeTimers.Empty();
+    for (int32 List = 0; List < NumLists; ++List)
+    {
+        Heads[List] = INDEX_NONE;
+        Tails[List] = INDEX_NONE;
+    }
+    FMemory::Memzero(Occupied);
+    NumScheduled = 0;
+}
+
+int32 FABCTTimerWheel::Find(const FABCTTimerHandle &Handle) const
+{
+    const int32 Index = (int32)Handle.Id - 1;
+    if (!Handle.IsValid() || !Timers.IsValidIndex(Index) || Timers[Index].Serial != Handle.Serial)
+    {
+        return INDEX_NONE;
+    }
+    return Index;
+}
+
+void FABCTTimerWheel::Schedule(int32 Index)
+{
+    const uint64 ExpiryTick = Timers[Index].ExpiryTick;
+    const uint64 Delta = ExpiryTick - FMath::Min(ExpiryTick, CurrentTick);
+
+    for (int32 Level = 0; Level < NumLevels; ++Level)
+    {
+        if (Delta < LevelSpan(Level + 1))
+        {
+            PushBack(Level * SlotsPerLevel + (int32)((ExpiryTick >> (SlotBits * Level)) & SlotMask), Index);
+            return;
+        }
+    }
+    PushBack(OverflowList, Index);
+}
+
+void FABCTTimerWheel::Cascade(int32 List)
+{
+    // Detach the whole slot first: a timer can land back in the same list index
+    int32 Index = Heads[List];
+    Heads[List] = INDEX_NONE;
+    Tails[List] = INDEX_NONE;
+    if (List < OverflowList)
+    {
+        Occupied[List / SlotsPerLevel] &= ~(1ull << (List % SlotsPerLevel));
+    }
+    while (Index != INDEX_NONE)
+    {
+        const int32 Next = Timers[Index].Next;
+        Timers[Index].Prev = INDEX_NONE;
+        Timers[Index].Next = INDEX_NONE;
+        Timers[Index].List = INDEX_NONE;
+        Schedule(Index);
+        Index = Next;
+    }
+}
+
+int32 FABCTTimerWheel::Fire(int32 List, uint64 TargetTick)
+{
+    if (Heads[List] == INDEX_NONE)
+    {
+        return 0;
+    }
+
+    // Move the timers out first; ones the callbacks add with no delay go back to DueList for the next advance
+    while (Heads[List] != INDEX_NONE)
+    {
+        const int32 Index = Heads[List];
+        Unlink(Index);
+        PushBack(FiringList, Index);
+    }
+
+    int32 Fired = 0;
+    while (Heads[FiringList] != INDEX_NONE)
+    {
+        const int32 Index = Heads[FiringList];
+        Unlink(Index);
+
+        // The pool can grow during the callback, so nothing may hold a reference into it
+        TFunction<void()> Callback = MoveTemp(Timers[Index].Callback);
+        Callback();
+        ++Fired;
+
+        FTimer &Timer = Timers[Index];
+        if (Timer.RepeatTicks > 0)
+        {
+            // From where the advance ends, not from this tick, so a catch-up fires it only once
+            Timer.Callback = MoveTemp(Callback);
+            Timer.ExpiryTick = FMath::Max(CurrentTick, TargetTick) + Timer.RepeatTicks;
+            Schedule(Index);
+        }
+        else
+        {
+            Free(Index);
+        }
+    }
+    return Fired;
+}
+
+void FABCTTimerWheel::PushBack(int32 List, int32 Index)
+{
+    FTimer &Timer = Timers[Index];
+    Timer.List = List;
+    Timer.Prev = Tails[List];
+    Timer.Next = INDEX_NONE;
+    if (Tails[List] != INDEX_NONE)
+    {
+        Timers[Tails[List]].Next = Index;
+    }
+    else
+    {
+        Heads[List] = Index;
+        if (List < OverflowList)
+        {
+            Occupied[List / SlotsPerLevel] |= 1ull << (List % SlotsPerLevel);
+        }
+    }
+    Tails[List] = Index;
+}
+
+void FABCTTimerWheel::Unlink(int32 Index)
+{
+    FTimer &Timer = Timers[Index];
+    const int32 List = Timer.List;
+    if (Timer.Prev != INDEX_NONE)
+    {
+        Timers[Timer.Prev].Next = Timer.Next;
+    }
+    else
+    {
+        Heads[List] = Timer.Next;
+    }
+    if (Timer.Next != INDEX_NONE)
+    {
+        Timers[Timer.Next].Prev = Timer.Prev;
+    }
+    else
+    {
+        Tails[List] = Timer.Prev;
+    }
+    if (Heads[List] == INDEX_NONE && List < OverflowList)
+    {
+        Occupied[List / SlotsPerLevel] &= ~(1ull << (List % SlotsPerLevel));
+    }
+    Timer.Prev = INDEX_NONE;
+    Timer.Next = INDEX_NONE;
+    Timer.List = INDEX_NONE;
+}
+
+void FABCTTimerWheel::Free(int32 Index)
+{
+    FTimer &Timer = Timers[Index];
+    Timer.Callback.Reset();
+    Timer.RepeatTicks = 0;
+    Timer.Serial = 0;
+    FreeTimers.Add(Index);
+    --NumScheduled;
+}
+
+// ============================================================================
+// ABCTTimers
+// ============================================================================
+
+namespace
+{
+    struct FPluginTimers
+    {
+        FABCTTimerWheel Wheel;
+
+        /** FPlatformTime::Seconds of tick 0 */
+        double OriginSeconds = FPlatformTime::Seconds();
+
+        /** Bytes of the wheel counted in ABCTMemory */
+        int64 TrackedBytes = 0;
+
+        /** First tick that starts at or after Seconds */
+        uint64 TickAtOrAfter(double Seconds) const
+        {
+            return (uint64)FMath::Max(0.0, FMath::CeilToDouble((Seconds - OriginSeconds) / ABCTTimers::TickSeconds));
+        }
+    };
+
+    FPluginTimers &GetPluginTimers()
+    {
+        static FPluginTimers Timers;
+        return Timers;
+    }
+
+    void UpdateGauge(FPluginTimers &Timers)
+    {
+        ABCTStats::SetGauge(EABCTGauge::TimersScheduled, Timers.Wheel.Num());
+
+        const int64 Bytes = (int64)Timers.Wheel.GetAllocatedSize();
+        ABCTMemory::Track(EABCTMemoryPool::Queues, Bytes - Timers.TrackedBytes);
+        Timers.TrackedBytes = Bytes;
+    }
+}
+
+namespace ABCTTimers
+{
+    FABCTTimerHandle SetTimer(double DelaySeconds, TFunction<void()> Callback, double RepeatSeconds)
+    {
+        check(IsInGameThread());
+        FPluginTimers &Timers = GetPluginTimers();
+
+        // Due from the actual time, not the start of the current tick, so it never fires early
+        uint64 DelayTicks = 0;
+        if (DelaySeconds > 0.0)
+        {
+            const uint64 DueTick = Timers.TickAtOrAfter(FPlatformTime::Seconds() + DelaySeconds);
+            DelayTicks = FMath::Max<uint64>(1, DueTick - FMath::Min(DueTick, Timers.Wheel.GetCurrentTick()));
+        }
+        const uint64 RepeatTicks = RepeatSeconds > 0.0 ? FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(RepeatSeconds / TickSeconds)) : 0;
+
+        LLM_SCOPE_BYTAG(ABCT_Queues);
+        const FABCTTimerHandle Handle = Timers.Wheel.Add(DelayTicks, MoveTemp(Callback), RepeatTicks);
+        UpdateGauge(Timers);
+        return Handle;
+    }
+
+    bool ClearTimer(FABCTTimerHandle &Handle)
+    {
+        if (!Handle.IsValid())
+        {
+            return false;
+        }
+        check(IsInGameThread());
+        FPluginTimers &Timers = GetPluginTimers();
+        const bool bCleared = Timers.Wheel.Cancel(Handle);
+        UpdateGauge(Timers);
+        return bCleared;
+    }
+
+    bool IsTimerActive(const FABCTTimerHandle &Handle)
+    {
+        return Handle.IsValid() && GetPluginTimers().Wheel.IsActive(Handle);
+    }
+
+    double GetTimerRemaining(const FABCTTimerHandle &Handle)
+    {
+        const int64 Ticks = Handle.IsValid() ? GetPluginTimers().Wheel.GetRemainingTicks(Handle) : -1;
+        return Ticks < 0 ? -1.0 : Ticks * TickSeconds;
+    }
+
+    int32 NumTimers()
+    {
+        return GetPluginTimers().Wheel.Num();
+    }
+
+    void Tick()
+    {
+        check(IsInGameThread());
+        FPluginTimers &Timers = GetPluginTimers();
+        const double ElapsedSeconds = FPlatformTime::Seconds() - Timers.OriginSeconds;
+        const int32 Fired = Timers.Wheel.AdvanceTo((uint64)FMath::Max(0.0, ElapsedSeconds / TickSeconds));
+        if (Fired > 0)
+        {
+            ABCTStats::Increment(EABCTCounter::TimersFired, Fired);
+            UpdateGauge(Timers);
+        }
+    }
+
+    void Shutdown()
+    {
+        FPluginTimers &Timers = GetPluginTimers();
+        Timers.Wheel.Reset();
+        UpdateGauge(Timers);
+    }
+}
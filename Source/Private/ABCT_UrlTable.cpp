@@ -0,0 +1,343 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - URL canonicalization and interning.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_UrlTable.h"
+#include "ABCT_Memory.h"
+#include "ABCT_Stats.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+    bool IsSchemeChar(TCHAR Char, bool bFirst)
+    {
+        return FChar::IsAlpha(Char) || (!bFirst && (FChar::IsDigit(Char) || Char == TEXT('+') || Char == TEXT('-') || Char == TEXT('.')));
+    }
+
+    int32 GetDefaultPort(FStringView Scheme)
+    {
+        if (Scheme == TEXTVIEW("https") || Scheme == TEXTVIEW("wss"))
+        {
+            return 443;
+        }
+        if (Scheme == TEXTVIEW("http") || Scheme == TEXTVIEW("ws"))
+        {
+            return 80;
+        }
+        return -1;
+    }
+
+    void AppendLower(FStringBuilderBase &Builder, FStringView Text)
+    {
+        for (TCHAR Char : Text)
+        {
+            Builder.AppendChar(FChar::ToLower(Char));
+        }
+    }
+
+    /** Index of the first of Chars in Text at or after Start, or Text.Len() */
+    int32 FindFirstOf(FStringView Text, int32 Start, FStringView Chars)
+    {
+        for (int32 Index = Start; Index < Text.Len(); ++Index)
+        {
+            for (TCHAR Char : Chars)
+            {
+                if (Text[Index] == Char)
+                {
+                    return Index;
+                }
+            }
+        }
+        return Text.Len();
+    }
+
+    /** Case-sensitive hash of the exact characters (GetTypeHash on strings ignores case) */
+    uint32 HashText(FStringView Text)
+    {
+        return CityHash32((const char *)Text.GetData(), Text.Len() * sizeof(TCHAR));
+    }
+
+    /** Bytes an interned URL holds, counted against the Caches pool */
+    int64 EntryBytes(const FABCTUrl &Url)
+    {
+        return sizeof(FABCTUrl) + Url.GetCanonical().GetAllocatedSize();
+    }
+}
+
+// ============================================================================
+// Canonicalization
+// ============================================================================
+
+FABCTUrl::FABCTUrl(FStringView URL)
+    : Port(-1), Id(0)
+{
+    URL = URL.TrimStartAndEnd();
+
+    int32 Colon = 0;
+    while (Colon < URL.Len() && IsSchemeChar(URL[Colon], Colon == 0))
+    {
+        ++Colon;
+    }
+    if (Colon == 0 || Colon >= URL.Len() || URL[Colon] != TEXT(':'))
+    {
+        // No scheme: nothing to canonicalize
+        Canonical = FString(URL);
+        PathRange = {0, Canonical.Len()};
+        return;
+    }
+
+    TStringBuilder<256> Builder;
+    AppendLower(Builder, URL.Left(Colon));
+    SchemeRange = {0, Colon};
+    const FStringView Rest = URL.Mid(Colon + 1);
+
+    if (!Rest.StartsWith(TEXTVIEW("//")))
+    {
+        Builder.AppendChar(TEXT(':'));
+        PathRange = {Builder.Len(), Rest.Len()};
+        Builder.Append(Rest);
+        Canonical = Builder.ToString();
+        return;
+    }
+
+    // Authority: [userinfo@]host[:port]
+    const int32 AuthorityEnd = FindFirstOf(Rest, 2, TEXTVIEW("/?#"));
+    FStringView HostPort = Rest.Mid(2, AuthorityEnd - 2);
+    int32 At = INDEX_NONE;
+    if (HostPort.FindLastChar(TEXT('@'), At))
+    {
+        HostPort.RightChopInline(At + 1);
+    }
+
+    // IPv6 literals keep their brackets and colons
+    int32 HostSearchStart = 0;
+    if (HostPort.StartsWith(TEXT('[')) && !HostPort.FindChar(TEXT(']'), HostSearchStart))
+    {
+        HostSearchStart = 0;
+    }
+    int32 PortColon = HostPort.Len();
+    for (int32 Index = HostSearchStart; Index < HostPort.Len(); ++Index)
+    {
+        if (HostPort[Index] == TEXT(':'))
+        {
+            PortColon = Index;
+            break;
+        }
+    }
+    const FStringView Host = HostPort.Left(PortColon);
+    const FStringView PortText = HostPort.Mid(PortColon + 1);
+
+    const int32 DefaultPort = GetDefaultPort(FStringView(Builder.GetData(), Colon));
+    Port = DefaultPort;
+    bool bExplicitPort = false;
+    if (!PortText.IsEmpty())
+    {
+        int32 ParsedPort = 0;
+        bool bValidPort = PortText.Len() <= 5;
+        for (TCHAR Char : PortText)
+        {
+            bValidPort &= FChar::IsDigit(Char);
+            ParsedPort = ParsedPort * 10 + (Char - TEXT('0'));
+        }
+        if (!bValidPort || ParsedPort > MAX_uint16)
+        {
+            // Not a URL (https://host:99999/, https://host:abc/): keep it as-is, like a string
+            // without a scheme, so it has no origin to match
+            Canonical = FString(URL);
+            SchemeRange = FRange();
+            PathRange = {0, Canonical.Len()};
+            Port = -1;
+            return;
+        }
+        Port = ParsedPort;
+        bExplicitPort = ParsedPort != DefaultPort;
+    }
+
+    Builder.Append(TEXTVIEW("://"));
+    HostRange.Start = Builder.Len();
+    AppendLower(Builder, Host);
+    HostRange.Len = Builder.Len() - HostRange.Start;
+    if (bExplicitPort)
+    {
+        Builder.Appendf(TEXT(":%d"), Port);
+    }
+    OriginRange = {0, Builder.Len()};
+
+    // Path, query, fragment
+    const int32 QueryStart = FindFirstOf(Rest, AuthorityEnd, TEXTVIEW("?#"));
+    const int32 FragmentStart = FindFirstOf(Rest, QueryStart, TEXTVIEW("#"));
+
+    PathRange.Start = Builder.Len();
+    if (QueryStart == AuthorityEnd)
+    {
+        Builder.AppendChar(TEXT('/'));
+    }
+    else
+    {
+        Builder.Append(Rest.Mid(AuthorityEnd, QueryStart - AuthorityEnd));
+    }
+    PathRange.Len = Builder.Len() - PathRange.Start;
+
+    if (FragmentStart - QueryStart > 1)
+    {
+        Builder.AppendChar(TEXT('?'));
+        QueryRange = {Builder.Len(), FragmentStart - QueryStart - 1};
+        Builder.Append(Rest.Mid(QueryStart + 1, QueryRange.Len));
+    }
+    if (Rest.Len() - FragmentStart > 1)
+    {
+        Builder.AppendChar(TEXT('#'));
+        FragmentRange = {Builder.Len(), Rest.Len() - FragmentStart - 1};
+        Builder.Append(Rest.Mid(FragmentStart + 1));
+    }
+
+    Canonical = Builder.ToString();
+}
+
+// ============================================================================
+// Intern Table
+// ============================================================================
+
+class FABCTUrlTableImpl
+{
+public:
+    static FABCTUrlTableImpl &Get()
+    {
+        static FABCTUrlTableImpl Table;
+        return Table;
+    }
+
+    FABCTUrlTableImpl()
+        : NextId(1), Count(0)
+    {
+        Slots.SetNum(ABCTUrlTable::MaxEntries);
+    }
+
+    FABCTUrlRef Intern(FStringView URL)
+    {
+        if (URL.TrimStartAndEnd().IsEmpty())
+        {
+            return nullptr;
+        }
+        LLM_SCOPE_BYTAG(ABCT_Caches);
+
+        // Browsers mostly report URLs that are already canonical: try the raw text first
+        {
+            FReadScopeLock ReadLock(Lock);
+            if (FABCTUrlRef Existing = FindLocked(URL, HashText(URL)))
+            {
+                return Existing;
+            }
+        }
+
+        TSharedRef<FABCTUrl, ESPMode::ThreadSafe> Parsed = MakeShared<FABCTUrl, ESPMode::ThreadSafe>(URL);
+        const uint32 Hash = HashText(Parsed->GetCanonical());
+
+        FWriteScopeLock WriteLock(Lock);
+        if (FABCTUrlRef Existing = FindLocked(Parsed->GetCanonical(), Hash))
+        {
+            return Existing;
+        }
+
+        // Ids are never reused; the slot's previous URL is evicted
+        Parsed->Id = NextId++;
+        FABCTUrlRef &Slot = Slots[(Parsed->Id - 1) % ABCTUrlTable::MaxEntries];
+        if (Slot.IsValid())
+        {
+            IdsByHash.RemoveSingle(HashText(Slot->GetCanonical()), Slot->GetId());
+            ABCTMemory::Track(EABCTMemoryPool::Caches, -EntryBytes(*Slot));
+        }
+        else
+        {
+            ++Count;
+            ABCTStats::SetGauge(EABCTGauge::InternedUrls, Count);
+        }
+        Slot = Parsed;
+        IdsByHash.Add(Hash, Parsed->Id);
+        ABCTMemory::Track(EABCTMemoryPool::Caches, EntryBytes(*Slot));
+        return Slot;
+    }
+
+    void Trim(int32 KeepEntries)
+    {
+        FWriteScopeLock WriteLock(Lock);
+
+        // The table always holds the Count most recent ids; evict from the oldest
+        while (Count > FMath::Max(KeepEntries, 0))
+        {
+            FABCTUrlRef &Slot = Slots[(NextId - Count - 1) % ABCTUrlTable::MaxEntries];
+            if (Slot.IsValid())
+            {
+                IdsByHash.RemoveSingle(HashText(Slot->GetCanonical()), Slot->GetId());
+                ABCTMemory::Track(EABCTMemoryPool::Caches, -EntryBytes(*Slot));
+                Slot.Reset();
+            }
+            --Count;
+        }
+        IdsByHash.Compact();
+        ABCTStats::SetGauge(EABCTGauge::InternedUrls, Count);
+    }
+
+    FABCTUrlRef Find(uint32 Id)
+    {
+        if (Id == 0)
+        {
+            return nullptr;
+        }
+        FReadScopeLock ReadLock(Lock);
+        const FABCTUrlRef &Slot = Slots[(Id - 1) % ABCTUrlTable::MaxEntries];
+        return Slot.IsValid() && Slot->GetId() == Id ? Slot : nullptr;
+    }
+
+    int32 Num()
+    {
+        FReadScopeLock ReadLock(Lock);
+        return Count;
+    }
+
+private:
+    FABCTUrlRef FindLocked(FStringView Canonical, uint32 Hash) const
+    {
+        for (auto It = IdsByHash.CreateConstKeyIterator(Hash); It; ++It)
+        {
+            const FABCTUrlRef &Slot = Slots[(It.Value() - 1) % ABCTUrlTable::MaxEntries];
+            if (Slot.IsValid() && FStringView(Slot->GetCanonical()).Equals(Canonical, ESearchCase::CaseSensitive))
+            {
+                return Slot;
+            }
+        }
+        return nullptr;
+    }
+
+    FRWLock Lock;
+    TArray<FABCTUrlRef> Slots;
+    TMultiMap<uint32, uint32> IdsByHash;
+    uint32 NextId;
+    int32 Count;
+};
+
+namespace ABCTUrlTable
+{
+    FABCTUrlRef Intern(FStringView URL)
+    {
+        return FABCTUrlTableImpl::Get().Intern(URL);
+    }
+
+    FABCTUrlRef Find(uint32 Id)
+    {
+        return FABCTUrlTableImpl::Get().Find(Id);
+    }
+
+    int32 Num()
+    {
+        return FABCTUrlTableImpl::Get().Num();
+    }
+
+    void Trim(int32 KeepEntries)
+    {
+        FABCTUrlTableImpl::Get().Trim(KeepEntries);
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Generated JNI bridge.
+ * @Date: 18/10/2026
+ *
+ * GENERATED by Source/Android/Bridge/GenerateBridge.py from ABCT_Bridge.idl - do not edit.
+ */
+
+#include "ABCT_JavaBridge.h"
+
+#if PLATFORM_ANDROID
+#include "ABCT_Memory.h"
+#include "Android/AndroidApplication.h"
+#include "Android/AndroidJavaEnv.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+static_assert(sizeof(TCHAR) == sizeof(jchar), "FString must be UTF-16 to share buffers with Java strings");
+
+namespace
+{
+    struct FMethods
+    {
+        jclass Class = nullptr;
+        jmethodID OpenTab = nullptr;
+        jmethodID CloseTab = nullptr;
+        jmethodID ExecuteJava = nullptr;
+    };
+
+    /** Resolves the bridge class and every method ID once; retried until the class loader can see the class */
+    const FMethods *GetMethods(JNIEnv *Env)
+    {
+        static FMethods Methods;
+        static std::atomic<bool> bResolved(false);
+        static FCriticalSection ResolveLock;
+
+        if (Env == nullptr)
+        {
+            return nullptr;
+        }
+        if (bResolved.load(std::memory_order_acquire))
+        {
+            return &Methods;
+        }
+
+        FScopeLock Lock(&ResolveLock);
+        if (!bResolved.load(std::memory_order_relaxed))
+        {
+            jclass LocalClass = FAndroidApplication::FindJavaClass("com/epicgames/unreal/customtabs/ABCTBridge");
+            if (LocalClass == nullptr)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - ABCTBridge class not found"));
+                Env->ExceptionClear();
+                return nullptr;
+            }
+            Methods.Class = (jclass)Env->NewGlobalRef(LocalClass);
+            Env->DeleteLocalRef(LocalClass);
+
+            Methods.OpenTab = Env->GetStaticMethodID(Methods.Class, "openTab", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z");
+            if (Methods.OpenTab == nullptr)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - openTab(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z not found"));
+                Env->ExceptionClear();
+            }
+            Methods.CloseTab = Env->GetStaticMethodID(Methods.Class, "closeTab", "()V");
+            if (Methods.CloseTab == nullptr)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - closeTab()V not found"));
+                Env->ExceptionClear();
+            }
+            Methods.ExecuteJava = Env->GetStaticMethodID(Methods.Class, "executeJava", "(Ljava/lang/String;)Z");
+            if (Methods.ExecuteJava == nullptr)
+            {
+                UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - executeJava(Ljava/lang/String;)Z not found"));
+                Env->ExceptionClear();
+            }
+            bResolved.store(true, std::memory_order_release);
+        }
+        return &Methods;
+    }
+
+    /** Logs and clears a pending Java exception; returns true if there was one */
+    bool ClearException(JNIEnv *Env, const char *MethodName)
+    {
+        if (!Env->ExceptionCheck())
+        {
+            return false;
+        }
+        Env->ExceptionDescribe();
+        Env->ExceptionClear();
+        UE_LOG(LogTemp, Error, TEXT("ABCTJavaBridge - %s threw"), UTF8_TO_TCHAR(MethodName));
+        return true;
+    }
+
+    /** UTF-16 straight from FString; no UTF-8 round trip */
+    jstring NewJavaString(JNIEnv *Env, const FString &Value)
+    {
+        return Env->NewString(reinterpret_cast<const jchar *>(*Value), Value.Len());
+    }
+
+    /** Copies the UTF-16 code units of Value into a new FString with a single copy */
+    FString ToFString(JNIEnv *Env, jstring Value)
+    {
+        // Strings from Java are payloads on their way into the ingress queues
+        LLM_SCOPE_BYTAG(ABCT_Queues);
+        FString Result;
+        if (Value == nullptr)
+        {
+            return Result;
+        }
+        const jsize Length = Env->GetStringLength(Value);
+        if (Length > 0)
+        {
+            auto &Chars = Result.GetCharArray();
+            Chars.SetNumUninitialized(Length + 1);
+            Env->GetStringRegion(Value, 0, Length, reinterpret_cast<jchar *>(Chars.GetData()));
+            Chars[Length] = TEXT('\0');
+        }
+        return Result;
+    }
+}
+
+// ============================================================================
+// C++ -> Java
+// ============================================================================
+
+namespace ABCTJavaBridge
+{
+    bool OpenTab(const FString &Url, const FString &ToolbarColorHex, const FString &UserAgent, const FString &CustomHeader)
+    {
+        JNIEnv *Env = FAndroidApplication::GetJavaEnv();
+        const FMethods *Methods = GetMethods(Env);
+        if (Methods == nullptr || Methods->OpenTab == nullptr)
+        {
+            return false;
+        }
+
+        jstring jUrl = NewJavaString(Env, Url);
+        jstring jToolbarColorHex = NewJavaString(Env, ToolbarColorHex);
+        jstring jUserAgent = NewJavaString(Env, UserAgent);
+        jstring jCustomHeader = NewJavaString(Env, CustomHeader);
+        const jboolean jResult = Env->CallStaticBooleanMethod(Methods->Class, Methods->OpenTab, jUrl, jToolbarColorHex, jUserAgent, jCustomHeader);
+        Env->DeleteLocalRef(jUrl);
+        Env->DeleteLocalRef(jToolbarColorHex);
+        Env->DeleteLocalRef(jUserAgent);
+        Env->DeleteLocalRef(jCustomHeader);
+        if (ClearException(Env, "openTab"))
+        {
+            return false;
+        }
+        return jResult != JNI_FALSE;
+    }
+
+    void CloseTab()
+    {
+        JNIEnv *Env = FAndroidApplication::GetJavaEnv();
+        const FMethods *Methods = GetMethods(Env);
+        if (Methods == nullptr || Methods->CloseTab == nullptr)
+        {
+            return;
+        }
+
+        Env->CallStaticVoidMethod(Methods->Class, Methods->CloseTab);
+        ClearException(Env, "closeTab");
+    }
+
+    bool ExecuteJava(const FString &Message)
+    {
+        JNIEnv *Env = FAndroidApplication::GetJavaEnv();
+        const FMethods *Methods = GetMethods(Env);
+        if (Methods == nullptr || Methods->ExecuteJava == nullptr)
+        {
+            return false;
+        }
+
+        jstring jMessage = NewJavaString(Env, Message);
+        const jboolean jResult = Env->CallStaticBooleanMethod(Methods->Class, Methods->ExecuteJava, jMessage);
+        Env->DeleteLocalRef(jMessage);
+        if (ClearException(Env, "executeJava"))
+        {
+            return false;
+        }
+        return jResult != JNI_FALSE;
+    }
+}
+
+// ============================================================================
+// Java -> C++
+// ============================================================================
+
+extern "C"
+{
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnTabOpened(JNIEnv *Env, jclass Clazz)
+    {
+        ABCTJavaBridge::OnTabOpened();
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnTabClosed(JNIEnv *Env, jclass Clazz)
+    {
+        ABCTJavaBridge::OnTabClosed();
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnNavigationEvent(JNIEnv *Env, jclass Clazz, jint jEvent, jstring jUrl)
+    {
+        ABCTJavaBridge::OnNavigationEvent((int32)jEvent, ToFString(Env, jUrl));
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnMessageChannelReady(JNIEnv *Env, jclass Clazz)
+    {
+        ABCTJavaBridge::OnMessageChannelReady();
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnPostMessage(JNIEnv *Env, jclass Clazz, jstring jMessage, jstring jOrigin)
+    {
+        ABCTJavaBridge::OnPostMessage(ToFString(Env, jMessage), ToFString(Env, jOrigin));
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnDeepLinkReceived(JNIEnv *Env, jclass Clazz, jstring jAction, jstring jParamsJson)
+    {
+        ABCTJavaBridge::OnDeepLinkReceived(ToFString(Env, jAction), ToFString(Env, jParamsJson));
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnReturnedToGame(JNIEnv *Env, jclass Clazz, jboolean jRelaunched)
+    {
+        ABCTJavaBridge::OnReturnedToGame(jRelaunched != JNI_FALSE);
+    }
+
+    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ABCTBridge_nativeOnNothingToClose(JNIEnv *Env, jclass Clazz)
+    {
+        ABCTJavaBridge::OnNothingToClose();
+    }
+}
+
+#endif // PLATFORM_ANDROID
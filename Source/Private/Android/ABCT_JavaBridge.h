@@ -0,0 +1,63 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Generated JNI bridge.
+ * @Date: 18/10/2026
+ *
+ * GENERATED by Source/Android/Bridge/GenerateBridge.py from ABCT_Bridge.idl - do not edit.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * ABCTJavaBridge
+ *
+ * C++ side of the JNI bridge to com.epicgames.unreal.customtabs.ABCTBridge.
+ * Call stubs resolve the class and method IDs once and pass strings as UTF-16 without
+ * conversion; they log and return a default value when Java is unavailable or throws.
+ * Android only.
+ */
+namespace ABCTJavaBridge
+{
+    // ============================================================================
+    // C++ -> Java (generated)
+    // ============================================================================
+
+    /** ChromeCustomTabs.openTab(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)Z */
+    bool OpenTab(const FString &Url, const FString &ToolbarColorHex, const FString &UserAgent, const FString &CustomHeader);
+
+    /** ChromeCustomTabs.closeTab()V */
+    void CloseTab();
+
+    /** ChromeCustomTabs.executeJava(Ljava/lang/String;)Z */
+    bool ExecuteJava(const FString &Message);
+
+    // ============================================================================
+    // Java -> C++ (implemented by hand in ChromeCustomTabsJNI.cpp)
+    // ============================================================================
+
+    /** ABCTBridge.nativeOnTabOpened, called on a Java thread. */
+    void OnTabOpened();
+
+    /** ABCTBridge.nativeOnTabClosed, called on a Java thread. */
+    void OnTabClosed();
+
+    /** ABCTBridge.nativeOnNavigationEvent, called on a Java thread. */
+    void OnNavigationEvent(int32 Event, FString Url);
+
+    /** ABCTBridge.nativeOnMessageChannelReady, called on a Java thread. */
+    void OnMessageChannelReady();
+
+    /** ABCTBridge.nativeOnPostMessage, called on a Java thread. */
+    void OnPostMessage(FString Message, FString Origin);
+
+    /** ABCTBridge.nativeOnDeepLinkReceived, called on a Java thread. */
+    void OnDeepLinkReceived(FString Action, FString ParamsJson);
+
+    /** ABCTBridge.nativeOnReturnedToGame, called on a Java thread. */
+    void OnReturnedToGame(bool Relaunched);
+
+    /** ABCTBridge.nativeOnNothingToClose, called on a Java thread. */
+    void OnNothingToClose();
+}
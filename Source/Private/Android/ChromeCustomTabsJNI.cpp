@@ -4,223 +4,111 @@
  * @Date: 09/10/2025
  */
 
-#include "CPP_ABCT_Base.h"
-#include "Async/Async.h"
-
-#if PLATFORM_ANDROID
-#include "Android/AndroidApplication.h"
-#include "Android/AndroidJavaEnv.h"
-#endif
-
-// ============================================================================
-// External Declaration for Global Registry (defined in CPP_ABCT_Base.cpp)
-// ============================================================================
-
-#if PLATFORM_ANDROID
-namespace ChromeCustomTabsRegistry
-{
-    extern UCPP_ABCT_Base *GetActiveInstance();
-}
-#endif
+#include "ABCT_JavaBridge.h"
+#include "ABCT_Ingress.h"
+#include "ABCT_ReturnToGame.h"
 
 // ============================================================================
 // JNI Callbacks - Called from Java
 // ============================================================================
+//
+// The JNIEXPORT entry points and the jstring conversion are generated from
+// Source/Android/Bridge/ABCT_Bridge.idl into ABCT_JavaBridge.cpp; these are the handlers they
+// forward to.
 
 #if PLATFORM_ANDROID
 
-extern "C"
+namespace ABCTJavaBridge
 {
     /**
-     * JNI callback for Deep Links from Chrome Custom Tab.
+     * Deep Link from Chrome Custom Tab.
      * Called from ChromeCustomTabs.java when a deep link is received.
-     *
-     * Method signature: nativeOnDeepLinkReceived(String action, String paramsJson)
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnDeepLinkReceived(
-        JNIEnv *Env,
-        jclass Clazz,
-        jstring jAction,
-        jstring jParamsJson)
+    void OnDeepLinkReceived(FString Action, FString ParamsJson)
     {
-        // Convert Java strings to C++ FStrings
-        const char *actionChars = Env->GetStringUTFChars(jAction, nullptr);
-        const char *paramsJsonChars = Env->GetStringUTFChars(jParamsJson, nullptr);
-
-        FString Action = FString(UTF8_TO_TCHAR(actionChars));
-        FString ParamsJson = FString(UTF8_TO_TCHAR(paramsJsonChars));
-
-        // Release Java strings
-        Env->ReleaseStringUTFChars(jAction, actionChars);
-        Env->ReleaseStringUTFChars(jParamsJson, paramsJsonChars);
-
         UE_LOG(LogTemp, Log, TEXT("JNI: Deep Link received - Action=%s, Params=%s"), *Action, *ParamsJson);
 
         // Forward to the active UCPP_ABCT_Base instance on the game thread
-        AsyncTask(ENamedThreads::GameThread, [Action, ParamsJson]()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                UE_LOG(LogTemp, Log, TEXT("JNI: Forwarding Deep Link to instance 0x%p"), Instance);
-                Instance->HandleDeepLink(Action, ParamsJson);
-            }
-            else
-            {
-                UE_LOG(LogTemp, Warning, TEXT("JNI: No active UCPP_ABCT_Base instance to receive Deep Link!"));
-            } });
+        ABCTIngress::DeepLink(Action, ParamsJson);
     }
 
     /**
-     * JNI callback for Navigation Events from Chrome Custom Tab.
+     * Navigation Event from Chrome Custom Tab.
      * Called from ChromeCustomTabs.java when navigation events occur.
-     *
-     * Method signature: nativeOnNavigationEvent(int event, String url)
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnNavigationEvent(
-        JNIEnv *Env,
-        jclass Clazz,
-        jint jEvent,
-        jstring jUrl)
+    void OnNavigationEvent(int32 Event, FString Url)
     {
-        // Convert Java string to C++ FString
-        const char *urlChars = Env->GetStringUTFChars(jUrl, nullptr);
-        FString URL = FString(UTF8_TO_TCHAR(urlChars));
-        Env->ReleaseStringUTFChars(jUrl, urlChars);
-
-        // Convert navigation event int to string
-        FString EventName;
-        switch (jEvent)
-        {
-        case 1:
-            EventName = TEXT("NavigationStarted");
-            break;
-        case 2:
-            EventName = TEXT("NavigationFinished");
-            break;
-        case 3:
-            EventName = TEXT("NavigationFailed");
-            break;
-        case 4:
-            EventName = TEXT("NavigationAborted");
-            break;
-        case 5:
-            EventName = TEXT("TabShown");
-            break;
-        case 6:
-            EventName = TEXT("TabHidden");
-            break;
-        default:
-            EventName = FString::Printf(TEXT("Unknown(%d)"), jEvent);
-            break;
-        }
-
-        UE_LOG(LogTemp, Log, TEXT("JNI: Navigation Event - %s, URL=%s"), *EventName, *URL);
+        UE_LOG(LogTemp, Log, TEXT("JNI: Navigation Event - %s, URL=%s"), *ABCTIngress::NavigationEventCodeToName(Event), *Url);
 
         // Forward to the active UCPP_ABCT_Base instance on the game thread
-        AsyncTask(ENamedThreads::GameThread, [EventName, URL]()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                Instance->HandleNavigationEvent(EventName, URL);
-            } });
+        ABCTIngress::NavigationEvent(Event, Url);
     }
 
     /**
-     * JNI callback for Tab Opened event.
+     * Tab Opened event.
      * Called from ChromeCustomTabs.java when the tab is opened.
-     *
-     * Method signature: nativeOnTabOpened()
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnTabOpened(
-        JNIEnv *Env,
-        jclass Clazz)
+    void OnTabOpened()
     {
         UE_LOG(LogTemp, Log, TEXT("JNI: Tab Opened"));
 
-        AsyncTask(ENamedThreads::GameThread, []()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                Instance->HandleNavigationEvent(TEXT("TabOpened"), TEXT(""));
-            } });
+        ABCTIngress::NamedNavigationEvent(TEXT("TabOpened"), TEXT(""));
     }
 
     /**
-     * JNI callback for Tab Closed event.
+     * Tab Closed event.
      * Called from ChromeCustomTabs.java when the tab is closed.
-     *
-     * Method signature: nativeOnTabClosed()
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnTabClosed(
-        JNIEnv *Env,
-        jclass Clazz)
+    void OnTabClosed()
     {
         UE_LOG(LogTemp, Log, TEXT("JNI: Tab Closed"));
 
-        AsyncTask(ENamedThreads::GameThread, []()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                Instance->HandleNavigationEvent(TEXT("TabClosed"), TEXT(""));
-            } });
+        ABCTIngress::NamedNavigationEvent(TEXT("TabClosed"), TEXT(""));
     }
 
     /**
-     * JNI callback for PostMessage Channel Ready.
+     * PostMessage Channel Ready.
      * Called from ChromeCustomTabs.java when the PostMessage channel is ready.
-     *
-     * Method signature: nativeOnMessageChannelReady()
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnMessageChannelReady(
-        JNIEnv *Env,
-        jclass Clazz)
+    void OnMessageChannelReady()
     {
         UE_LOG(LogTemp, Log, TEXT("JNI: PostMessage Channel Ready"));
 
-        AsyncTask(ENamedThreads::GameThread, []()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                Instance->HandleNavigationEvent(TEXT("MessageChannelReady"), TEXT(""));
-            } });
+        ABCTIngress::NamedNavigationEvent(TEXT("MessageChannelReady"), TEXT(""));
     }
 
     /**
-     * JNI callback for PostMessage from web page.
+     * PostMessage from web page.
      * Called from ChromeCustomTabs.java when a message is received from the web page.
-     *
-     * Method signature: nativeOnPostMessage(String message, String origin)
      */
-    JNIEXPORT void JNICALL Java_com_epicgames_unreal_customtabs_ChromeCustomTabs_nativeOnPostMessage(
-        JNIEnv *Env,
-        jclass Clazz,
-        jstring jMessage,
-        jstring jOrigin)
+    void OnPostMessage(FString Message, FString Origin)
     {
-        const char *messageChars = Env->GetStringUTFChars(jMessage, nullptr);
-        const char *originChars = Env->GetStringUTFChars(jOrigin, nullptr);
+        UE_LOG(LogTemp, Log, TEXT("JNI: PostMessage - Message=%s, Origin=%s"), *Message, *Origin);
+
+        // Forward to the active UCPP_ABCT_Base instance on the game thread
+        ABCTIngress::PageMessage(Message, Origin);
+    }
 
-        FString Message = FString(UTF8_TO_TCHAR(messageChars));
-        FString Origin = FString(UTF8_TO_TCHAR(originChars));
+    /**
+     * Game activity resumed after a close requested by CloseChromeCustomTab.
+     * Called from ChromeCustomTabs.java on the UI thread; the next game frame ends the measurement.
+     */
+    void OnReturnedToGame(bool Relaunched)
+    {
+        UE_LOG(LogTemp, Log, TEXT("JNI: Returned to game (%s)"), Relaunched ? TEXT("activity relaunched") : TEXT("tab finished"));
 
-        Env->ReleaseStringUTFChars(jMessage, messageChars);
-        Env->ReleaseStringUTFChars(jOrigin, originChars);
+        ABCTReturnToGame::NotifyGameVisible(Relaunched);
+    }
 
-        UE_LOG(LogTemp, Log, TEXT("JNI: PostMessage - Message=%s, Origin=%s"), *Message, *Origin);
+    /**
+     * CloseChromeCustomTab found no tab in front of the game (the user had already closed it).
+     * Called from ChromeCustomTabs.java on the UI thread; the close is not measured.
+     */
+    void OnNothingToClose()
+    {
+        UE_LOG(LogTemp, Log, TEXT("JNI: Nothing to close"));
 
-        AsyncTask(ENamedThreads::GameThread, [Message, Origin]()
-                  {
-            UCPP_ABCT_Base* Instance = ChromeCustomTabsRegistry::GetActiveInstance();
-            if (Instance)
-            {
-                // For now, just log. You can add a dedicated handler if needed.
-                UE_LOG(LogTemp, Log, TEXT("PostMessage forwarded to instance 0x%p"), Instance);
-            } });
+        ABCTReturnToGame::CancelClose();
     }
 }
 
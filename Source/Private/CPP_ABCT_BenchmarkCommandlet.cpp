@@ -0,0 +1,127 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel benchmark commandlet.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_BenchmarkCommandlet.h"
+#include "CPP_ABCT_Base.h"
+#include "ABCT_Benchmark.h"
+#include "ABCT_SimulatedBackend.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "Misc/Parse.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    /** Runs every queued game-thread task and one core ticker step, like one game frame */
+    void PumpGameThread(float DeltaTime)
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(DeltaTime);
+    }
+}
+
+UCPP_ABCT_BenchmarkCommandlet::UCPP_ABCT_BenchmarkCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UCPP_ABCT_BenchmarkCommandlet::Main(const FString &Params)
+{
+    // ============================================================================
+    // Options
+    // ============================================================================
+
+    FABCTBenchmarkConfig Config;
+    int32 Samples = Config.IdleRttSamples;
+    if (FParse::Value(*Params, TEXT("Samples="), Samples))
+    {
+        Config.IdleRttSamples = Samples;
+        Config.LoadedRttSamples = Samples;
+    }
+    FParse::Value(*Params, TEXT("Seconds="), Config.ThroughputSeconds);
+    FParse::Value(*Params, TEXT("MaxInFlight="), Config.MaxInFlight);
+
+    FString SizesString;
+    if (FParse::Value(*Params, TEXT("Sizes="), SizesString, false))
+    {
+        TArray<FString> Entries;
+        SizesString.ParseIntoArray(Entries, TEXT(","));
+        Config.ThroughputSizes.Reset();
+        for (const FString &Entry : Entries)
+        {
+            const int32 Size = FCString::Atoi(*Entry);
+            if (Size > 0)
+            {
+                Config.ThroughputSizes.Add(Size);
+            }
+        }
+    }
+
+    FString ReportPath;
+    FParse::Value(*Params, TEXT("Report="), ReportPath);
+
+    float FrameRate = 60.0f;
+    FParse::Value(*Params, TEXT("FrameRate="), FrameRate);
+
+    if (Samples <= 0 || Config.ThroughputSeconds <= 0.0 || Config.MaxInFlight <= 0)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_BenchmarkCommandlet - Invalid options (-Samples, -Seconds and -MaxInFlight must be positive)"));
+        return 1;
+    }
+
+    // ============================================================================
+    // Run
+    // ============================================================================
+
+    TSharedPtr<FABCTSimulatedBackend> Backend = MakeShared<FABCTSimulatedBackend>();
+    Backend->bEchoPage = true;
+    ABCTBackend::SetOverride(Backend);
+
+    UCPP_ABCT_Base *Instance = NewObject<UCPP_ABCT_Base>(GetTransientPackage());
+    Instance->AddToRoot();
+    Instance->SetDebugLoggingEnabled(false);
+
+    int32 Result = 1;
+    if (Instance->StartChannelBenchmarkWithConfig(Config, ReportPath))
+    {
+        const double FrameSeconds = FrameRate > 0.0f ? 1.0 / FrameRate : 0.0;
+        double LastFrameTime = FPlatformTime::Seconds();
+        while (Instance->IsChannelBenchmarkRunning() && !IsEngineExitRequested())
+        {
+            const double Now = FPlatformTime::Seconds();
+            PumpGameThread((float)(Now - LastFrameTime));
+            LastFrameTime = Now;
+
+            const double Remaining = FrameSeconds - (FPlatformTime::Seconds() - Now);
+            if (Remaining > 0.0)
+            {
+                FPlatformProcess::Sleep((float)Remaining);
+            }
+        }
+
+        const FString &Report = Instance->GetLastChannelBenchmarkReport();
+        UE_LOG(LogTemp, Display, TEXT("Channel benchmark report: %s"), *Report);
+        Result = !Report.IsEmpty() && !Report.Contains(TEXT("\"aborted\":true")) ? 0 : 1;
+    }
+
+    // ============================================================================
+    // Teardown
+    // ============================================================================
+
+    if (Instance->IsChromeCustomTabOpen())
+    {
+        Instance->CloseChromeCustomTab();
+    }
+    PumpGameThread(0.0f);
+    Instance->RemoveFromRoot();
+    ABCTBackend::SetOverride(nullptr);
+
+    UE_LOG(LogTemp, Display, TEXT("Channel benchmark result: %s"), Result == 0 ? TEXT("COMPLETED") : TEXT("ABORTED"));
+    return Result;
+}
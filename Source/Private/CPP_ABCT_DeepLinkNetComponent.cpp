@@ -0,0 +1,258 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Replicates deep link actions to the server.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_DeepLinkNetComponent.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+UCPP_ABCT_DeepLinkNetComponent::UCPP_ABCT_DeepLinkNetComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    SetIsReplicatedByDefault(true);
+
+    MaxActionsPerBatch = 16;
+    LastFlushSeconds = 0.0;
+}
+
+// ============================================================================
+// Client - Queueing
+// ============================================================================
+
+void UCPP_ABCT_DeepLinkNetComponent::ListenTo(UCPP_ABCT_Base *Instance)
+{
+    if (UCPP_ABCT_Base *Previous = ListenedInstance.Get())
+    {
+        Previous->OnEvent().Remove(ListenHandle);
+    }
+    ListenHandle.Reset();
+    ListenedInstance = Instance;
+
+    if (Instance)
+    {
+        ListenHandle = Instance->OnEvent().AddUObject(this, &UCPP_ABCT_DeepLinkNetComponent::OnBrowserEvent);
+    }
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::OnBrowserEvent(const FABCTEventRef &Event)
+{
+    if (Event->GetKind() == EABCTEventKind::DeepLink)
+    {
+        QueueDeepLink(Event->GetName(), Event->GetPayload());
+    }
+}
+
+bool UCPP_ABCT_DeepLinkNetComponent::QueueDeepLink(const FString &Action, const FString &ParamsJson)
+{
+    FABCTNetDeepLinkAction Encoded;
+    if (!EncodeDeepLink(Action, ParamsJson, Encoded))
+    {
+        return false;
+    }
+
+    PendingActions.Add(MoveTemp(Encoded));
+    ABCTStats::Increment(EABCTCounter::DeepLinkNetActionsQueued);
+    return true;
+}
+
+bool UCPP_ABCT_DeepLinkNetComponent::EncodeDeepLink(FStringView Action, const FString &ParamsJson, FABCTNetDeepLinkAction &OutAction) const
+{
+    const int32 ActionId = FindActionId(Action);
+    if (ActionId == INDEX_NONE)
+    {
+        return false;
+    }
+    const FABCTNetDeepLinkActionSpec &Spec = Actions[ActionId];
+
+    // NetSerialize cannot write more values than this, and the server would drop the batch
+    if (Spec.IntParams.Num() > FABCTNetDeepLinkBatch::MaxValuesPerAction || Spec.FloatParams.Num() > FABCTNetDeepLinkBatch::MaxValuesPerAction)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_DeepLinkNetComponent::EncodeDeepLink - Action %s has more than %d int or float params"),
+               *Spec.Action.ToString(), FABCTNetDeepLinkBatch::MaxValuesPerAction);
+        return false;
+    }
+
+    OutAction = FABCTNetDeepLinkAction();
+    OutAction.ActionId = ActionId;
+    OutAction.Action = Spec.Action;
+    OutAction.bHasLocation = Spec.bHasLocation;
+
+    // Java sends every param as a string ({"x":"1000"}); numbers are accepted as well
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ParamsJson);
+    if (!ParamsJson.IsEmpty() && !FJsonSerializer::Deserialize(Reader, JsonObject))
+    {
+        JsonObject.Reset();
+    }
+    auto ReadNumber = [&JsonObject](const FString &Key) -> double
+    {
+        FString Value;
+        return JsonObject.IsValid() && JsonObject->TryGetStringField(Key, Value) ? FCString::Atod(*Value) : 0.0;
+    };
+
+    if (Spec.bHasLocation)
+    {
+        OutAction.Location = FVector(ReadNumber(TEXT("x")), ReadNumber(TEXT("y")), ReadNumber(TEXT("z")));
+    }
+
+    OutAction.Ints.Reserve(Spec.IntParams.Num());
+    for (const FName &Param : Spec.IntParams)
+    {
+        OutAction.Ints.Add((int32)FMath::Clamp(ReadNumber(Param.ToString()), (double)MIN_int32, (double)MAX_int32));
+    }
+
+    OutAction.Floats.Reserve(Spec.FloatParams.Num());
+    for (const FName &Param : Spec.FloatParams)
+    {
+        OutAction.Floats.Add((float)ReadNumber(Param.ToString()));
+    }
+    return true;
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::FlushPendingActions()
+{
+    while (PendingActions.Num() > 0)
+    {
+        SendBatch();
+    }
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::SendBatch()
+{
+    const int32 Count = FMath::Min(PendingActions.Num(), FMath::Clamp(MaxActionsPerBatch, 1, FABCTNetDeepLinkBatch::MaxActions));
+
+    FABCTNetDeepLinkBatch Batch;
+    Batch.Actions.Reserve(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Batch.Actions.Add(MoveTemp(PendingActions[Index]));
+    }
+    PendingActions.RemoveAt(0, Count, EAllowShrinking::No);
+
+    const UWorld *World = GetWorld();
+    LastFlushSeconds = World ? World->GetTimeSeconds() : 0.0;
+    ABCTStats::Increment(EABCTCounter::DeepLinkNetBatchesSent);
+    ServerApplyDeepLinkActions(Batch);
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (PendingActions.Num() == 0)
+    {
+        return;
+    }
+
+    // At most one batch per net update of the owner, so a burst of links shares one RPC
+    const AActor *Owner = GetOwner();
+    const UWorld *World = GetWorld();
+    const float Frequency = Owner ? Owner->GetNetUpdateFrequency() : 0.0f;
+    const double Interval = Frequency > 0.0f ? 1.0 / Frequency : 0.0;
+    if (!World || World->GetTimeSeconds() - LastFlushSeconds >= Interval)
+    {
+        SendBatch();
+    }
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ListenTo(nullptr);
+    PendingActions.Reset();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// ============================================================================
+// Server - Applying
+// ============================================================================
+
+bool UCPP_ABCT_DeepLinkNetComponent::ServerApplyDeepLinkActions_Validate(const FABCTNetDeepLinkBatch &Batch)
+{
+    // The fixed wire limit, not MaxActionsPerBatch: that is the sender's setting and may differ
+    // between client and server builds or blueprints
+    return Batch.Actions.Num() <= FABCTNetDeepLinkBatch::MaxActions;
+}
+
+void UCPP_ABCT_DeepLinkNetComponent::ServerApplyDeepLinkActions_Implementation(const FABCTNetDeepLinkBatch &Batch)
+{
+    ApplyBatch(Batch);
+}
+
+int32 UCPP_ABCT_DeepLinkNetComponent::ApplyBatch(const FABCTNetDeepLinkBatch &Batch)
+{
+    int32 NumApplied = 0;
+    for (const FABCTNetDeepLinkAction &Received : Batch.Actions)
+    {
+        // The wire format is typed by the spec; anything else came from a mismatched or hostile client.
+        // Floats are read raw from the wire, so NaN and infinity must not reach gameplay code either
+        const FABCTNetDeepLinkActionSpec *Spec = FindSpec(Received);
+        const bool bNonFinite = Received.Location.ContainsNaN() || Received.Floats.ContainsByPredicate([](float Value)
+                                                                                                      { return !FMath::IsFinite(Value); });
+        if (!Spec || Received.bHasLocation != Spec->bHasLocation || Received.Ints.Num() != Spec->IntParams.Num() ||
+            Received.Floats.Num() != Spec->FloatParams.Num() || bNonFinite)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("UCPP_ABCT_DeepLinkNetComponent::ApplyBatch - Rejected malformed action (id %d)"), Received.ActionId);
+            ABCTStats::Increment(EABCTCounter::DeepLinkNetActionsRejected);
+            continue;
+        }
+
+        FABCTNetDeepLinkAction Action = Received;
+        Action.Action = Spec->Action;
+        OnServerDeepLinkAction.Broadcast(Action);
+        ++NumApplied;
+    }
+    return NumApplied;
+}
+
+bool UCPP_ABCT_DeepLinkNetComponent::GetIntParam(const FABCTNetDeepLinkAction &Action, FName Param, int32 &OutValue) const
+{
+    const FABCTNetDeepLinkActionSpec *Spec = FindSpec(Action);
+    const int32 Index = Spec ? Spec->IntParams.IndexOfByKey(Param) : INDEX_NONE;
+    if (!Action.Ints.IsValidIndex(Index))
+    {
+        return false;
+    }
+    OutValue = Action.Ints[Index];
+    return true;
+}
+
+bool UCPP_ABCT_DeepLinkNetComponent::GetFloatParam(const FABCTNetDeepLinkAction &Action, FName Param, float &OutValue) const
+{
+    const FABCTNetDeepLinkActionSpec *Spec = FindSpec(Action);
+    const int32 Index = Spec ? Spec->FloatParams.IndexOfByKey(Param) : INDEX_NONE;
+    if (!Action.Floats.IsValidIndex(Index))
+    {
+        return false;
+    }
+    OutValue = Action.Floats[Index];
+    return true;
+}
+
+// ============================================================================
+// Internal Helper Functions
+// ============================================================================
+
+int32 UCPP_ABCT_DeepLinkNetComponent::FindActionId(FStringView Action) const
+{
+    // Actions never seen as an FName cannot be in the list; the lookup does not add them
+    const FName ActionName(Action.Len(), Action.GetData(), FNAME_Find);
+    if (ActionName.IsNone())
+    {
+        return INDEX_NONE;
+    }
+    return Actions.IndexOfByPredicate([ActionName](const FABCTNetDeepLinkActionSpec &Spec)
+                                      { return Spec.Action == ActionName; });
+}
+
+const FABCTNetDeepLinkActionSpec *UCPP_ABCT_DeepLinkNetComponent::FindSpec(const FABCTNetDeepLinkAction &Action) const
+{
+    return Actions.IsValidIndex(Action.ActionId) ? &Actions[Action.ActionId] : nullptr;
+}
@@ -0,0 +1,25 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Deep link action to gameplay tag mapping.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_DeepLinkTagMap.h"
+
+FGameplayTag UCPP_ABCT_DeepLinkTagMap::FindTag(FStringView Action) const
+{
+    if (Action.IsEmpty() || ActionTags.IsEmpty())
+    {
+        return FGameplayTag();
+    }
+
+    // FNAME_Find resolves to the interned name (or None) without growing the name table
+    const FName ActionName(Action.Len(), Action.GetData(), FNAME_Find);
+    if (ActionName.IsNone())
+    {
+        return FGameplayTag();
+    }
+
+    const FGameplayTag *Tag = ActionTags.Find(ActionName);
+    return Tag ? *Tag : FGameplayTag();
+}
@@ -0,0 +1,32 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Blueprint accessors for shared events.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_EventLibrary.h"
+
+EABCTEventKind UCPP_ABCT_EventLibrary::GetEventKind(const FABCTEventHandle &Event)
+{
+    return Event.IsValid() ? Event.Get().GetKind() : EABCTEventKind::Navigation;
+}
+
+FString UCPP_ABCT_EventLibrary::GetEventName(const FABCTEventHandle &Event)
+{
+    return Event.IsValid() ? Event.Get().GetName() : FString();
+}
+
+FString UCPP_ABCT_EventLibrary::GetEventPayload(const FABCTEventHandle &Event)
+{
+    return Event.IsValid() ? Event.Get().GetPayload() : FString();
+}
+
+FString UCPP_ABCT_EventLibrary::GetEventURL(const FABCTEventHandle &Event)
+{
+    return Event.IsValid() ? Event.Get().GetUrlString() : FString();
+}
+
+FString UCPP_ABCT_EventLibrary::GetEventOrigin(const FABCTEventHandle &Event)
+{
+    return Event.IsValid() ? Event.Get().GetOrigin() : FString();
+}
@@ -0,0 +1,276 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Page and deep link to game asset prefetch mapping.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_PrefetchMap.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_UrlTable.h"
+#include "Engine/StreamableManager.h"
+
+namespace
+{
+    /** Pops the next non-empty '/'-separated segment off Path */
+    bool NextSegment(FStringView &Path, FStringView &OutSegment)
+    {
+        while (Path.StartsWith(TEXT('/')))
+        {
+            Path.RightChopInline(1);
+        }
+        if (Path.IsEmpty())
+        {
+            return false;
+        }
+
+        int32 Slash;
+        if (!Path.FindChar(TEXT('/'), Slash))
+        {
+            Slash = Path.Len();
+        }
+        OutSegment = Path.Left(Slash);
+        Path.RightChopInline(Slash);
+        return true;
+    }
+
+    bool IsCapture(FStringView Segment)
+    {
+        return Segment.Len() > 2 && Segment[0] == TEXT('{') && Segment[Segment.Len() - 1] == TEXT('}');
+    }
+
+    /** Capture values become part of asset names, so they cannot reach outside their template */
+    bool IsSafeCaptureValue(FStringView Value)
+    {
+        if (Value.IsEmpty())
+        {
+            return false;
+        }
+        for (const TCHAR Char : Value)
+        {
+            if (!FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('-'))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Adds the params of Query to Captures; path captures of the same name win */
+    void AddQueryParams(FStringView Query, TMap<FString, FString> &Captures)
+    {
+        while (!Query.IsEmpty())
+        {
+            int32 Amp;
+            if (!Query.FindChar(TEXT('&'), Amp))
+            {
+                Amp = Query.Len();
+            }
+            const FStringView Pair = Query.Left(Amp);
+            Query.RightChopInline(Amp + 1);
+
+            int32 Equals;
+            FStringView Name = Pair;
+            FStringView Value;
+            if (Pair.FindChar(TEXT('='), Equals))
+            {
+                Name = Pair.Left(Equals);
+                Value = Pair.RightChop(Equals + 1);
+            }
+
+            FString NameString(Name);
+            if (!NameString.IsEmpty() && !Captures.Contains(NameString))
+            {
+                Captures.Add(MoveTemp(NameString), FString(Value));
+            }
+        }
+    }
+
+    /** Expands the templates of Rule into Request; templates naming a missing capture are skipped */
+    void AddRuleTargets(const FABCTPrefetchRule &Rule, TFunctionRef<bool(FStringView, FString &)> Lookup, FABCTPrefetchRequest &Request)
+    {
+        const bool bFirstRule = Request.IsEmpty();
+        bool bAdded = false;
+        FString Expanded;
+
+        for (const FString &Template : Rule.PrimaryAssets)
+        {
+            const FPrimaryAssetId Id = UCPP_ABCT_PrefetchMap::Expand(Template, Lookup, Expanded) ? FPrimaryAssetId(Expanded) : FPrimaryAssetId();
+            if (Id.IsValid() && !Request.PrimaryAssets.Contains(Id))
+            {
+                Request.PrimaryAssets.Add(Id);
+                Request.Key += Expanded;
+                Request.Key += TEXT('|');
+                bAdded = true;
+            }
+        }
+
+        for (const FString &Template : Rule.ObjectPaths)
+        {
+            const FSoftObjectPath Path = UCPP_ABCT_PrefetchMap::Expand(Template, Lookup, Expanded) ? FSoftObjectPath(Expanded) : FSoftObjectPath();
+            if (Path.IsValid() && !Request.ObjectPaths.Contains(Path))
+            {
+                Request.ObjectPaths.Add(Path);
+                Request.Key += Expanded;
+                Request.Key += TEXT('|');
+                bAdded = true;
+            }
+        }
+
+        if (bAdded)
+        {
+            for (const FName Bundle : Rule.Bundles)
+            {
+                Request.Bundles.AddUnique(Bundle);
+            }
+            Request.Priority = bFirstRule ? Rule.Priority : FMath::Max(Request.Priority, Rule.Priority);
+        }
+    }
+}
+
+bool UCPP_ABCT_PrefetchMap::ResolvePage(const FABCTUrl &Url, FABCTPrefetchRequest &OutRequest) const
+{
+    OutRequest = FABCTPrefetchRequest();
+
+    TMap<FString, FString> Captures;
+    for (const FABCTPrefetchRule &Rule : Rules)
+    {
+        if (!Rule.DeepLinkAction.IsNone() || !MatchHost(Rule.Host, Url.GetHost()))
+        {
+            continue;
+        }
+        Captures.Reset();
+        if (!Rule.PathPattern.IsEmpty() && !MatchPath(Rule.PathPattern, Url.GetPath(), Captures))
+        {
+            continue;
+        }
+
+        AddQueryParams(Url.GetQuery(), Captures);
+        AddRuleTargets(Rule, [&Captures](FStringView Name, FString &OutValue)
+                       {
+            const FString *Value = Captures.Find(FString(Name));
+            if (Value)
+            {
+                OutValue = *Value;
+            }
+            return Value != nullptr; }, OutRequest);
+    }
+    return !OutRequest.IsEmpty();
+}
+
+bool UCPP_ABCT_PrefetchMap::ResolveDeepLink(FStringView Action, FStringView ParamsJson, FABCTPrefetchRequest &OutRequest) const
+{
+    OutRequest = FABCTPrefetchRequest();
+    if (Action.IsEmpty() || Rules.IsEmpty())
+    {
+        return false;
+    }
+
+    // Same as UCPP_ABCT_DeepLinkTagMap::FindTag: actions never seen as an FName cannot match
+    const FName ActionName(Action.Len(), Action.GetData(), FNAME_Find);
+    if (ActionName.IsNone())
+    {
+        return false;
+    }
+
+    for (const FABCTPrefetchRule &Rule : Rules)
+    {
+        if (Rule.DeepLinkAction != ActionName)
+        {
+            continue;
+        }
+        AddRuleTargets(Rule, [ParamsJson](FStringView Name, FString &OutValue)
+                       {
+            FStringView Value;
+            if (!ABCTJsonScan::FindStringField(ParamsJson, Name, Value))
+            {
+                return false;
+            }
+            OutValue = Value;
+            return true; }, OutRequest);
+    }
+
+    // The player just acted on it; this is what the game needs next
+    if (!OutRequest.IsEmpty())
+    {
+        OutRequest.Priority = FMath::Max(OutRequest.Priority, (int32)FStreamableManager::AsyncLoadHighPriority);
+    }
+    return !OutRequest.IsEmpty();
+}
+
+bool UCPP_ABCT_PrefetchMap::MatchHost(FStringView Pattern, FStringView Host)
+{
+    if (Pattern.IsEmpty())
+    {
+        return true;
+    }
+
+    if (Pattern.StartsWith(TEXT("*.")))
+    {
+        const FStringView Domain = Pattern.RightChop(2);
+        if (Host.Equals(Domain, ESearchCase::IgnoreCase))
+        {
+            return true;
+        }
+        return Host.Len() > Domain.Len() && Host.EndsWith(Domain, ESearchCase::IgnoreCase) && Host[Host.Len() - Domain.Len() - 1] == TEXT('.');
+    }
+    return Host.Equals(Pattern, ESearchCase::IgnoreCase);
+}
+
+bool UCPP_ABCT_PrefetchMap::MatchPath(FStringView Pattern, FStringView Path, TMap<FString, FString> &OutCaptures)
+{
+    OutCaptures.Reset();
+
+    FStringView PatternSegment;
+    FStringView PathSegment;
+    while (NextSegment(Pattern, PatternSegment))
+    {
+        const bool bWildcard = PatternSegment.Len() == 1 && PatternSegment[0] == TEXT('*');
+        FStringView Rest = Pattern;
+        FStringView Unused;
+        if (bWildcard && !NextSegment(Rest, Unused))
+        {
+            // A final "*" takes the rest of the path, if any
+            return true;
+        }
+
+        if (!NextSegment(Path, PathSegment))
+        {
+            return false;
+        }
+        if (IsCapture(PatternSegment))
+        {
+            OutCaptures.Add(FString(PatternSegment.Mid(1, PatternSegment.Len() - 2)), FString(PathSegment));
+        }
+        else if (!bWildcard && !PatternSegment.Equals(PathSegment, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+    }
+    return !NextSegment(Path, PathSegment);
+}
+
+bool UCPP_ABCT_PrefetchMap::Expand(FStringView Template, TFunctionRef<bool(FStringView Name, FString &OutValue)> Lookup, FString &OutValue)
+{
+    OutValue.Reset();
+    FString Value;
+    while (!Template.IsEmpty())
+    {
+        int32 Open;
+        int32 Close;
+        if (!Template.FindChar(TEXT('{'), Open) || !Template.RightChop(Open).FindChar(TEXT('}'), Close))
+        {
+            // No (complete) capture left; an unmatched brace is literal
+            OutValue += Template;
+            break;
+        }
+
+        OutValue += Template.Left(Open);
+        if (!Lookup(Template.Mid(Open + 1, Close - 1), Value) || !IsSafeCaptureValue(Value))
+        {
+            return false;
+        }
+        OutValue += Value;
+        Template.RightChopInline(Open + Close + 1);
+    }
+    return true;
+}
@@ -0,0 +1,378 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Long-running soak test commandlet.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_SoakCommandlet.h"
+#include "CPP_ABCT_Base.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_Stats.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/Parse.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    enum class ESoakEvent : uint8
+    {
+        OpenClose,
+        NavigationBurst,
+        DeepLink,
+        PostMessageFlood,
+
+        Count
+    };
+
+    const TCHAR *SoakEventNames[] = {TEXT("open"), TEXT("nav"), TEXT("deeplink"), TEXT("post")};
+    static_assert(UE_ARRAY_COUNT(SoakEventNames) == (int32)ESoakEvent::Count, "SoakEventNames out of sync with ESoakEvent");
+
+    /** Copy of a histogram's buckets, used to compute per-sample-window percentiles */
+    struct FHistogramSnapshot
+    {
+        uint64 Buckets[FABCTHistogram::NumBuckets] = {};
+
+        static FHistogramSnapshot Take(EABCTHistogram Histogram)
+        {
+            FHistogramSnapshot Snapshot;
+            const FABCTHistogram &Source = ABCTStats::GetHistogram(Histogram);
+            for (int32 Index = 0; Index < FABCTHistogram::NumBuckets; ++Index)
+            {
+                Snapshot.Buckets[Index] = Source.Buckets[Index].load(std::memory_order_relaxed);
+            }
+            return Snapshot;
+        }
+
+        /** Upper bound of the bucket holding the given percentile of samples recorded since Previous */
+        uint64 PercentileSince(const FHistogramSnapshot &Previous, double Percentile) const
+        {
+            uint64 Total = 0;
+            for (int32 Index = 0; Index < FABCTHistogram::NumBuckets; ++Index)
+            {
+                Total += Buckets[Index] - Previous.Buckets[Index];
+            }
+            if (Total == 0)
+            {
+                return 0;
+            }
+
+            const uint64 Target = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(Total * Percentile));
+            uint64 Cumulative = 0;
+            for (int32 Index = 0; Index < FABCTHistogram::NumBuckets; ++Index)
+            {
+                Cumulative += Buckets[Index] - Previous.Buckets[Index];
+                if (Cumulative >= Target)
+                {
+                    // Report the +Inf bucket as twice the last finite bound
+                    return Index == FABCTHistogram::NumBuckets - 1 ? FABCTHistogram::GetBucketUpperBound(Index - 1) * 2 : FABCTHistogram::GetBucketUpperBound(Index);
+                }
+            }
+            return FABCTHistogram::GetBucketUpperBound(FABCTHistogram::NumBuckets - 2) * 2;
+        }
+    };
+
+    /** Parses -Mix=open=1,nav=10,... into per-event weights; unknown names are ignored */
+    void ParseMix(const FString &MixString, int32 (&Weights)[(int32)ESoakEvent::Count])
+    {
+        TArray<FString> Entries;
+        MixString.ParseIntoArray(Entries, TEXT(","));
+        for (const FString &Entry : Entries)
+        {
+            FString Name, Weight;
+            if (!Entry.Split(TEXT("="), &Name, &Weight))
+            {
+                continue;
+            }
+            for (int32 Index = 0; Index < (int32)ESoakEvent::Count; ++Index)
+            {
+                if (Name.TrimStartAndEnd().Equals(SoakEventNames[Index], ESearchCase::IgnoreCase))
+                {
+                    Weights[Index] = FMath::Max(0, FCString::Atoi(*Weight));
+                }
+            }
+        }
+    }
+
+    /** Runs every queued game-thread task and one core ticker step, like one game frame */
+    void PumpGameThread(float DeltaTime)
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(DeltaTime);
+    }
+}
+
+UCPP_ABCT_SoakCommandlet::UCPP_ABCT_SoakCommandlet()
+{
+    IsClient = false;
+    IsEditor = false;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UCPP_ABCT_SoakCommandlet::Main(const FString &Params)
+{
+    // ============================================================================
+    // Options
+    // ============================================================================
+
+    float Hours = 1.0f;
+    FParse::Value(*Params, TEXT("Hours="), Hours);
+    float Minutes = 0.0f;
+    if (FParse::Value(*Params, TEXT("Minutes="), Minutes))
+    {
+        Hours = Minutes / 60.0f;
+    }
+
+    int32 Weights[(int32)ESoakEvent::Count] = {1, 10, 5, 20};
+    FString MixString;
+    if (FParse::Value(*Params, TEXT("Mix="), MixString, false))
+    {
+        ParseMix(MixString, Weights);
+    }
+
+    int32 EventsPerSecond = 500;
+    int32 NavBurst = 8;
+    int32 PostFlood = 32;
+    float SampleSeconds = 60.0f;
+    int32 WarmupSamples = 2;
+    float MaxRSSGrowthMB = 64.0f;
+    float MaxLatencyDrift = 4.0f;
+    int32 MaxP99Micros = 50000;
+    int32 MaxDeepLinkP99Micros = 50000;
+    int32 MaxQueueDepth = 0;
+    int32 Seed = 1;
+    FParse::Value(*Params, TEXT("EventsPerSecond="), EventsPerSecond);
+    FParse::Value(*Params, TEXT("NavBurst="), NavBurst);
+    FParse::Value(*Params, TEXT("PostFlood="), PostFlood);
+    FParse::Value(*Params, TEXT("SampleSeconds="), SampleSeconds);
+    FParse::Value(*Params, TEXT("WarmupSamples="), WarmupSamples);
+    FParse::Value(*Params, TEXT("MaxRSSGrowthMB="), MaxRSSGrowthMB);
+    FParse::Value(*Params, TEXT("MaxLatencyDrift="), MaxLatencyDrift);
+    FParse::Value(*Params, TEXT("MaxP99Micros="), MaxP99Micros);
+    FParse::Value(*Params, TEXT("MaxDeepLinkP99Micros="), MaxDeepLinkP99Micros);
+    FParse::Value(*Params, TEXT("MaxQueueDepth="), MaxQueueDepth);
+    FParse::Value(*Params, TEXT("Seed="), Seed);
+
+    int32 TotalWeight = 0;
+    for (int32 Weight : Weights)
+    {
+        TotalWeight += Weight;
+    }
+    if (TotalWeight <= 0 || EventsPerSecond <= 0 || SampleSeconds <= 0.0f)
+    {
+        UE_LOG(LogTemp, Error, TEXT("UCPP_ABCT_SoakCommandlet - Invalid options (mix weights, -EventsPerSecond and -SampleSeconds must be positive)"));
+        return 1;
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("UCPP_ABCT_SoakCommandlet: %.2f hours, mix open=%d nav=%d deeplink=%d post=%d, %d events/s"),
+           Hours, Weights[0], Weights[1], Weights[2], Weights[3], EventsPerSecond);
+
+    // ============================================================================
+    // Pipeline Setup
+    // ============================================================================
+
+    TSharedPtr<FABCTSimulatedBackend> Backend = MakeShared<FABCTSimulatedBackend>();
+    ABCTBackend::SetOverride(Backend);
+    ABCTStats::ResetAll();
+
+    UCPP_ABCT_Base *Instance = NewObject<UCPP_ABCT_Base>(GetTransientPackage());
+    Instance->AddToRoot();
+    Instance->SetDebugLoggingEnabled(false);
+
+    const TCHAR *DeepLinkActions[] = {TEXT("teleport"), TEXT("message"), TEXT("jump")};
+    const FString TeleportParams = TEXT("{\"x\":\"1000\",\"y\":\"0\",\"z\":\"500\"}");
+    const FString MessageParams = TEXT("{\"text\":\"Hello\",\"priority\":\"high\"}");
+    const FString JumpParams = TEXT("{\"height\":\"500\"}");
+    const FString *DeepLinkParams[] = {&TeleportParams, &MessageParams, &JumpParams};
+
+    FRandomStream Random(Seed);
+    const double SecondsPerEvent = 1.0 / EventsPerSecond;
+    const double StartTime = FPlatformTime::Seconds();
+    const double EndTime = StartTime + Hours * 3600.0;
+    double NextSampleTime = StartTime + SampleSeconds;
+    double LastFrameTime = StartTime;
+
+    int32 SampleIndex = 0;
+    uint64 BaselineRSS = 0;
+    uint64 BaselineP99 = 0;
+    FHistogramSnapshot PreviousIngress = FHistogramSnapshot::Take(EABCTHistogram::IngressToDispatchMicros);
+    FHistogramSnapshot PreviousDeepLink = FHistogramSnapshot::Take(EABCTHistogram::DeepLinkHandlerMicros);
+    uint64 EventCounts[(int32)ESoakEvent::Count] = {};
+    int32 Result = 0;
+
+    // ============================================================================
+    // Main Loop
+    // ============================================================================
+
+    while (Result == 0 && FPlatformTime::Seconds() < EndTime && !IsEngineExitRequested())
+    {
+        const double EventStart = FPlatformTime::Seconds();
+
+        // Pick the next event by weight
+        int32 Roll = Random.RandRange(0, TotalWeight - 1);
+        int32 EventIndex = 0;
+        while (Roll >= Weights[EventIndex])
+        {
+            Roll -= Weights[EventIndex];
+            ++EventIndex;
+        }
+        ++EventCounts[EventIndex];
+
+        switch ((ESoakEvent)EventIndex)
+        {
+        case ESoakEvent::OpenClose:
+            if (Instance->IsChromeCustomTabOpen())
+            {
+                Instance->CloseChromeCustomTab();
+            }
+            else
+            {
+                Instance->OpenChromeCustomTab(TEXT("https://soak.test/store"));
+            }
+            break;
+
+        case ESoakEvent::NavigationBurst:
+            if (!Instance->IsChromeCustomTabOpen())
+            {
+                Instance->OpenChromeCustomTab(TEXT("https://soak.test/store"));
+            }
+            Backend->SimulateNavigationBurst(NavBurst);
+            break;
+
+        case ESoakEvent::DeepLink:
+        {
+            const int32 ActionIndex = Random.RandRange(0, UE_ARRAY_COUNT(DeepLinkActions) - 1);
+            Backend->SimulateDeepLink(DeepLinkActions[ActionIndex], *DeepLinkParams[ActionIndex]);
+            PumpGameThread(0.0f);
+
+            // Exercise the parameter helpers the way Blueprint handlers do
+            FVector Location;
+            Instance->GetDeepLinkParameterAsVector(TeleportParams, Location);
+            break;
+        }
+
+        case ESoakEvent::PostMessageFlood:
+            if (!Instance->IsChromeCustomTabOpen())
+            {
+                Instance->OpenChromeCustomTab(TEXT("https://soak.test/store"));
+            }
+            for (int32 Index = 0; Index < PostFlood; ++Index)
+            {
+                Backend->SimulatePostMessage(FString::Printf(TEXT("{\"type\":\"state\",\"seq\":%d}"), Index));
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        PumpGameThread((float)(Now - LastFrameTime));
+        LastFrameTime = Now;
+
+        // ============================================================================
+        // Sampling and Drift Checks
+        // ============================================================================
+
+        if (Now >= NextSampleTime)
+        {
+            NextSampleTime += SampleSeconds;
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+            const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+            const FHistogramSnapshot CurrentIngress = FHistogramSnapshot::Take(EABCTHistogram::IngressToDispatchMicros);
+            const FHistogramSnapshot CurrentDeepLink = FHistogramSnapshot::Take(EABCTHistogram::DeepLinkHandlerMicros);
+            const uint64 IngressP99 = CurrentIngress.PercentileSince(PreviousIngress, 0.99);
+            const uint64 DeepLinkP99 = CurrentDeepLink.PercentileSince(PreviousDeepLink, 0.99);
+            PreviousIngress = CurrentIngress;
+            PreviousDeepLink = CurrentDeepLink;
+
+            const int64 QueueDepth = ABCTStats::GetGauge(EABCTGauge::IngressQueueDepth);
+            const int64 LiveInstances = ABCTStats::GetGauge(EABCTGauge::LiveInstances);
+            const int32 BackendHandles = Backend->GetLiveHandleCount();
+
+            UE_LOG(LogTemp, Display, TEXT("Soak sample %d: t=%.0fs RSS=%.1fMB Virtual=%.1fMB IngressP99=%lluus DeepLinkP99=%lluus Queue=%lld Instances=%lld Handles=%d Dropped=%llu"),
+                   SampleIndex, Now - StartTime,
+                   MemoryStats.UsedPhysical / (1024.0 * 1024.0), MemoryStats.UsedVirtual / (1024.0 * 1024.0),
+                   IngressP99, DeepLinkP99, QueueDepth, LiveInstances, BackendHandles,
+                   ABCTStats::GetCounter(EABCTCounter::EventsDroppedNoInstance));
+            GMalloc->DumpAllocatorStats(*GLog);
+
+            if (SampleIndex == WarmupSamples)
+            {
+                BaselineRSS = MemoryStats.UsedPhysical;
+                BaselineP99 = FMath::Max<uint64>(IngressP99, 1);
+                UE_LOG(LogTemp, Display, TEXT("Soak baseline: RSS=%.1fMB IngressP99=%lluus"), BaselineRSS / (1024.0 * 1024.0), BaselineP99);
+            }
+            else if (SampleIndex > WarmupSamples)
+            {
+                const double RSSGrowthMB = ((double)MemoryStats.UsedPhysical - (double)BaselineRSS) / (1024.0 * 1024.0);
+                if (RSSGrowthMB > MaxRSSGrowthMB)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Soak FAILED: RSS grew %.1fMB over baseline (limit %.1fMB)"), RSSGrowthMB, MaxRSSGrowthMB);
+                    Result = 1;
+                }
+                if (IngressP99 > BaselineP99 * MaxLatencyDrift)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Soak FAILED: ingress p99 %lluus drifted past %.1fx baseline %lluus"), IngressP99, MaxLatencyDrift, BaselineP99);
+                    Result = 1;
+                }
+            }
+
+            if (IngressP99 > (uint64)MaxP99Micros)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Soak FAILED: ingress p99 %lluus exceeds %dus"), IngressP99, MaxP99Micros);
+                Result = 1;
+            }
+            if (DeepLinkP99 > (uint64)MaxDeepLinkP99Micros)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Soak FAILED: deep link handler p99 %lluus exceeds %dus"), DeepLinkP99, MaxDeepLinkP99Micros);
+                Result = 1;
+            }
+            if (QueueDepth > MaxQueueDepth)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Soak FAILED: ingress queue depth %lld after pumping (limit %d)"), QueueDepth, MaxQueueDepth);
+                Result = 1;
+            }
+            if (LiveInstances != 1 || BackendHandles > 1)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Soak FAILED: handle leak (instances=%lld, backend handles=%d)"), LiveInstances, BackendHandles);
+                Result = 1;
+            }
+
+            ++SampleIndex;
+        }
+
+        // Pace the event rate
+        const double Remaining = SecondsPerEvent - (FPlatformTime::Seconds() - EventStart);
+        if (Remaining > 0.0)
+        {
+            FPlatformProcess::Sleep((float)Remaining);
+        }
+    }
+
+    // ============================================================================
+    // Teardown and Report
+    // ============================================================================
+
+    if (Instance->IsChromeCustomTabOpen())
+    {
+        Instance->CloseChromeCustomTab();
+    }
+    PumpGameThread(0.0f);
+    Instance->RemoveFromRoot();
+    ABCTBackend::SetOverride(nullptr);
+
+    UE_LOG(LogTemp, Display, TEXT("Soak finished after %.0fs: open=%llu nav=%llu deeplink=%llu post=%llu, dispatched nav=%llu deeplink=%llu post=%llu"),
+           FPlatformTime::Seconds() - StartTime,
+           EventCounts[0], EventCounts[1], EventCounts[2], EventCounts[3],
+           ABCTStats::GetCounter(EABCTCounter::NavigationEventsDispatched),
+           ABCTStats::GetCounter(EABCTCounter::DeepLinksDispatched),
+           ABCTStats::GetCounter(EABCTCounter::PostMessagesDispatched));
+    UE_LOG(LogTemp, Display, TEXT("Soak result: %s"), Result == 0 ? TEXT("PASSED") : TEXT("FAILED"));
+    return Result;
+}
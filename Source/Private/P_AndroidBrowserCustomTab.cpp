@@ -5,6 +5,16 @@
  */
 
 #include "P_AndroidBrowserCustomTab.h"
+#include "ABCT_DeepLinkAuth.h"
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_MetricsEndpoint.h"
+#include "ABCT_ResumePipeline.h"
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_TabJobs.h"
+#include "ABCT_TimerWheel.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
 
 // Text localization namespace for this module
 #define LOCTEXT_NAMESPACE "FP_AndroidBrowserCustomTabModule"
@@ -15,8 +25,21 @@
  */
 void FP_AndroidBrowserCustomTabModule::StartupModule()
 {
-	// Module initialization logic goes here
-	// Currently empty as we don't have initialization steps
+	// Every per-frame plugin system runs from this one ticker, in a fixed order
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FP_AndroidBrowserCustomTabModule::Tick), 0.0f);
+
+#if !UE_BUILD_SHIPPING
+	// Optional metrics endpoint for soak/load tests (disabled unless a port is given, never in shipping)
+	int32 MetricsPort = 0;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ABCTMetricsPort="), MetricsPort) && MetricsPort > 0 && MetricsPort <= MAX_uint16)
+	{
+		MetricsEndpoint = MakeUnique<FABCTMetricsEndpoint>();
+		if (!MetricsEndpoint->Start((uint16)MetricsPort))
+		{
+			MetricsEndpoint.Reset();
+		}
+	}
+#endif
 }
 
 /**
@@ -25,8 +48,48 @@ void FP_AndroidBrowserCustomTabModule::StartupModule()
  */
 void FP_AndroidBrowserCustomTabModule::ShutdownModule()
 {
-	// Module cleanup logic goes here
-	// Currently empty as we don't have resources to clean up
+	// Stop the plugin tick before the systems it drives are torn down
+	if (TickHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+		TickHandle.Reset();
+	}
+
+	// Stop the metrics endpoint thread before the module goes away
+	MetricsEndpoint.Reset();
+
+	// Let the verification worker finish before its queue and key are destroyed
+	ABCTDeepLinkAuth::WaitForPending();
+
+	// Stop the background job worker before the jobs it runs go away
+	ABCTTabJobs::Shutdown();
+
+	// Put the volume back if a resume was still ramping it up
+	ABCTResumePipeline::Cancel();
+
+	// Drop the PostMessage channel's queued messages
+	FABCTMessageChannel::Get().Shutdown();
+
+	// Drop the remaining plugin timers; nothing ticks them any more
+	ABCTTimers::Shutdown();
+}
+
+void FP_AndroidBrowserCustomTabModule::Drain()
+{
+	check(IsInGameThread());
+
+	// Before the channel, so messages sent by timers (pings, retries) go out this tick
+	ABCTTimers::Tick();
+	FABCTMessageChannel::Get().Pump();
+	ABCTMemory::Update();
+	ABCTReturnToGame::Update();
+	ABCTResumePipeline::Tick();
+}
+
+bool FP_AndroidBrowserCustomTabModule::Tick(float DeltaTime)
+{
+	Drain();
+	return true;
 }
 
 // Undefine the localization namespace to avoid conflicts
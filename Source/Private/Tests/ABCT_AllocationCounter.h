@@ -0,0 +1,123 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Allocation counting for performance specs.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/MemoryBase.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * FMalloc proxy that counts allocations made on threads with counting switched on.
+ * Installed over GMalloc once, on first use, and never removed or destroyed: other threads
+ * keep allocating through GMalloc at any time, so swapping it back could leave one of them
+ * calling into a dead object. Threads that are not counting only pay a thread-local check.
+ */
+class FABCTCountingMalloc final : public FMalloc
+{
+public:
+    /** Per-thread counting state; constant-initialized, so reading it never allocates */
+    struct FThreadState
+    {
+        bool bCounting = false;
+        int64 Allocations = 0;
+    };
+
+    /** Installs the proxy if it is not installed yet */
+    static void Install()
+    {
+        // Deliberately leaked; see the class comment
+        static FABCTCountingMalloc *const Instance = []()
+        {
+            FABCTCountingMalloc *Proxy = new FABCTCountingMalloc(GMalloc);
+            GMalloc = Proxy;
+            return Proxy;
+        }();
+        (void)Instance;
+    }
+
+    static FThreadState &GetThreadState()
+    {
+        static thread_local FThreadState State;
+        return State;
+    }
+
+    virtual void *Malloc(SIZE_T Count, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->Malloc(Count, Alignment);
+    }
+
+    virtual void *TryMalloc(SIZE_T Count, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->TryMalloc(Count, Alignment);
+    }
+
+    virtual void *Realloc(void *Original, SIZE_T Count, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->Realloc(Original, Count, Alignment);
+    }
+
+    virtual void *TryRealloc(void *Original, SIZE_T Count, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->TryRealloc(Original, Count, Alignment);
+    }
+
+    virtual void Free(void *Original) override { Inner->Free(Original); }
+    virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+    virtual bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+    virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+    virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+    virtual const TCHAR *GetDescriptiveName() override { return TEXT("ABCTCountingMalloc"); }
+
+private:
+    explicit FABCTCountingMalloc(FMalloc *InInner)
+        : Inner(InInner)
+    {
+    }
+
+    static void CountAllocation()
+    {
+        FThreadState &State = GetThreadState();
+        if (State.bCounting)
+        {
+            ++State.Allocations;
+        }
+    }
+
+    FMalloc *Inner;
+};
+
+/** Counts the allocations the current thread makes within a scope */
+class FABCTScopedAllocationCounter
+{
+public:
+    FABCTScopedAllocationCounter()
+    {
+        FABCTCountingMalloc::Install();
+        FABCTCountingMalloc::FThreadState &State = FABCTCountingMalloc::GetThreadState();
+        bWasCounting = State.bCounting;
+        StartAllocations = State.Allocations;
+        State.bCounting = true;
+    }
+
+    ~FABCTScopedAllocationCounter()
+    {
+        FABCTCountingMalloc::GetThreadState().bCounting = bWasCounting;
+    }
+
+    int64 GetAllocations() const { return FABCTCountingMalloc::GetThreadState().Allocations - StartAllocations; }
+
+private:
+    bool bWasCounting;
+    int64 StartAllocations;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,119 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the channel benchmark.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_Benchmark.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_BenchmarkSpec, "Punal.AndroidBrowserCustomTab.Benchmark", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+
+FABCTBenchmarkConfig MakeQuickConfig()
+{
+    FABCTBenchmarkConfig Config;
+    Config.IdleRttSamples = 10;
+    Config.LoadedRttSamples = 10;
+    Config.LoadInFlight = 2;
+    Config.ThroughputSizes = {16, 64 * 1024};
+    Config.ThroughputSeconds = 0.05;
+    return Config;
+}
+
+/** Pumps frames until the benchmark finishes or TimeoutSeconds pass */
+void RunUntilFinished(double TimeoutSeconds)
+{
+    const double EndTime = FPlatformTime::Seconds() + TimeoutSeconds;
+    while (Instance->IsChannelBenchmarkRunning() && FPlatformTime::Seconds() < EndTime)
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(0.0f);
+    }
+}
+
+TSharedPtr<FJsonObject> ParseReport()
+{
+    TSharedPtr<FJsonObject> Report;
+    FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Instance->GetLastChannelBenchmarkReport()), Report);
+    return Report;
+}
+END_DEFINE_SPEC(FABCT_BenchmarkSpec)
+
+void FABCT_BenchmarkSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Backend->bEchoPage = true;
+        ABCTStats::ResetAll(); });
+
+    AfterEach([this]()
+              { ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    It("should run every workload against the simulated echo page and write the report", [this]()
+       {
+        const FString ReportPath = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("ABCT_ChannelBenchmark.json"));
+        TestTrue(TEXT("Started"), Instance->StartChannelBenchmarkWithConfig(MakeQuickConfig(), ReportPath));
+        TestFalse(TEXT("Second start refused"), Instance->StartChannelBenchmark());
+        RunUntilFinished(30.0);
+
+        TestFalse(TEXT("Finished"), Instance->IsChannelBenchmarkRunning());
+        TestFalse(TEXT("Tab closed after the run"), Instance->IsChromeCustomTabOpen());
+        TestTrue(TEXT("Report written"), FPaths::FileExists(ReportPath));
+
+        TSharedPtr<FJsonObject> Report = ParseReport();
+        if (!TestTrue(TEXT("Report is JSON"), Report.IsValid()))
+        {
+            return;
+        }
+        TestEqual(TEXT("Schema"), Report->GetStringField(TEXT("schema")), FString(TEXT("abct-benchmark/1")));
+        TestEqual(TEXT("Backend"), Report->GetStringField(TEXT("backend")), FString(TEXT("simulated")));
+        TestFalse(TEXT("Not aborted"), Report->GetBoolField(TEXT("aborted")));
+        TestEqual(TEXT("Idle RTT samples"), Report->GetObjectField(TEXT("idle_rtt_us"))->GetIntegerField(TEXT("samples")), 10);
+        TestEqual(TEXT("Loaded RTT samples"), Report->GetObjectField(TEXT("loaded_rtt_us"))->GetIntegerField(TEXT("samples")), 10);
+
+        const TArray<TSharedPtr<FJsonValue>> &Throughput = Report->GetArrayField(TEXT("throughput"));
+        if (TestEqual(TEXT("Throughput sizes"), Throughput.Num(), 2))
+        {
+            for (const TSharedPtr<FJsonValue> &Entry : Throughput)
+            {
+                const TSharedPtr<FJsonObject> &Size = Entry->AsObject();
+                TestTrue(TEXT("Messages acked"), Size->GetIntegerField(TEXT("messages")) > 0);
+                TestTrue(TEXT("Bytes per second"), Size->GetNumberField(TEXT("bytes_per_second")) > 0.0);
+                TestEqual(TEXT("Nothing lost"), Size->GetIntegerField(TEXT("lost")), 0);
+            }
+        } });
+
+    It("should abort with a report when the tab closes mid-run", [this]()
+       {
+        Instance->StartChannelBenchmarkWithConfig(MakeQuickConfig(), FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("ABCT_ChannelBenchmark_Abort.json")));
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FTSTicker::GetCoreTicker().Tick(0.0f);
+        Instance->CloseChromeCustomTab();
+        RunUntilFinished(5.0);
+
+        TestFalse(TEXT("Finished"), Instance->IsChannelBenchmarkRunning());
+        TSharedPtr<FJsonObject> Report = ParseReport();
+        if (TestTrue(TEXT("Report is JSON"), Report.IsValid()))
+        {
+            TestTrue(TEXT("Aborted"), Report->GetBoolField(TEXT("aborted")));
+            TestEqual(TEXT("Reason"), Report->GetStringField(TEXT("abort_reason")), FString(TEXT("channel closed")));
+        } });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
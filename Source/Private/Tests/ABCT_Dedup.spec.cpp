@@ -0,0 +1,118 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for idempotency dedup.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_Dedup.h"
+#include "ABCT_Ingress.h"
+#include "ABCT_JsonScan.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_DedupSpec, "Punal.AndroidBrowserCustomTab.Dedup", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+
+void PumpGameThread()
+{
+    FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+    FP_AndroidBrowserCustomTabModule::Drain();
+}
+END_DEFINE_SPEC(FABCT_DedupSpec)
+
+void FABCT_DedupSpec::Define()
+{
+    Describe("FindStringField", [this]()
+             {
+        It("should find a top-level string field without decoding", [this]()
+           {
+            FStringView Value;
+            TestTrue(TEXT("Found"), ABCTJsonScan::FindStringField(TEXT("{\"type\":\"buy\", \"idk\" : \"a1b2\"}"), TEXTVIEW("idk"), Value));
+            TestEqual(TEXT("Value"), FString(Value), FString(TEXT("a1b2"))); });
+
+        It("should ignore nested fields, values and non-string values", [this]()
+           {
+            FStringView Value;
+            TestFalse(TEXT("Nested"), ABCTJsonScan::FindStringField(TEXT("{\"data\":{\"idk\":\"x\"}}"), TEXTVIEW("idk"), Value));
+            TestFalse(TEXT("Value named like the field"), ABCTJsonScan::FindStringField(TEXT("{\"type\":\"idk\"}"), TEXTVIEW("idk"), Value));
+            TestFalse(TEXT("Number"), ABCTJsonScan::FindStringField(TEXT("{\"idk\":42}"), TEXTVIEW("idk"), Value));
+            TestFalse(TEXT("Empty"), ABCTJsonScan::FindStringField(TEXT("{\"idk\":\"\"}"), TEXTVIEW("idk"), Value)); }); });
+
+    Describe("FABCTDedupWindow", [this]()
+             {
+        It("should report repeats within the window and forget them after it", [this]()
+           {
+            FABCTDedupWindow Window(10.0);
+            TestFalse(TEXT("First sighting"), Window.CheckAndInsert(42, 100.0));
+            TestTrue(TEXT("Repeat"), Window.CheckAndInsert(42, 104.0));
+            TestFalse(TEXT("Other key"), Window.CheckAndInsert(43, 104.0));
+            TestFalse(TEXT("Forgotten after the window"), Window.CheckAndInsert(42, 125.0)); });
+
+        It("should stay exact for recent keys when a burst overflows the filter", [this]()
+           {
+            FABCTDedupWindow Window(3600.0);
+            const int32 BurstSize = 100000;
+            int32 FalsePositives = 0;
+            for (int32 Index = 0; Index < BurstSize; ++Index)
+            {
+                const uint64 KeyHash = ((uint64)Index * 0x9e3779b97f4a7c15ull) ^ 0x5555;
+                FalsePositives += Window.CheckAndInsert(KeyHash, 1.0) ? 1 : 0;
+            }
+            AddInfo(FString::Printf(TEXT("%d false positives in %d unique keys"), FalsePositives, BurstSize));
+            TestTrue(TEXT("False positive rate below 0.1%"), FalsePositives * 1000 < BurstSize);
+
+            const uint64 LastKey = ((uint64)(BurstSize - 1) * 0x9e3779b97f4a7c15ull) ^ 0x5555;
+            TestTrue(TEXT("Most recent key remembered"), Window.CheckAndInsert(LastKey, 1.0)); }); });
+
+    Describe("Ingress", [this]()
+             {
+        BeforeEach([this]()
+                   {
+            ABCTIngress::ResetIdempotencyWindow();
+            ABCTSpecFixture::Setup(Backend, Instance);
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            ABCTStats::ResetAll(); });
+
+        AfterEach([this]()
+                  {
+            ABCTSpecFixture::Teardown(Backend, Instance);
+            ABCTIngress::ResetIdempotencyWindow(); });
+
+        It("should dispatch a replayed deep link once", [this]()
+           {
+            const FString Params = TEXT("{\"item\":\"sword\",\"_idk\":\"grant-7\"}");
+            Backend->SimulateDeepLink(TEXT("reward"), Params);
+            Backend->SimulateDeepLink(TEXT("reward"), Params);
+            Backend->SimulateDeepLink(TEXT("reward"), TEXT("{\"item\":\"sword\"}"));
+            PumpGameThread();
+            TestEqual(TEXT("Dispatched"), ABCTStats::GetCounter(EABCTCounter::DeepLinksDispatched), (uint64)2);
+            TestEqual(TEXT("Duplicates"), ABCTStats::GetCounter(EABCTCounter::DuplicatesDropped), (uint64)1); });
+
+        It("should dispatch a re-sent page message once", [this]()
+           {
+            Backend->SimulatePostMessage(TEXT("{\"idk\":\"buy-1\",\"type\":\"purchase\"}"));
+            Backend->SimulatePostMessage(TEXT("{\"idk\":\"buy-1\",\"type\":\"purchase\"}"));
+            Backend->SimulatePostMessage(TEXT("{\"idk\":\"buy-2\",\"type\":\"purchase\"}"));
+            PumpGameThread();
+            TestEqual(TEXT("Dispatched"), ABCTStats::GetCounter(EABCTCounter::PostMessagesDispatched), (uint64)2);
+            TestEqual(TEXT("Duplicates"), ABCTStats::GetCounter(EABCTCounter::DuplicatesDropped), (uint64)1); });
+
+        It("should keep deep link and page message keys apart", [this]()
+           {
+            Backend->SimulateDeepLink(TEXT("reward"), TEXT("{\"_idk\":\"shared\"}"));
+            Backend->SimulatePostMessage(TEXT("{\"idk\":\"shared\"}"));
+            PumpGameThread();
+            TestEqual(TEXT("Duplicates"), ABCTStats::GetCounter(EABCTCounter::DuplicatesDropped), (uint64)0); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,252 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for signed deep links.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkAuth.h"
+#include "ABCT_Ingress.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr double TestNowSeconds = 1718000000.0;
+
+    void PumpGameThread()
+    {
+        ABCTDeepLinkAuth::WaitForPending();
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+
+    FString ToHex(const uint8 (&Digest)[FABCTSha256::DigestSize])
+    {
+        return BytesToHex(Digest, FABCTSha256::DigestSize).ToLower();
+    }
+
+    FString Hmac(const char *Key, const char *Message)
+    {
+        FABCTHmacSha256 Mac(TConstArrayView<uint8>((const uint8 *)Key, FCStringAnsi::Strlen(Key)));
+        uint8 Digest[FABCTSha256::DigestSize];
+        Mac.Compute(TConstArrayView<uint8>((const uint8 *)Message, FCStringAnsi::Strlen(Message)), Digest);
+        return ToHex(Digest);
+    }
+
+    /** Params as the server would issue them: Fields plus nonce, expiry and signature */
+    FString SignedParams(const FString &Action, const TCHAR *Fields, const TCHAR *Nonce, double ExpirySeconds)
+    {
+        const FString Unsigned = FString::Printf(TEXT("{%s\"_nonce\":\"%s\",\"_exp\":\"%.0f\"}"), Fields, Nonce, ExpirySeconds);
+        return Unsigned.LeftChop(1) + FString::Printf(TEXT(",\"_sig\":\"%s\"}"), *ABCTDeepLinkAuth::Sign(Action, Unsigned));
+    }
+
+    double NowUnixSeconds()
+    {
+        return (double)FDateTime::UtcNow().ToUnixTimestamp();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_DeepLinkAuthSpec, "Punal.AndroidBrowserCustomTab.DeepLinkAuth", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+TArray<FString> Dispatched;
+END_DEFINE_SPEC(FABCT_DeepLinkAuthSpec)
+
+void FABCT_DeepLinkAuthSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        ABCTDeepLinkAuth::ResetReplayCache();
+        Dispatched.Reset();
+
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->SetDeepLinkSigningKey(TEXT("test-signing-key"), {TEXT("grant")}); });
+
+    AfterEach([this]()
+              {
+        Instance->OnEvent().Clear();
+        ABCTDeepLinkAuth::WaitForPending();
+        Instance->SetDeepLinkSigningKey(FString(), {});
+        ABCTSpecFixture::Teardown(Backend, Instance);
+        ABCTDeepLinkAuth::ResetReplayCache(); });
+
+    Describe("HMAC-SHA256", [this]()
+             {
+        It("should match the published test vectors", [this]()
+           {
+            FABCTSha256 Sha;
+            Sha.Update((const uint8 *)"abc", 3);
+            uint8 Digest[FABCTSha256::DigestSize];
+            Sha.Final(Digest);
+            TestEqual(TEXT("SHA-256 of abc"), ToHex(Digest), FString(TEXT("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")));
+
+            // RFC 4231 test case 2
+            TestEqual(TEXT("HMAC-SHA256"), Hmac("Jefe", "what do ya want for nothing?"), FString(TEXT("5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"))); }); });
+
+    Describe("Verify", [this]()
+             {
+        It("should accept a signed link once", [this]()
+           {
+            const FString Params = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("n-1"), TestNowSeconds + 60.0);
+            TestTrue(TEXT("Verified"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Params, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified);
+            TestTrue(TEXT("Replay"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Params, TestNowSeconds + 1.0) == EABCTDeepLinkAuthResult::Replayed);
+            TestEqual(TEXT("Verified counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkSignaturesVerified), (uint64)1);
+            TestEqual(TEXT("Replay counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkReplaysRejected), (uint64)1); });
+
+        It("should ignore metadata params added after signing", [this]()
+           {
+            const FString Params = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("n-2"), TestNowSeconds + 60.0);
+            const FString WithMetadata = Params.LeftChop(1) + TEXT(",\"_t\":\"1718000000123.5\",\"_intent_age_us\":2500}");
+            TestTrue(TEXT("Verified"), ABCTDeepLinkAuth::Verify(TEXT("grant"), WithMetadata, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified); });
+
+        It("should reject tampered, expired and malformed links", [this]()
+           {
+            const FString Params = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("n-3"), TestNowSeconds + 60.0);
+            const FString Tampered = Params.Replace(TEXT("sword"), TEXT("crown"));
+            TestTrue(TEXT("Tampered value"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Tampered, TestNowSeconds) == EABCTDeepLinkAuthResult::BadSignature);
+            TestTrue(TEXT("Other action"), ABCTDeepLinkAuth::Verify(TEXT("setflag"), Params, TestNowSeconds) == EABCTDeepLinkAuthResult::BadSignature);
+            TestTrue(TEXT("Expired"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Params, TestNowSeconds + 61.0) == EABCTDeepLinkAuthResult::Expired);
+
+            const FString TooLong = SignedParams(TEXT("grant"), TEXT(""), TEXT("n-4"), TestNowSeconds + ABCTDeepLinkAuth::MaxLifetimeSeconds + 60.0);
+            TestTrue(TEXT("Lifetime over the limit"), ABCTDeepLinkAuth::Verify(TEXT("grant"), TooLong, TestNowSeconds) == EABCTDeepLinkAuthResult::Expired);
+
+            TestTrue(TEXT("Short signature"), ABCTDeepLinkAuth::Verify(TEXT("grant"), TEXT("{\"_nonce\":\"n\",\"_exp\":\"1718000060\",\"_sig\":\"abcd\"}"), TestNowSeconds) == EABCTDeepLinkAuthResult::Malformed);
+            TestEqual(TEXT("Nonce of a rejected link not recorded"), ABCTStats::GetCounter(EABCTCounter::DeepLinkReplaysRejected), (uint64)0);
+            TestTrue(TEXT("Still verifies"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Params, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified); });
+
+        It("should only require signatures for signed actions", [this]()
+           {
+            TestTrue(TEXT("Unsigned grant"), ABCTDeepLinkAuth::Verify(TEXT("Grant"), TEXT("{\"item\":\"sword\"}"), TestNowSeconds) == EABCTDeepLinkAuthResult::MissingSignature);
+            TestTrue(TEXT("Unsigned jump"), ABCTDeepLinkAuth::Verify(TEXT("jump"), TEXT("{\"height\":\"500\"}"), TestNowSeconds) == EABCTDeepLinkAuthResult::Unsigned); });
+
+        It("should require a signature for batches that carry signed actions", [this]()
+           {
+            const FString GrantBatch = TEXT("{\"cmds\":[{\"action\":\"jump\"},{\"action\":\"GRANT\",\"params\":{\"item\":\"sword\"}}]}");
+            TestTrue(TEXT("Unsigned grant in a batch"), ABCTDeepLinkAuth::Verify(TEXT("batch"), GrantBatch, TestNowSeconds) == EABCTDeepLinkAuthResult::MissingSignature);
+            TestTrue(TEXT("String-encoded cmds"), ABCTDeepLinkAuth::Verify(TEXT("batch"), TEXT("{\"cmds\":\"[{\\\"action\\\":\\\"grant\\\"}]\"}"), TestNowSeconds) == EABCTDeepLinkAuthResult::MissingSignature);
+            TestTrue(TEXT("Unsigned batch of other actions"), ABCTDeepLinkAuth::Verify(TEXT("batch"), TEXT("{\"cmds\":[{\"action\":\"jump\"}]}"), TestNowSeconds) == EABCTDeepLinkAuthResult::Unsigned);
+
+            const FString Signed = SignedParams(TEXT("batch"), TEXT("\"cmds\":[{\"action\":\"grant\",\"params\":{\"item\":\"sword\"}}],"), TEXT("n-6"), TestNowSeconds + 60.0);
+            TestTrue(TEXT("Signed batch"), ABCTDeepLinkAuth::Verify(TEXT("batch"), Signed, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified); });
+
+        It("should sign batch commands in compact form", [this]()
+           {
+            const FString Unsigned = TEXT("{\"cmds\":[{\"action\":\"grant\",\"params\":{\"item\":\"sword\"}}],\"_nonce\":\"n-5\",\"_exp\":\"1718000060\"}");
+            const FString Expected = Hmac("test-signing-key", "5:batch4:_exps10:17180000606:_nonces3:n-54:cmdsj46:[{\"action\":\"grant\",\"params\":{\"item\":\"sword\"}}]");
+            TestEqual(TEXT("Signed text"), ABCTDeepLinkAuth::Sign(TEXT("batch"), Unsigned), Expected); });
+
+        It("should not let values pose as other params or types", [this]()
+           {
+            // Both used to sign as "grant\na=1\nb=2"
+            const FString Joined = TEXT("{\"a\":\"1\\nb=2\",\"_nonce\":\"n-7\",\"_exp\":\"1718000060\"}");
+            const FString Split = TEXT("{\"a\":\"1\",\"b\":\"2\",\"_nonce\":\"n-7\",\"_exp\":\"1718000060\"}");
+            const FString SplitSignature = ABCTDeepLinkAuth::Sign(TEXT("grant"), Split);
+            TestNotEqual(TEXT("Different signatures"), ABCTDeepLinkAuth::Sign(TEXT("grant"), Joined), SplitSignature);
+            const FString Forged = Joined.LeftChop(1) + FString::Printf(TEXT(",\"_sig\":\"%s\"}"), *SplitSignature);
+            TestTrue(TEXT("Signature of the split params rejected"), ABCTDeepLinkAuth::Verify(TEXT("grant"), Forged, TestNowSeconds) == EABCTDeepLinkAuthResult::BadSignature);
+
+            const FString AsString = TEXT("{\"count\":\"42\",\"_nonce\":\"n-8\",\"_exp\":\"1718000060\"}");
+            const FString AsNumber = TEXT("{\"count\":42,\"_nonce\":\"n-8\",\"_exp\":\"1718000060\"}");
+            TestNotEqual(TEXT("String and number sign differently"), ABCTDeepLinkAuth::Sign(TEXT("grant"), AsString), ABCTDeepLinkAuth::Sign(TEXT("grant"), AsNumber));
+            const FString SignedSplit = Split.LeftChop(1) + FString::Printf(TEXT(",\"_sig\":\"%s\"}"), *SplitSignature);
+            TestTrue(TEXT("Split params still verify"), ABCTDeepLinkAuth::Verify(TEXT("grant"), SignedSplit, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified); }); });
+
+    Describe("FABCTReplayCache", [this]()
+             {
+        It("should refuse new nonces when full of unexpired ones", [this]()
+           {
+            FABCTReplayCache Cache(2);
+            TestTrue(TEXT("First"), Cache.CheckAndInsert(1, 110.0, 100.0) == FABCTReplayCache::EResult::Fresh);
+            TestTrue(TEXT("Second"), Cache.CheckAndInsert(2, 200.0, 100.0) == FABCTReplayCache::EResult::Fresh);
+            TestTrue(TEXT("Full"), Cache.CheckAndInsert(3, 200.0, 100.0) == FABCTReplayCache::EResult::Full);
+            TestTrue(TEXT("Expired nonce purged"), Cache.CheckAndInsert(3, 200.0, 120.0) == FABCTReplayCache::EResult::Fresh);
+            TestTrue(TEXT("Unexpired nonce kept"), Cache.CheckAndInsert(2, 200.0, 120.0) == FABCTReplayCache::EResult::Replayed);
+            TestEqual(TEXT("Bounded"), Cache.Num(), 2); }); });
+
+    Describe("Ingress", [this]()
+             {
+        BeforeEach([this]()
+                   {
+            Instance->OnEvent().AddLambda([this](const FABCTEventRef &Event)
+                                          {
+                if (Event->GetKind() == EABCTEventKind::DeepLink)
+                {
+                    Dispatched.Add(Event->GetPayload().Contains(TEXT("_sig")) ? Event->GetName() + TEXT("+signed") : Event->GetName());
+                } });
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread(); });
+
+        It("should deliver verified and unsigned links in order and drop the rest", [this]()
+           {
+            const double Expiry = NowUnixSeconds() + 60.0;
+            const FString Grant = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("i-1"), Expiry);
+
+            // Logged on the verification worker, so the count is not pinned
+            AddExpectedError(TEXT("Rejected deep link"), EAutomationExpectedErrorFlags::Contains, 0);
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            Backend->SimulateDeepLink(TEXT("grant"), Grant);
+            Backend->SimulateDeepLink(TEXT("grant"), Grant.Replace(TEXT("sword"), TEXT("crown")));
+            Backend->SimulateDeepLink(TEXT("grant"), TEXT("{\"item\":\"crown\"}"));
+            Backend->SimulateDeepLink(TEXT("teleport"), TEXT("{\"x\":\"1\",\"y\":\"2\",\"z\":\"3\"}"));
+            Backend->SimulateDeepLink(TEXT("grant"), Grant);
+            PumpGameThread();
+
+            TestTrue(TEXT("Order"), Dispatched == TArray<FString>({TEXT("jump"), TEXT("grant+signed"), TEXT("teleport")}));
+            TestEqual(TEXT("Rejected counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkSignaturesRejected), (uint64)2);
+            TestEqual(TEXT("Replay counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkReplaysRejected), (uint64)1);
+            TestEqual(TEXT("Verify queue drained"), ABCTStats::GetGauge(EABCTGauge::DeepLinkVerifyQueueDepth), (int64)0);
+            TestEqual(TEXT("Verify time recorded"), ABCTStats::GetHistogram(EABCTHistogram::DeepLinkVerifyMicros).Count.load(), (uint64)3); });
+
+        It("should not let a rejected link use up an idempotency key", [this]()
+           {
+            ABCTIngress::ResetIdempotencyWindow();
+            const double Expiry = NowUnixSeconds() + 60.0;
+            const FString First = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("i-2"), Expiry).LeftChop(1) + TEXT(",\"_idk\":\"grant-9\"}");
+            const FString Second = SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\","), TEXT("i-3"), Expiry).LeftChop(1) + TEXT(",\"_idk\":\"grant-9\"}");
+
+            AddExpectedError(TEXT("Rejected deep link"), EAutomationExpectedErrorFlags::Contains, 0);
+            Backend->SimulateDeepLink(TEXT("grant"), TEXT("{\"item\":\"sword\",\"_idk\":\"grant-9\"}"));
+            Backend->SimulateDeepLink(TEXT("grant"), First);
+            Backend->SimulateDeepLink(TEXT("grant"), Second);
+            PumpGameThread();
+
+            TestTrue(TEXT("Genuine link delivered once"), Dispatched == TArray<FString>({TEXT("grant+signed")}));
+            TestEqual(TEXT("Only the genuine retry deduplicated"), ABCTStats::GetCounter(EABCTCounter::DuplicatesDropped), (uint64)1);
+            ABCTIngress::ResetIdempotencyWindow(); }); });
+
+    Describe("Throughput", [this]()
+             {
+        It("should verify thousands of links per second", [this]()
+           {
+            const int32 NumLinks = 2000;
+            TArray<FString> Links;
+            Links.Reserve(NumLinks);
+            for (int32 Index = 0; Index < NumLinks; ++Index)
+            {
+                Links.Add(SignedParams(TEXT("grant"), TEXT("\"item\":\"sword\",\"count\":\"2\","), *FString::Printf(TEXT("t-%d"), Index), TestNowSeconds + 60.0));
+            }
+
+            int32 NumVerified = 0;
+            const double StartSeconds = FPlatformTime::Seconds();
+            for (const FString &Params : Links)
+            {
+                NumVerified += ABCTDeepLinkAuth::Verify(TEXT("grant"), Params, TestNowSeconds) == EABCTDeepLinkAuthResult::Verified ? 1 : 0;
+            }
+            const double ElapsedSeconds = FMath::Max(FPlatformTime::Seconds() - StartSeconds, 1e-6);
+
+            AddInfo(FString::Printf(TEXT("%d signed links verified in %.2f ms (%.0f links/s, %.1f us each)"),
+                                    NumVerified, ElapsedSeconds * 1000.0, NumLinks / ElapsedSeconds, ElapsedSeconds * 1e6 / NumLinks));
+            TestEqual(TEXT("All verified"), NumVerified, NumLinks);
+            TestTrue(TEXT("Over 1000 links/s"), NumLinks / ElapsedSeconds > 1000.0); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,146 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for batch deep links.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkBatch.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+
+    /** Three sub-commands, as the Java side delivers them with cmds passed through raw */
+    const TCHAR *GrantBatch = TEXT("{\"cmds\":[")
+                              TEXT("{\"action\":\"grant\",\"params\":{\"item\":\"sword\",\"count\":2}},")
+                              TEXT("{\"action\":\"setflag\",\"params\":{\"name\":\"intro\",\"value\":true}},")
+                              TEXT("{\"action\":\"navigate\"}")
+                              TEXT("]}");
+}
+
+BEGIN_DEFINE_SPEC(FABCT_DeepLinkBatchSpec, "Punal.AndroidBrowserCustomTab.DeepLinkBatch", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+TArray<FString> Dispatched;
+TArray<bool> DispatchedInBatch;
+END_DEFINE_SPEC(FABCT_DeepLinkBatchSpec)
+
+void FABCT_DeepLinkBatchSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        Dispatched.Reset();
+        DispatchedInBatch.Reset();
+
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->OnEvent().AddLambda([this](const FABCTEventRef &Event)
+                                      {
+            if (Event->GetKind() == EABCTEventKind::DeepLink)
+            {
+                Dispatched.Add(Event->GetName());
+                DispatchedInBatch.Add(Instance->IsDispatchingDeepLinkBatch());
+            } }); });
+
+    AfterEach([this]()
+              {
+        Instance->OnEvent().Clear();
+        ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    Describe("Decode", [this]()
+             {
+        It("should decode sub-commands in order with flat string params", [this]()
+           {
+            TArray<FABCTEventRef> Commands;
+            FString Error;
+            if (!TestTrue(TEXT("Decoded"), ABCTDeepLinkBatch::Decode(GrantBatch, Commands, Error)) || !TestEqual(TEXT("Commands"), Commands.Num(), 3))
+            {
+                return;
+            }
+            TestEqual(TEXT("First action"), Commands[0]->GetName(), FString(TEXT("grant")));
+            TestEqual(TEXT("Last action"), Commands[2]->GetName(), FString(TEXT("navigate")));
+            TestEqual(TEXT("Scalar params as strings"), Commands[0]->GetPayload(), FString(TEXT("{\"item\":\"sword\",\"count\":\"2\"}")));
+            TestEqual(TEXT("Missing params"), Commands[2]->GetPayload(), FString(TEXT("{}"))); });
+
+        It("should accept cmds delivered as a string", [this]()
+           {
+            TArray<FABCTEventRef> Commands;
+            FString Error;
+            TestTrue(TEXT("Decoded"), ABCTDeepLinkBatch::Decode(TEXT("{\"cmds\":\"[{\\\"action\\\":\\\"grant\\\"}]\"}"), Commands, Error));
+            TestEqual(TEXT("Commands"), Commands.Num(), 1); });
+
+        It("should reject the whole batch if any command is malformed", [this]()
+           {
+            const TCHAR *Malformed[] = {
+                TEXT("{\"cmds\":[{\"action\":\"grant\"},{\"params\":{}}]}"),
+                TEXT("{\"cmds\":[{\"action\":\"grant\"},{\"action\":\"batch\"}]}"),
+                TEXT("{\"cmds\":[{\"action\":\"grant\",\"params\":{\"item\":{\"id\":1}}}]}"),
+                TEXT("{\"text\":\"no commands\"}"),
+            };
+            for (const TCHAR *ParamsJson : Malformed)
+            {
+                TArray<FABCTEventRef> Commands;
+                FString Error;
+                TestFalse(FString::Printf(TEXT("Rejected: %s"), ParamsJson), ABCTDeepLinkBatch::Decode(ParamsJson, Commands, Error));
+                TestEqual(TEXT("Nothing decoded"), Commands.Num(), 0);
+                TestFalse(TEXT("Error set"), Error.IsEmpty());
+            } });
+
+        It("should reject batches over the command limit", [this]()
+           {
+            FString ParamsJson = TEXT("{\"cmds\":[");
+            for (int32 Index = 0; Index <= ABCTDeepLinkBatch::MaxCommands; ++Index)
+            {
+                ParamsJson += Index > 0 ? TEXT(",{\"action\":\"grant\"}") : TEXT("{\"action\":\"grant\"}");
+            }
+            ParamsJson += TEXT("]}");
+
+            TArray<FABCTEventRef> Commands;
+            FString Error;
+            TestFalse(TEXT("Oversized batch rejected"), ABCTDeepLinkBatch::Decode(ParamsJson, Commands, Error)); }); });
+
+    Describe("Dispatch", [this]()
+             {
+        BeforeEach([this]()
+                   {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread(); });
+
+        It("should dispatch every sub-command in one pump", [this]()
+           {
+            Backend->SimulateDeepLink(TEXT("batch"), GrantBatch);
+            PumpGameThread();
+
+            TestTrue(TEXT("Order"), Dispatched == TArray<FString>({TEXT("grant"), TEXT("setflag"), TEXT("navigate")}));
+            TestTrue(TEXT("Sub-commands flagged"), DispatchedInBatch == TArray<bool>({true, true, true}));
+            TestFalse(TEXT("Flag cleared"), Instance->IsDispatchingDeepLinkBatch());
+            TestEqual(TEXT("Last action"), Instance->GetLastDeepLinkAction(), FString(TEXT("navigate")));
+            TestEqual(TEXT("Dispatched counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinksDispatched), (uint64)3);
+            TestEqual(TEXT("Batches counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkBatchesReceived), (uint64)1); });
+
+        It("should dispatch nothing from a malformed batch", [this]()
+           {
+            AddExpectedError(TEXT("Rejected batch"), EAutomationExpectedErrorFlags::Contains, 1);
+            Backend->SimulateDeepLink(TEXT("batch"), TEXT("{\"cmds\":[{\"action\":\"grant\"},{\"action\":\"\"}]}"));
+            PumpGameThread();
+
+            TestEqual(TEXT("Nothing dispatched"), Dispatched.Num(), 0);
+            TestEqual(TEXT("Dispatched counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinksDispatched), (uint64)0);
+            TestEqual(TEXT("Rejected counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkBatchesRejected), (uint64)1); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
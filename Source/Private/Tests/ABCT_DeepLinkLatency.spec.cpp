@@ -0,0 +1,137 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for deep link latency tracing.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkLatency.h"
+#include "ABCT_ClockSync.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+
+    /** A tap AgoMillis ago on the page clock, as the page would put it in the link */
+    FString PageTapParam(double AgoMillis)
+    {
+        const FABCTClockSync &ClockSync = FABCTMessageChannel::Get().GetClockSync();
+        const double OffsetMillis = ClockSync.HasEstimate() ? ClockSync.GetOffsetMillis() : 0.0;
+        return FString::Printf(TEXT("%.1f"), ABCTClock::NowMillis() + OffsetMillis - AgoMillis);
+    }
+
+    uint64 StageCount(EABCTHistogram Histogram)
+    {
+        return ABCTStats::GetHistogram(Histogram).Count.load();
+    }
+
+    /** Labels stay registered across ResetAll, so an action seen by an earlier test reads as 0 */
+    uint64 EndToEndCount(const TCHAR *Action)
+    {
+        const FABCTHistogram *Histogram = ABCTStats::FindDeepLinkEndToEnd(Action);
+        return Histogram ? Histogram->Count.load() : 0;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_DeepLinkLatencySpec, "Punal.AndroidBrowserCustomTab.DeepLinkLatency", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+END_DEFINE_SPEC(FABCT_DeepLinkLatencySpec)
+
+void FABCT_DeepLinkLatencySpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        ABCTSpecFixture::Setup(Backend, Instance); });
+
+    AfterEach([this]()
+              { ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    Describe("Trace", [this]()
+             {
+        It("should place the page tap and intent receipt from the link params", [this]()
+           {
+            const FABCTDeepLinkTrace Trace = ABCTDeepLinkLatency::Begin(TEXT("{\"height\":\"500\",\"_t\":\"1718000000123.5\",\"_intent_age_us\":2500}"));
+            const double JniEntryMillis = Trace.StampMillis[(int32)EABCTDeepLinkStamp::JniEntry];
+            TestTrue(TEXT("JNI entry stamped"), JniEntryMillis > 0.0);
+            TestEqual(TEXT("Page tap"), Trace.StampMillis[(int32)EABCTDeepLinkStamp::PageTap], 1718000000123.5);
+            TestEqual(TEXT("Intent received"), Trace.StampMillis[(int32)EABCTDeepLinkStamp::IntentReceived], JniEntryMillis - 2.5, 0.001);
+            TestFalse(TEXT("Queued not yet stamped"), Trace.HasStamp(EABCTDeepLinkStamp::Queued)); });
+
+        It("should leave the page stages out for links without timestamps", [this]()
+           {
+            const FABCTDeepLinkTrace Trace = ABCTDeepLinkLatency::Begin(TEXT("{\"height\":\"500\"}"));
+            TestFalse(TEXT("No page tap"), Trace.HasStamp(EABCTDeepLinkStamp::PageTap));
+            TestFalse(TEXT("No intent"), Trace.HasStamp(EABCTDeepLinkStamp::IntentReceived)); }); });
+
+    Describe("Histograms", [this]()
+             {
+        BeforeEach([this]()
+                   {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread(); });
+
+        It("should record every stage and the end-to-end latency of the action", [this]()
+           {
+            Backend->SimulateDeepLink(TEXT("jump"), FString::Printf(TEXT("{\"height\":\"500\",\"_t\":\"%s\",\"_intent_age_us\":1000}"), *PageTapParam(40.0)));
+            PumpGameThread();
+
+            const EABCTHistogram Stages[] = {
+                EABCTHistogram::DeepLinkStageBrowserMicros,
+                EABCTHistogram::DeepLinkStageBridgeMicros,
+                EABCTHistogram::DeepLinkStageIngressMicros,
+                EABCTHistogram::DeepLinkStageQueueMicros,
+                EABCTHistogram::DeepLinkStageDecodeMicros,
+                EABCTHistogram::DeepLinkStageDispatchMicros,
+                EABCTHistogram::DeepLinkStageHandlerMicros,
+            };
+            for (const EABCTHistogram Stage : Stages)
+            {
+                TestEqual(FString::Printf(TEXT("Stage %d recorded"), (int32)Stage), StageCount(Stage), (uint64)1);
+            }
+
+            const FABCTHistogram *EndToEnd = ABCTStats::FindDeepLinkEndToEnd(TEXT("jump"));
+            if (TestNotNull(TEXT("End-to-end for jump"), EndToEnd))
+            {
+                TestEqual(TEXT("One sample"), EndToEnd->Count.load(), (uint64)1);
+                TestTrue(TEXT("Includes the 40ms before JNI entry"), EndToEnd->Sum.load() >= 39000);
+            }
+            TestEqual(TEXT("No other action"), EndToEndCount(TEXT("teleport")), (uint64)0); });
+
+        It("should only record the game stages without a page timestamp", [this]()
+           {
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            PumpGameThread();
+
+            TestEqual(TEXT("No browser stage"), StageCount(EABCTHistogram::DeepLinkStageBrowserMicros), (uint64)0);
+            TestEqual(TEXT("No bridge stage"), StageCount(EABCTHistogram::DeepLinkStageBridgeMicros), (uint64)0);
+            TestEqual(TEXT("Queue stage"), StageCount(EABCTHistogram::DeepLinkStageQueueMicros), (uint64)1);
+            TestEqual(TEXT("Handler stage"), StageCount(EABCTHistogram::DeepLinkStageHandlerMicros), (uint64)1);
+            TestEqual(TEXT("No end-to-end"), EndToEndCount(TEXT("jump")), (uint64)0); });
+
+        It("should record a batch as one tap", [this]()
+           {
+            Backend->SimulateDeepLink(TEXT("batch"), FString::Printf(TEXT("{\"cmds\":[{\"action\":\"grant\"},{\"action\":\"jump\"}],\"_t\":\"%s\"}"), *PageTapParam(10.0)));
+            PumpGameThread();
+
+            TestEqual(TEXT("Handler stage once"), StageCount(EABCTHistogram::DeepLinkStageHandlerMicros), (uint64)1);
+            TestEqual(TEXT("End-to-end under batch"), EndToEndCount(TEXT("batch")), (uint64)1);
+            TestEqual(TEXT("Not under sub-commands"), EndToEndCount(TEXT("jump")), (uint64)0); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
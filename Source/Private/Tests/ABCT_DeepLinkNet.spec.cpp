@@ -0,0 +1,212 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for deep link replication payloads.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkNet.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_DeepLinkNetComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/Package.h"
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    struct FTestLink
+    {
+        const TCHAR *Action;
+        const TCHAR *ParamsJson;
+    };
+
+    /** A burst of links as the Java side delivers them */
+    const FTestLink TestLinks[] = {
+        {TEXT("teleport"), TEXT("{\"x\":\"1000\",\"y\":\"-25.5\",\"z\":\"500\"}")},
+        {TEXT("jump"), TEXT("{\"height\":\"500\"}")},
+        {TEXT("buy"), TEXT("{\"item\":\"1042\",\"quantity\":\"3\"}")},
+        {TEXT("teleport"), TEXT("{\"x\":\"-12034.7\",\"y\":\"88210.2\",\"z\":\"120\"}")},
+        {TEXT("jump"), TEXT("{\"height\":\"250.75\"}")},
+        {TEXT("buy"), TEXT("{\"item\":\"7\",\"quantity\":\"-1\"}")},
+        {TEXT("teleport"), TEXT("{\"x\":\"0\",\"y\":\"0\",\"z\":\"0\"}")},
+        {TEXT("jump"), TEXT("{\"height\":\"1200\"}")},
+    };
+
+    TArray<FABCTNetDeepLinkActionSpec> MakeSpecs()
+    {
+        TArray<FABCTNetDeepLinkActionSpec> Specs;
+
+        FABCTNetDeepLinkActionSpec &Teleport = Specs.AddDefaulted_GetRef();
+        Teleport.Action = TEXT("teleport");
+        Teleport.bHasLocation = true;
+
+        FABCTNetDeepLinkActionSpec &Jump = Specs.AddDefaulted_GetRef();
+        Jump.Action = TEXT("jump");
+        Jump.FloatParams.Add(TEXT("height"));
+
+        FABCTNetDeepLinkActionSpec &Buy = Specs.AddDefaulted_GetRef();
+        Buy.Action = TEXT("buy");
+        Buy.IntParams.Add(TEXT("item"));
+        Buy.IntParams.Add(TEXT("quantity"));
+        return Specs;
+    }
+
+    /** Writes Batch and reads it back, like one RPC parameter */
+    bool RoundTrip(FABCTNetDeepLinkBatch &Batch, FABCTNetDeepLinkBatch &OutBatch, int64 &OutBits)
+    {
+        FBitWriter Writer(0, true);
+        bool bSuccess = false;
+        Batch.NetSerialize(Writer, nullptr, bSuccess);
+        OutBits = Writer.GetNumBits();
+
+        FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+        bool bReadSuccess = false;
+        OutBatch.NetSerialize(Reader, nullptr, bReadSuccess);
+        return bSuccess && bReadSuccess && !Reader.IsError();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_DeepLinkNetSpec, "Punal.AndroidBrowserCustomTab.DeepLinkNet", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+UCPP_ABCT_DeepLinkNetComponent *Component;
+
+FABCTNetDeepLinkBatch EncodeTestLinks()
+{
+    FABCTNetDeepLinkBatch Batch;
+    for (const FTestLink &Link : TestLinks)
+    {
+        Component->EncodeDeepLink(Link.Action, Link.ParamsJson, Batch.Actions.AddDefaulted_GetRef());
+    }
+    return Batch;
+}
+END_DEFINE_SPEC(FABCT_DeepLinkNetSpec)
+
+void FABCT_DeepLinkNetSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        Component = NewObject<UCPP_ABCT_DeepLinkNetComponent>(GetTransientPackage());
+        Component->AddToRoot();
+        Component->SetActionSpecs(MakeSpecs()); });
+
+    AfterEach([this]()
+              {
+        Component->RemoveFromRoot();
+        Component = nullptr; });
+
+    Describe("Encoding", [this]()
+             {
+        It("should type params by the action spec", [this]()
+           {
+            FABCTNetDeepLinkAction Action;
+            TestTrue(TEXT("teleport is replicated"), Component->EncodeDeepLink(TEXT("teleport"), TestLinks[0].ParamsJson, Action));
+            TestEqual(TEXT("Action id"), Action.ActionId, 0);
+            TestEqual(TEXT("Location"), Action.Location, FVector(1000.0, -25.5, 500.0));
+
+            TestTrue(TEXT("buy is replicated"), Component->EncodeDeepLink(TEXT("buy"), TestLinks[5].ParamsJson, Action));
+            int32 Quantity = 0;
+            TestTrue(TEXT("quantity present"), Component->GetIntParam(Action, TEXT("quantity"), Quantity));
+            TestEqual(TEXT("quantity"), Quantity, -1);
+
+            TestFalse(TEXT("Unlisted action"), Component->EncodeDeepLink(TEXT("message"), TEXT("{\"text\":\"hi\"}"), Action)); });
+
+        It("should not encode actions with more params than a batch can carry", [this]()
+           {
+            TArray<FABCTNetDeepLinkActionSpec> Specs = MakeSpecs();
+            FABCTNetDeepLinkActionSpec &Wide = Specs.AddDefaulted_GetRef();
+            Wide.Action = TEXT("wide");
+            for (int32 Index = 0; Index <= FABCTNetDeepLinkBatch::MaxValuesPerAction; ++Index)
+            {
+                Wide.FloatParams.Add(FName(TEXT("value"), Index));
+            }
+            Component->SetActionSpecs(Specs);
+
+            AddExpectedError(TEXT("more than"), EAutomationExpectedErrorFlags::Contains, 1);
+            FABCTNetDeepLinkAction Action;
+            TestFalse(TEXT("Too many floats"), Component->EncodeDeepLink(TEXT("wide"), TEXT("{}"), Action));
+            TestTrue(TEXT("Other actions still encode"), Component->EncodeDeepLink(TEXT("jump"), TestLinks[1].ParamsJson, Action)); });
+
+        It("should survive NetSerialize with quantized locations", [this]()
+           {
+            FABCTNetDeepLinkBatch Batch = EncodeTestLinks();
+            FABCTNetDeepLinkBatch Received;
+            int64 Bits = 0;
+            if (!TestTrue(TEXT("Round trip"), RoundTrip(Batch, Received, Bits)) || !TestEqual(TEXT("Actions"), Received.Actions.Num(), Batch.Actions.Num()))
+            {
+                return;
+            }
+
+            for (int32 Index = 0; Index < Batch.Actions.Num(); ++Index)
+            {
+                const FABCTNetDeepLinkAction &Sent = Batch.Actions[Index];
+                const FABCTNetDeepLinkAction &Got = Received.Actions[Index];
+                TestEqual(TEXT("Action id"), Got.ActionId, Sent.ActionId);
+                TestTrue(TEXT("Location within 0.1 units"), Got.Location.Equals(Sent.Location, 0.051));
+                TestTrue(TEXT("Ints"), Got.Ints == Sent.Ints);
+                TestTrue(TEXT("Floats"), Got.Floats == Sent.Floats);
+            }
+            TestEqual(TEXT("Applied on the server"), Component->ApplyBatch(Received), Batch.Actions.Num()); });
+
+        It("should reject counts over the limits when reading", [this]()
+           {
+            FBitWriter Writer(0, true);
+            uint32 NumActions = FABCTNetDeepLinkBatch::MaxActions + 1;
+            Writer.SerializeIntPacked(NumActions);
+
+            FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+            FABCTNetDeepLinkBatch Batch;
+            bool bSuccess = true;
+            Batch.NetSerialize(Reader, nullptr, bSuccess);
+            TestFalse(TEXT("Oversized batch rejected"), bSuccess);
+            TestEqual(TEXT("Nothing allocated"), Batch.Actions.Num(), 0); });
+
+        It("should drop actions that do not match their spec", [this]()
+           {
+            FABCTNetDeepLinkBatch Batch = EncodeTestLinks();
+            Batch.Actions[1].Floats.Add(1.0f);
+            Batch.Actions[2].ActionId = 99;
+
+            AddExpectedError(TEXT("Rejected malformed action"), EAutomationExpectedErrorFlags::Contains, 2);
+            TestEqual(TEXT("Applied"), Component->ApplyBatch(Batch), Batch.Actions.Num() - 2);
+            TestEqual(TEXT("Rejected counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkNetActionsRejected), (uint64)2); });
+
+        It("should drop actions with non-finite values", [this]()
+           {
+            FABCTNetDeepLinkBatch Batch = EncodeTestLinks();
+            Batch.Actions[1].Floats[0] = std::numeric_limits<float>::quiet_NaN();
+            Batch.Actions[4].Floats[0] = std::numeric_limits<float>::infinity();
+            Batch.Actions[0].Location.X = std::numeric_limits<double>::infinity();
+
+            AddExpectedError(TEXT("Rejected malformed action"), EAutomationExpectedErrorFlags::Contains, 3);
+            TestEqual(TEXT("Applied"), Component->ApplyBatch(Batch), Batch.Actions.Num() - 3);
+            TestEqual(TEXT("Rejected counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinkNetActionsRejected), (uint64)3); }); });
+
+    Describe("Bandwidth", [this]()
+             {
+        It("should be a fraction of per-link string RPCs", [this]()
+           {
+            // Baseline: Server RPC(FString Action, FString ParamsJson) per link, parameters only
+            int64 StringBits = 0;
+            for (const FTestLink &Link : TestLinks)
+            {
+                FBitWriter Writer(0, true);
+                FString Action = Link.Action;
+                FString ParamsJson = Link.ParamsJson;
+                Writer << Action << ParamsJson;
+                StringBits += Writer.GetNumBits();
+            }
+
+            FABCTNetDeepLinkBatch Batch = EncodeTestLinks();
+            FABCTNetDeepLinkBatch Received;
+            int64 BatchBits = 0;
+            TestTrue(TEXT("Round trip"), RoundTrip(Batch, Received, BatchBits));
+
+            AddInfo(FString::Printf(TEXT("%d links: string RPC params %lld bits in %d RPCs, batch %lld bits in 1 RPC (%.1f%%)"),
+                                    (int32)UE_ARRAY_COUNT(TestLinks), StringBits, (int32)UE_ARRAY_COUNT(TestLinks), BatchBits, 100.0 * BatchBits / StringBits));
+            TestTrue(TEXT("Batch is under a quarter of the string payloads"), BatchBits * 4 < StringBits); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
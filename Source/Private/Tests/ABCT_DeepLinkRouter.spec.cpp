@@ -0,0 +1,157 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for gameplay tag deep link dispatch.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_DeepLinkRouter.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "CPP_ABCT_DeepLinkTagMap.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ABCTTest_DeepLink, "ABCTTest.DeepLink");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ABCTTest_DeepLink_Teleport, "ABCTTest.DeepLink.Teleport");
+    UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_ABCTTest_DeepLink_Jump, "ABCTTest.DeepLink.Jump");
+
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_DeepLinkRouterSpec, "Punal.AndroidBrowserCustomTab.DeepLinkRouter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+UCPP_ABCT_DeepLinkTagMap *TagMap;
+TArray<TPair<FGameplayTag, FDelegateHandle>> Handles;
+TArray<FABCTDeepLinkEvent> Received;
+
+/** Records every event dispatched for Tag (or its children) into Received */
+void Listen(FGameplayTag Tag)
+{
+    Handles.Emplace(Tag, ABCTDeepLinkRouter::AddHandler(Tag, FABCTDeepLinkTagEvent::FDelegate::CreateLambda([this](const FABCTDeepLinkEvent &Event)
+                                                                                                            { Received.Add(Event); })));
+}
+END_DEFINE_SPEC(FABCT_DeepLinkRouterSpec)
+
+void FABCT_DeepLinkRouterSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        Received.Reset();
+
+        TagMap = NewObject<UCPP_ABCT_DeepLinkTagMap>(GetTransientPackage());
+        TagMap->AddToRoot();
+        TagMap->ActionTags.Add(TEXT("teleport"), TAG_ABCTTest_DeepLink_Teleport);
+        TagMap->ActionTags.Add(TEXT("jump"), TAG_ABCTTest_DeepLink_Jump);
+
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->SetDeepLinkTagMap(TagMap);
+        Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+        PumpGameThread(); });
+
+    AfterEach([this]()
+              {
+        for (const TPair<FGameplayTag, FDelegateHandle> &Handle : Handles)
+        {
+            ABCTDeepLinkRouter::RemoveHandler(Handle.Key, Handle.Value);
+        }
+        Handles.Reset();
+
+        ABCTSpecFixture::Teardown(Backend, Instance);
+        TagMap->RemoveFromRoot();
+        TagMap = nullptr; });
+
+    Describe("Tag map", [this]()
+             {
+        It("should resolve actions case-insensitively", [this]()
+           {
+            TestEqual(TEXT("teleport"), TagMap->FindTag(TEXT("teleport")), FGameplayTag(TAG_ABCTTest_DeepLink_Teleport));
+            TestEqual(TEXT("TELEPORT"), TagMap->FindTag(TEXT("TELEPORT")), FGameplayTag(TAG_ABCTTest_DeepLink_Teleport));
+            TestFalse(TEXT("Unmapped action"), TagMap->FindTag(TEXT("message")).IsValid());
+            TestFalse(TEXT("Never-seen action"), TagMap->FindTag(TEXT("abct_no_such_action_name_3f1c")).IsValid()); }); });
+
+    Describe("Dispatch", [this]()
+             {
+        It("should fire the mapped tag with decoded params", [this]()
+           {
+            Listen(TAG_ABCTTest_DeepLink_Teleport);
+            Backend->SimulateDeepLink(TEXT("teleport"), TEXT("{\"x\":\"1000\",\"y\":\"-25.5\",\"z\":\"500\"}"));
+            PumpGameThread();
+
+            if (!TestEqual(TEXT("Events received"), Received.Num(), 1))
+            {
+                return;
+            }
+            const FABCTDeepLinkEvent &Event = Received[0];
+            TestEqual(TEXT("Tag"), Event.Tag, FGameplayTag(TAG_ABCTTest_DeepLink_Teleport));
+            TestEqual(TEXT("Action"), Event.GetAction(), FString(TEXT("teleport")));
+            TestTrue(TEXT("Instance"), Event.Instance == Instance);
+
+            float Y = 0.0f;
+            TestTrue(TEXT("y present"), Event.GetParamAsFloat(TEXT("y"), Y));
+            TestEqual(TEXT("y"), Y, -25.5f);
+            const FString *X = Event.FindParam(TEXT("x"));
+            TestTrue(TEXT("x"), X && *X == TEXT("1000"));
+            TestEqual(TEXT("Routed counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinksRoutedByTag), (uint64)1); });
+
+        It("should not add param keys to the name table", [this]()
+           {
+            Listen(TAG_ABCTTest_DeepLink_Teleport);
+            Backend->SimulateDeepLink(TEXT("teleport"), TEXT("{\"abct_no_such_param_name_7d2e\":\"1\"}"));
+            PumpGameThread();
+
+            TestEqual(TEXT("Events received"), Received.Num(), 1);
+            TestTrue(TEXT("Param decoded"), Received.Num() == 1 && Received[0].FindParam(TEXT("ABCT_NO_SUCH_PARAM_NAME_7D2E")) != nullptr);
+            TestTrue(TEXT("No FName created"), FName(TEXT("abct_no_such_param_name_7d2e"), FNAME_Find).IsNone()); });
+
+        It("should reach handlers of parent tags, most specific first", [this]()
+           {
+            TArray<FString> Order;
+            Handles.Emplace(TAG_ABCTTest_DeepLink, ABCTDeepLinkRouter::AddHandler(TAG_ABCTTest_DeepLink, FABCTDeepLinkTagEvent::FDelegate::CreateLambda([&Order](const FABCTDeepLinkEvent &)
+                                                                                                                                                            { Order.Add(TEXT("parent")); })));
+            Handles.Emplace(TAG_ABCTTest_DeepLink_Jump, ABCTDeepLinkRouter::AddHandler(TAG_ABCTTest_DeepLink_Jump, FABCTDeepLinkTagEvent::FDelegate::CreateLambda([&Order](const FABCTDeepLinkEvent &)
+                                                                                                                                                                 { Order.Add(TEXT("jump")); })));
+
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            Backend->SimulateDeepLink(TEXT("teleport"), TEXT("{}"));
+            PumpGameThread();
+
+            TestEqual(TEXT("Dispatch order"), FString::Join(Order, TEXT(",")), FString(TEXT("jump,parent,parent"))); });
+
+        It("should leave unmapped actions to Blueprint", [this]()
+           {
+            Listen(TAG_ABCTTest_DeepLink);
+            Backend->SimulateDeepLink(TEXT("message"), TEXT("{\"text\":\"Hello\"}"));
+            PumpGameThread();
+
+            TestEqual(TEXT("No tag events"), Received.Num(), 0);
+            TestEqual(TEXT("Still dispatched"), Instance->GetLastDeepLinkAction(), FString(TEXT("message")));
+            TestEqual(TEXT("Routed counter"), ABCTStats::GetCounter(EABCTCounter::DeepLinksRoutedByTag), (uint64)0); });
+
+        It("should stop calling removed handlers", [this]()
+           {
+            Listen(TAG_ABCTTest_DeepLink_Jump);
+            ABCTDeepLinkRouter::RemoveHandler(Handles[0].Key, Handles[0].Value);
+            Handles.Reset();
+
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{}"));
+            PumpGameThread();
+            TestEqual(TEXT("No events"), Received.Num(), 0);
+            TestEqual(TEXT("Still routed"), ABCTStats::GetCounter(EABCTCounter::DeepLinksRoutedByTag), (uint64)1); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
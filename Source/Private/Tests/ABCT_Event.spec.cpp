@@ -0,0 +1,146 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for shared event payloads.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Event.h"
+#include "ABCT_AllocationCounter.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "CPP_ABCT_Base.h"
+#include "CPP_ABCT_EventLibrary.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_EventSpec, "Punal.AndroidBrowserCustomTab.Event", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+TArray<FABCTEventRef> Received;
+
+/** Adds Count native listeners that record the payload address into Seen (capacity reserved up front) */
+void AddPointerListeners(int32 Count, TArray<const FABCTEvent *> &Seen)
+{
+    Seen.Reserve(Seen.Num() + Count * 64);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Instance->OnEvent().AddLambda([&Seen](const FABCTEventRef &Event)
+                                      { Seen.Add(&Event.Get()); });
+    }
+}
+END_DEFINE_SPEC(FABCT_EventSpec)
+
+void FABCT_EventSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        Received.Reset();
+        ABCTSpecFixture::Setup(Backend, Instance); });
+
+    AfterEach([this]()
+              {
+        // Listeners capture locals of the finished test; drop them before more events arrive
+        Instance->OnEvent().Clear();
+        ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    Describe("Payload", [this]()
+             {
+        It("should expose the fields of each kind", [this]()
+           {
+            const FABCTEventRef Navigation = FABCTEvent::MakeNavigation(TEXT("NavigationFinished"), ABCTUrlTable::Intern(TEXT("HTTPS://Example.com:443/a")));
+            TestEqual(TEXT("Navigation kind"), Navigation->GetKind(), EABCTEventKind::Navigation);
+            TestEqual(TEXT("Navigation name"), Navigation->GetName(), FString(TEXT("NavigationFinished")));
+            TestEqual(TEXT("Navigation URL"), Navigation->GetUrlString(), FString(TEXT("https://example.com/a")));
+
+            const FABCTEventRef DeepLink = FABCTEvent::MakeDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            TestEqual(TEXT("Deep link kind"), DeepLink->GetKind(), EABCTEventKind::DeepLink);
+            TestEqual(TEXT("Deep link action"), DeepLink->GetName(), FString(TEXT("jump")));
+            TestEqual(TEXT("Deep link params"), DeepLink->GetPayload(), FString(TEXT("{\"height\":\"500\"}")));
+            TestTrue(TEXT("Deep link has no URL"), DeepLink->GetUrlString().IsEmpty());
+
+            const FABCTEventRef Message = FABCTEvent::MakePageMessage(TEXT("{\"type\":\"buy\"}"), TEXT("https://example.com"));
+            TestEqual(TEXT("Message kind"), Message->GetKind(), EABCTEventKind::PageMessage);
+            TestEqual(TEXT("Message payload"), Message->GetPayload(), FString(TEXT("{\"type\":\"buy\"}")));
+            TestEqual(TEXT("Message origin"), Message->GetOrigin(), FString(TEXT("https://example.com"))); });
+
+        It("should read through a Blueprint handle", [this]()
+           {
+            const FABCTEventHandle Handle(FABCTEvent::MakeDeepLink(TEXT("teleport"), TEXT("{\"x\":\"1\"}")));
+            TestTrue(TEXT("Valid"), UCPP_ABCT_EventLibrary::IsEventValid(Handle));
+            TestEqual(TEXT("Kind"), UCPP_ABCT_EventLibrary::GetEventKind(Handle), EABCTEventKind::DeepLink);
+            TestEqual(TEXT("Name"), UCPP_ABCT_EventLibrary::GetEventName(Handle), FString(TEXT("teleport")));
+            TestEqual(TEXT("Payload"), UCPP_ABCT_EventLibrary::GetEventPayload(Handle), FString(TEXT("{\"x\":\"1\"}")));
+
+            const FABCTEventHandle Copy = Handle;
+            TestTrue(TEXT("Copies share the payload"), &Copy.Get() == &Handle.Get());
+
+            const FABCTEventHandle Empty;
+            TestFalse(TEXT("Empty handle"), UCPP_ABCT_EventLibrary::IsEventValid(Empty));
+            TestTrue(TEXT("Empty handle name"), UCPP_ABCT_EventLibrary::GetEventName(Empty).IsEmpty()); }); });
+
+    Describe("Fan-out", [this]()
+             {
+        It("should hand every listener the payload created at ingress", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            Instance->OnEvent().AddLambda([this](const FABCTEventRef &Event)
+                                          { Received.Add(Event); });
+            TArray<const FABCTEvent *> Seen;
+            AddPointerListeners(3, Seen);
+
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            Backend->SimulatePostMessage(TEXT("{\"type\":\"buy\"}"));
+            PumpGameThread();
+
+            if (!TestEqual(TEXT("Events received"), Received.Num(), 2))
+            {
+                return;
+            }
+            TestEqual(TEXT("First is the deep link"), Received[0]->GetKind(), EABCTEventKind::DeepLink);
+            TestEqual(TEXT("Second is the page message"), Received[1]->GetKind(), EABCTEventKind::PageMessage);
+            TestEqual(TEXT("Every listener called"), Seen.Num(), 6);
+            for (int32 Index = 0; Index < Seen.Num(); ++Index)
+            {
+                TestTrue(TEXT("Listeners share one payload"), Seen[Index] == &Received[Index / 3].Get());
+            }
+            TestEqual(TEXT("Legacy state still updated"), Instance->GetLastDeepLinkAction(), FString(TEXT("jump"))); });
+
+        It("should not allocate per listener", [this]()
+           {
+            TArray<const FABCTEvent *> Seen;
+            const FABCTEventRef Event = FABCTEvent::MakeDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+
+            auto MeasureDispatch = [this, &Event]()
+            {
+                FABCTScopedAllocationCounter AllocationCounter;
+                Instance->HandleDeepLink(Event);
+                return AllocationCounter.GetAllocations();
+            };
+
+            AddPointerListeners(1, Seen);
+            MeasureDispatch();
+            const int64 WithOneListener = MeasureDispatch();
+
+            AddPointerListeners(15, Seen);
+            MeasureDispatch();
+            const int64 WithSixteenListeners = MeasureDispatch();
+
+            TestEqual(TEXT("Allocations with 16 listeners vs 1"), WithSixteenListeners, WithOneListener);
+            TestTrue(TEXT("All listeners saw the same payload"), Seen.Num() > 0 && Seen.Last() == &Event.Get()); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,279 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs and benchmark for the streaming JSON writer.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_AllocationCounter.h"
+#include "ABCT_JsonWriter.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include <limits>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Sizes of the state messages the benchmark builds, in characters */
+    const int32 BenchmarkMessageChars[] = {1024, 10 * 1024, 50 * 1024};
+    const int32 BenchmarkIterations = 200;
+
+    /** Writes a typical state message: a header plus EntityCount entity objects */
+    void WriteStateMessage(FABCTJsonWriter &Writer, int32 EntityCount)
+    {
+        Writer.BeginObject();
+        Writer.Field(TEXT("type"), TEXT("state"));
+        Writer.Field(TEXT("tick"), 123456);
+        Writer.Key(TEXT("entities"));
+        Writer.BeginArray();
+        for (int32 Index = 0; Index < EntityCount; ++Index)
+        {
+            Writer.BeginObject();
+            Writer.Field(TEXT("id"), Index);
+            Writer.Field(TEXT("name"), TEXT("Entity \"Alpha\""));
+            Writer.Field(TEXT("hp"), 87.25 + Index);
+            Writer.Key(TEXT("pos"));
+            Writer.BeginArray();
+            Writer.Value(1000.5 * Index);
+            Writer.Value(-25.125);
+            Writer.Value(500.0);
+            Writer.EndArray();
+            Writer.Field(TEXT("alive"), (Index % 3) != 0);
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+    }
+
+    /** The same message built through FJsonObject + FJsonSerializer */
+    void WriteStateMessageDom(FString &Out, int32 EntityCount)
+    {
+        TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+        Root->SetStringField(TEXT("type"), TEXT("state"));
+        Root->SetNumberField(TEXT("tick"), 123456);
+
+        TArray<TSharedPtr<FJsonValue>> Entities;
+        for (int32 Index = 0; Index < EntityCount; ++Index)
+        {
+            TSharedRef<FJsonObject> Entity = MakeShared<FJsonObject>();
+            Entity->SetNumberField(TEXT("id"), Index);
+            Entity->SetStringField(TEXT("name"), TEXT("Entity \"Alpha\""));
+            Entity->SetNumberField(TEXT("hp"), 87.25 + Index);
+            TArray<TSharedPtr<FJsonValue>> Pos;
+            Pos.Add(MakeShared<FJsonValueNumber>(1000.5 * Index));
+            Pos.Add(MakeShared<FJsonValueNumber>(-25.125));
+            Pos.Add(MakeShared<FJsonValueNumber>(500.0));
+            Entity->SetArrayField(TEXT("pos"), Pos);
+            Entity->SetBoolField(TEXT("alive"), (Index % 3) != 0);
+            Entities.Add(MakeShared<FJsonValueObject>(Entity));
+        }
+        Root->SetArrayField(TEXT("entities"), Entities);
+
+        Out.Reset();
+        FJsonSerializer::Serialize(Root, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out));
+    }
+
+    /** Smallest entity count whose state message is at least TargetChars long */
+    int32 EntityCountForChars(int32 TargetChars)
+    {
+        FString Probe;
+        FABCTJsonWriter Writer(Probe);
+        WriteStateMessage(Writer, 1);
+        return FMath::Max(1, FMath::DivideAndRoundUp(TargetChars, Probe.Len()));
+    }
+
+    struct FBuildCost
+    {
+        double MicrosPerMessage;
+        double AllocationsPerMessage;
+    };
+
+    template <typename BuildFuncType>
+    FBuildCost MeasureBuild(BuildFuncType &&Build)
+    {
+        // Warm up caches and let reused buffers reach their final size
+        Build();
+
+        int64 Allocations = 0;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        {
+            FABCTScopedAllocationCounter AllocationCounter;
+            for (int32 Iteration = 0; Iteration < BenchmarkIterations; ++Iteration)
+            {
+                Build();
+            }
+            Allocations = AllocationCounter.GetAllocations();
+        }
+        FBuildCost Cost;
+        Cost.MicrosPerMessage = (double)ABCTStats::CyclesToMicros(FPlatformTime::Cycles64() - StartCycles) / BenchmarkIterations;
+        Cost.AllocationsPerMessage = (double)Allocations / BenchmarkIterations;
+        return Cost;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_JsonWriterSpec, "Punal.AndroidBrowserCustomTab.JsonWriter", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+FString Buffer;
+
+TSharedPtr<FJsonObject> Parse(const FString &Json)
+{
+    TSharedPtr<FJsonObject> Object;
+    FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object);
+    return Object;
+}
+END_DEFINE_SPEC(FABCT_JsonWriterSpec)
+
+void FABCT_JsonWriterSpec::Define()
+{
+    BeforeEach([this]()
+               { Buffer.Reset(); });
+
+    It("should write nested objects and arrays with the right separators", [this]()
+       {
+        FABCTJsonWriter Writer(Buffer);
+        Writer.BeginObject();
+        Writer.Field(TEXT("a"), 1);
+        Writer.Key(TEXT("b"));
+        Writer.BeginArray();
+        Writer.Value(true);
+        Writer.Null();
+        Writer.BeginObject();
+        Writer.EndObject();
+        Writer.BeginArray();
+        Writer.EndArray();
+        Writer.EndArray();
+        Writer.Key(TEXT("c"));
+        Writer.RawValue(TEXT("{\"x\":[1,2]}"));
+        TestFalse(TEXT("Incomplete while open"), Writer.IsComplete());
+        Writer.EndObject();
+
+        TestTrue(TEXT("Complete"), Writer.IsComplete());
+        TestEqual(TEXT("Output"), Buffer, FString(TEXT("{\"a\":1,\"b\":[true,null,{},[]],\"c\":{\"x\":[1,2]}}"))); });
+
+    It("should escape strings so they parse back unchanged", [this]()
+       {
+        FString Tricky = TEXT("quote\" backslash\\ newline\n tab\t bell");
+        Tricky.AppendChar(TCHAR(0x07));
+        Tricky += TEXT(" unicode \u00e9\u4e2d");
+        FABCTJsonWriter Writer(Buffer);
+        Writer.BeginObject();
+        Writer.Field(TEXT("key \"q\""), Tricky);
+        Writer.EndObject();
+
+        TSharedPtr<FJsonObject> Parsed = Parse(Buffer);
+        if (TestTrue(TEXT("Parses"), Parsed.IsValid()))
+        {
+            TestEqual(TEXT("Value round trips"), Parsed->GetStringField(TEXT("key \"q\"")), Tricky);
+        }
+        TestTrue(TEXT("Control characters use \\u"), Buffer.Contains(TEXT("\\u0007"))); });
+
+    It("should format numbers exactly and write non-finite ones as null", [this]()
+       {
+        FABCTJsonWriter Writer(Buffer);
+        Writer.BeginArray();
+        Writer.Value(MIN_int64);
+        Writer.Value(MAX_uint64);
+        Writer.Value(0);
+        Writer.Value(3.0);
+        Writer.Value(-0.5);
+        Writer.Value(0.1);
+        Writer.Value(std::numeric_limits<double>::quiet_NaN());
+        Writer.Value(std::numeric_limits<double>::infinity());
+        Writer.EndArray();
+
+        TestEqual(TEXT("Output"), Buffer, FString(TEXT("[-9223372036854775808,18446744073709551615,0,3,-0.5,0.10000000000000001,null,null]"))); });
+
+    It("should not allocate when the buffer is reserved", [this]()
+       {
+        const int32 EntityCount = EntityCountForChars(10 * 1024);
+        Buffer.Reset(16 * 1024);
+        int64 Allocations = 0;
+        {
+            FABCTScopedAllocationCounter AllocationCounter;
+            FABCTJsonWriter Writer(Buffer);
+            WriteStateMessage(Writer, EntityCount);
+            Allocations = AllocationCounter.GetAllocations();
+        }
+        TestEqual(TEXT("Allocations"), Allocations, (int64)0);
+        TestTrue(TEXT("State message parses"), Parse(Buffer).IsValid()); });
+
+    It("should send through the channel and reuse the buffers of sent messages", [this]()
+       {
+        TSharedPtr<FABCTSimulatedBackend> Backend;
+        UCPP_ABCT_Base *Instance = nullptr;
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+        Backend->ClearSentMessages();
+        ABCTStats::ResetAll();
+
+        for (int32 Round = 0; Round < 2; ++Round)
+        {
+            TestTrue(TEXT("Queued"), Instance->SendJsonToPage([Round](FABCTJsonWriter &Writer)
+                                                              {
+                Writer.BeginObject();
+                Writer.Field(TEXT("type"), TEXT("hello"));
+                Writer.Field(TEXT("round"), Round);
+                Writer.EndObject(); }));
+            FP_AndroidBrowserCustomTabModule::Drain();
+        }
+
+        AddExpectedError(TEXT("complete JSON value"), EAutomationExpectedErrorFlags::Contains, 1);
+        TestFalse(TEXT("Incomplete JSON refused"), Instance->SendJsonToPage([](FABCTJsonWriter &Writer)
+                                                                            { Writer.BeginObject(); }));
+
+        const TArray<FString> &Sent = Backend->GetSentMessages();
+        if (TestEqual(TEXT("Frames"), Sent.Num(), 2))
+        {
+            TSharedPtr<FJsonObject> Second = Parse(Sent[1]);
+            TestTrue(TEXT("Second message parses"), Second.IsValid() && Second->GetIntegerField(TEXT("round")) == 1);
+        }
+        TestTrue(TEXT("Pooled buffer reused"), ABCTStats::GetCounter(EABCTCounter::OutboundPayloadBuffersReused) >= 1);
+
+        ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    // ============================================================================
+    // Benchmark: streaming writer vs FJsonObject + FJsonSerializer
+    // ============================================================================
+
+    It("should build typical state messages faster than the DOM path and without allocating", [this]()
+       {
+        for (const int32 TargetChars : BenchmarkMessageChars)
+        {
+            const int32 EntityCount = EntityCountForChars(TargetChars);
+
+            FString DomOut;
+            const FBuildCost Dom = MeasureBuild([&DomOut, EntityCount]()
+                                                { WriteStateMessageDom(DomOut, EntityCount); });
+
+            FString StreamOut;
+            const FBuildCost Stream = MeasureBuild([&StreamOut, EntityCount]()
+                                                   {
+                StreamOut.Reset();
+                FABCTJsonWriter Writer(StreamOut);
+                WriteStateMessage(Writer, EntityCount); });
+
+            AddInfo(FString::Printf(TEXT("%6d chars: DOM %8.1f us %7.1f allocs | writer %8.1f us %5.1f allocs | %.1fx"),
+                                    StreamOut.Len(), Dom.MicrosPerMessage, Dom.AllocationsPerMessage,
+                                    Stream.MicrosPerMessage, Stream.AllocationsPerMessage,
+                                    Dom.MicrosPerMessage / FMath::Max(Stream.MicrosPerMessage, 0.001)));
+
+            TSharedPtr<FJsonObject> Parsed = Parse(StreamOut);
+            TestTrue(TEXT("Writer output parses"), Parsed.IsValid() && Parsed->GetArrayField(TEXT("entities")).Num() == EntityCount);
+            TestEqual(TEXT("Writer allocations per message"), Stream.AllocationsPerMessage, 0.0);
+            TestTrue(TEXT("Writer is faster than the DOM path"), Stream.MicrosPerMessage < Dom.MicrosPerMessage);
+        } });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
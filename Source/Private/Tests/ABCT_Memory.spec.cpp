@@ -0,0 +1,151 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the memory budget.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Dedup.h"
+#include "ABCT_Memory.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_Stats.h"
+#include "ABCT_UrlTable.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Stands in for queued page traffic without opening a tab */
+    constexpr int64 PressureBytes = 1024 * 1024;
+}
+
+BEGIN_DEFINE_SPEC(FABCT_MemorySpec, "Punal.AndroidBrowserCustomTab.Memory", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+int64 SavedBudgetBytes;
+int64 AddedPressureBytes;
+
+/** Puts the plugin PressureBytes over a budget set just above its current usage */
+void ApplyPressure()
+{
+    ABCTMemory::SetBudgetBytes(ABCTMemory::GetTotalBytes() + PressureBytes / 2);
+    ABCTMemory::Track(EABCTMemoryPool::Queues, PressureBytes);
+    AddedPressureBytes += PressureBytes;
+}
+
+void ReleasePressure()
+{
+    ABCTMemory::Track(EABCTMemoryPool::Queues, -AddedPressureBytes);
+    AddedPressureBytes = 0;
+}
+END_DEFINE_SPEC(FABCT_MemorySpec)
+
+void FABCT_MemorySpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        SavedBudgetBytes = ABCTMemory::GetBudgetBytes();
+        AddedPressureBytes = 0;
+        FABCTMessageChannel::Get().Reset(); });
+
+    AfterEach([this]()
+              {
+        ReleasePressure();
+        FABCTMessageChannel::Get().Reset();
+        ABCTMemory::SetBudgetBytes(SavedBudgetBytes);
+        ABCTMemory::ResetShedding(); });
+
+    Describe("Tracking", [this]()
+             {
+        It("should count queued outbound messages until they are dropped", [this]()
+           {
+            const int64 Before = ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging);
+            FABCTMessageChannel::Get().Send(EABCTMessageLane::Bulk, FString::ChrN(4000, TEXT('x')));
+            TestTrue(TEXT("Payload counted"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging) - Before >= 4000 * (int64)sizeof(TCHAR));
+
+            FABCTMessageChannel::Get().DropQueued(EABCTMessageLane::Bulk);
+            TestEqual(TEXT("Released on drop"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging), Before); });
+
+        It("should count interned URLs until they are trimmed", [this]()
+           {
+            ABCTUrlTable::Intern(TEXT("https://example.com/memory-spec/a"));
+            const FABCTUrlRef Newest = ABCTUrlTable::Intern(TEXT("https://example.com/memory-spec/b"));
+            const uint32 NewestId = Newest->GetId();
+            TestTrue(TEXT("Caches counted"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches) > 0);
+
+            const int64 Before = ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches);
+            ABCTUrlTable::Trim(1);
+            TestEqual(TEXT("One entry left"), ABCTUrlTable::Num(), 1);
+            TestTrue(TEXT("Newest kept"), ABCTUrlTable::Find(NewestId) == Newest);
+            TestTrue(TEXT("Evicted entries released"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches) < Before); });
+
+        It("should count a dedup window for as long as it lives", [this]()
+           {
+            const int64 Before = ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches);
+            {
+                FABCTDedupWindow Window;
+                TestTrue(TEXT("Window counted"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches) > Before);
+            }
+            TestEqual(TEXT("Released with the window"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Caches), Before); }); });
+
+    Describe("Shedding", [this]()
+             {
+        It("should shed one step per update in order", [this]()
+           {
+            ApplyPressure();
+            AddExpectedError(TEXT("Over budget"), EAutomationExpectedErrorFlags::Contains, 3);
+
+            ABCTMemory::Update();
+            TestTrue(TEXT("Bulk dropped first"), ABCTMemory::GetShedLevel() == EABCTShedLevel::DropBulk);
+            ABCTMemory::Update();
+            TestTrue(TEXT("Caches shrunk second"), ABCTMemory::GetShedLevel() == EABCTShedLevel::ShrinkCaches);
+            TestTrue(TEXT("URL table cut"), ABCTUrlTable::Num() <= ABCTMemory::ShrunkUrlEntries);
+            ABCTMemory::Update();
+            TestTrue(TEXT("Tracing disabled last"), ABCTMemory::GetShedLevel() == EABCTShedLevel::DisableTracing);
+            TestFalse(TEXT("Tracing off"), ABCTMemory::IsTracingEnabled());
+            ABCTMemory::Update();
+            TestTrue(TEXT("Stays at the last step"), ABCTMemory::GetShedLevel() == EABCTShedLevel::DisableTracing);
+            TestEqual(TEXT("Steps counted"), ABCTStats::GetCounter(EABCTCounter::MemoryShedSteps), (uint64)3); });
+
+        It("should drop queued bulk messages and refuse new ones", [this]()
+           {
+            const int64 Before = ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging);
+            FABCTMessageChannel::Get().Send(EABCTMessageLane::Bulk, FString::ChrN(4000, TEXT('x')));
+            ApplyPressure();
+            AddExpectedError(TEXT("Over budget"), EAutomationExpectedErrorFlags::Contains, 1);
+            ABCTMemory::Update();
+            TestEqual(TEXT("Queued bulk dropped"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging), Before);
+
+            FABCTMessageChannel::Get().Send(EABCTMessageLane::Bulk, FString::ChrN(4000, TEXT('x')));
+            TestEqual(TEXT("New bulk refused"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging), Before);
+            TestEqual(TEXT("Both counted as dropped"), ABCTStats::GetCounter(EABCTCounter::OutboundMessagesDropped), (uint64)2);
+
+            FABCTMessageChannel::Get().Send(EABCTMessageLane::Interactive, TEXT("{\"type\":\"hello\"}"));
+            TestTrue(TEXT("Interactive still queued"), ABCTMemory::GetTrackedBytes(EABCTMemoryPool::Messaging) > Before); });
+
+        It("should undo every step once usage falls under the recovery mark", [this]()
+           {
+            ApplyPressure();
+            AddExpectedError(TEXT("Over budget"), EAutomationExpectedErrorFlags::Contains, 2);
+            ABCTMemory::Update();
+            ABCTMemory::Update();
+
+            // Within budget but above the recovery mark: hold the current step
+            ABCTMemory::SetBudgetBytes(ABCTMemory::GetTotalBytes() + 1);
+            ABCTMemory::Update();
+            TestTrue(TEXT("Held between the marks"), ABCTMemory::GetShedLevel() == EABCTShedLevel::ShrinkCaches);
+
+            ReleasePressure();
+            ABCTMemory::SetBudgetBytes(ABCTMemory::GetTotalBytes() * 2 + PressureBytes);
+            ABCTMemory::Update();
+            TestTrue(TEXT("Recovered"), ABCTMemory::GetShedLevel() == EABCTShedLevel::None);
+            TestTrue(TEXT("Tracing back on"), ABCTMemory::IsTracingEnabled()); });
+
+        It("should never shed without a budget", [this]()
+           {
+            ApplyPressure();
+            ABCTMemory::SetBudgetBytes(0);
+            ABCTMemory::Update();
+            TestTrue(TEXT("No shedding"), ABCTMemory::GetShedLevel() == EABCTShedLevel::None); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,247 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the PostMessage channel.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_ClockSync.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_MessageChannelSpec, "Punal.AndroidBrowserCustomTab.MessageChannel", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+FABCTOutboundConfig SavedConfig;
+FABCTInboundConfig SavedInboundConfig;
+
+/** Parses a chunk frame; returns false for plain messages */
+bool ParseChunk(const FString &Frame, int32 &OutSeq, int32 &OutCount, FString &OutData)
+{
+    if (!Frame.StartsWith(TEXT("{\"abct\":\"chunk\"")))
+    {
+        return false;
+    }
+    TSharedPtr<FJsonObject> Json;
+    if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Frame), Json) || !Json.IsValid())
+    {
+        return false;
+    }
+    OutSeq = Json->GetIntegerField(TEXT("seq"));
+    OutCount = Json->GetIntegerField(TEXT("of"));
+    OutData = Json->GetStringField(TEXT("data"));
+    return true;
+}
+END_DEFINE_SPEC(FABCT_MessageChannelSpec)
+
+void FABCT_MessageChannelSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        SavedConfig = FABCTMessageChannel::Get().GetOutboundConfig();
+        SavedInboundConfig = FABCTMessageChannel::Get().GetInboundConfig();
+
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+
+        // Flush the initial credit grant so each test starts from an empty frame log
+        FP_AndroidBrowserCustomTabModule::Drain();
+        Backend->ClearSentMessages(); });
+
+    AfterEach([this]()
+              {
+        ABCTSpecFixture::Teardown(Backend, Instance);
+        FABCTMessageChannel::Get().SetOutboundConfig(SavedConfig);
+        FABCTMessageChannel::Get().SetInboundConfig(SavedInboundConfig); });
+
+    It("should send small messages in one frame once the channel is ready", [this]()
+       {
+        TestTrue(TEXT("Channel ready"), FABCTMessageChannel::Get().IsReady());
+        Instance->SendMessageToPage(TEXT("{\"type\":\"hello\"}"));
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Frames"), Backend->GetSentMessages().Num(), 1);
+        const FString &Frame = Backend->GetSentMessages()[0];
+        TestTrue(TEXT("Stamped with the send time"), Frame.StartsWith(TEXT("{\"_ts\":")));
+        TestTrue(TEXT("Payload follows the stamp"), Frame.EndsWith(TEXT(",\"type\":\"hello\"}"))); });
+
+    It("should send messages unchanged when stamping is off", [this]()
+       {
+        FABCTOutboundConfig Config;
+        Config.bStampFrames = false;
+        FABCTMessageChannel::Get().SetOutboundConfig(Config);
+        Instance->SendMessageToPage(TEXT("{\"type\":\"hello\"}"));
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Payload"), Backend->GetSentMessages()[0], FString(TEXT("{\"type\":\"hello\"}"))); });
+
+    It("should let a Control message overtake a Bulk transfer", [this]()
+       {
+        FABCTOutboundConfig Config;
+        Config.ChunkSizeChars = 1024;
+        Config.MaxCharsPerTick = 1024;
+        FABCTMessageChannel::Get().SetOutboundConfig(Config);
+
+        Instance->SendMessageToPage(FString::ChrN(8 * 1024, TEXT('s')), EABCTMessageLane::Bulk);
+        FP_AndroidBrowserCustomTabModule::Drain();
+        Instance->SendMessageToPage(TEXT("urgent"), EABCTMessageLane::Control);
+        FP_AndroidBrowserCustomTabModule::Drain();
+
+        TestEqual(TEXT("Frames after two ticks"), Backend->GetSentMessages().Num(), 2);
+        TestEqual(TEXT("Control frame sent second, before the rest of the bulk"), Backend->GetSentMessages()[1], FString(TEXT("urgent")));
+        TestEqual(TEXT("Bulk still queued"), FABCTMessageChannel::Get().GetQueuedCount(EABCTMessageLane::Bulk), 1); });
+
+    It("should chunk large messages so the page can reassemble them", [this]()
+       {
+        FABCTOutboundConfig Config;
+        Config.ChunkSizeChars = 1000;
+        FABCTMessageChannel::Get().SetOutboundConfig(Config);
+
+        FString Original;
+        for (int32 Index = 0; Index < 700; ++Index)
+        {
+            Original += FString::Printf(TEXT("{\"k\":\"v%d\\n\"},"), Index);
+        }
+        Instance->SendMessageToPage(Original, EABCTMessageLane::Bulk);
+        for (int32 Tick = 0; Tick < 64 && FABCTMessageChannel::Get().GetQueuedCount(EABCTMessageLane::Bulk) > 0; ++Tick)
+        {
+            FP_AndroidBrowserCustomTabModule::Drain();
+        }
+
+        FString Reassembled;
+        int32 ExpectedSeq = 0;
+        for (const FString &Frame : Backend->GetSentMessages())
+        {
+            int32 Seq = 0, Count = 0;
+            FString Data;
+            TestTrue(TEXT("Frame is a chunk"), ParseChunk(Frame, Seq, Count, Data));
+            TestEqual(TEXT("Chunks arrive in order"), Seq, ExpectedSeq++);
+            Reassembled += Data;
+        }
+        TestTrue(TEXT("More than one chunk"), ExpectedSeq > 1);
+        TestEqual(TEXT("Reassembled payload"), Reassembled, Original); });
+
+    It("should retry frames the browser rejects", [this]()
+       {
+        Backend->bRejectPostMessages = true;
+        Instance->SendMessageToPage(TEXT("retry me"), EABCTMessageLane::Interactive);
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Nothing sent"), Backend->GetSentMessages().Num(), 0);
+        Backend->bRejectPostMessages = false;
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Sent on retry"), Backend->GetSentMessages().Num(), 1); });
+
+    It("should drop queued messages when the tab closes", [this]()
+       {
+        Backend->bRejectPostMessages = true;
+        Instance->SendMessageToPage(TEXT("never delivered"));
+        Instance->CloseChromeCustomTab();
+        TestEqual(TEXT("Queue emptied"), FABCTMessageChannel::Get().GetQueuedCount(EABCTMessageLane::Interactive), 0); });
+
+    It("should grant the full receive window when the channel opens", [this]()
+       {
+        Instance->CloseChromeCustomTab();
+        Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+
+        const FString Expected = FString::Printf(TEXT("{\"abct\":\"credit\",\"grant\":%d,\"window\":%d}"),
+                                                 SavedInboundConfig.ReceiveWindow, SavedInboundConfig.ReceiveWindow);
+        TestTrue(TEXT("Credit frame sent"), Backend->GetSentMessages().Contains(Expected)); });
+
+    It("should dispatch a bounded number of inbound messages per tick and re-grant credits", [this]()
+       {
+        FABCTInboundConfig InboundConfig;
+        InboundConfig.ReceiveWindow = 8;
+        InboundConfig.MaxDispatchPerTick = 3;
+        InboundConfig.GrantBatch = 3;
+        FABCTMessageChannel::Get().SetInboundConfig(InboundConfig);
+        FABCTMessageChannel::Get().SetReady(true);
+        FP_AndroidBrowserCustomTabModule::Drain();
+        Backend->ClearSentMessages();
+
+        for (int32 Index = 0; Index < 6; ++Index)
+        {
+            Backend->SimulatePostMessage(FString::Printf(TEXT("{\"seq\":%d}"), Index));
+        }
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Still queued after one tick"), FABCTMessageChannel::Get().GetInboundQueuedCount(), 3);
+
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestEqual(TEXT("Drained after two ticks"), FABCTMessageChannel::Get().GetInboundQueuedCount(), 0);
+        TestTrue(TEXT("Credits re-granted"), Backend->GetSentMessages().ContainsByPredicate([](const FString &Frame)
+                                                                                          { return Frame.StartsWith(TEXT("{\"abct\":\"credit\"")); })); });
+
+    It("should drop overflow and ask the page to slow down", [this]()
+       {
+        FABCTInboundConfig InboundConfig;
+        InboundConfig.ReceiveWindow = 4;
+        FABCTMessageChannel::Get().SetInboundConfig(InboundConfig);
+
+        const uint64 DroppedBefore = ABCTStats::GetCounter(EABCTCounter::InboundMessagesDropped);
+        for (int32 Index = 0; Index < 10; ++Index)
+        {
+            Backend->SimulatePostMessage(TEXT("{\"type\":\"flood\"}"));
+        }
+        TestEqual(TEXT("Queue bounded by the window"), FABCTMessageChannel::Get().GetInboundQueuedCount(), 4);
+        TestEqual(TEXT("Overflow dropped"), ABCTStats::GetCounter(EABCTCounter::InboundMessagesDropped) - DroppedBefore, (uint64)6);
+
+        FP_AndroidBrowserCustomTabModule::Drain();
+        TestTrue(TEXT("Slowdown sent"), Backend->GetSentMessages().ContainsByPredicate([](const FString &Frame)
+                                                                                      { return Frame.StartsWith(TEXT("{\"abct\":\"slowdown\"")); })); });
+
+    Describe("Clock sync", [this]()
+             {
+        It("should estimate the page clock offset from ping/pong", [this]()
+           {
+            // Reopening the channel pings right away
+            FABCTMessageChannel::Get().SetReady(true);
+            FP_AndroidBrowserCustomTabModule::Drain();
+            const FString *Ping = Backend->GetSentMessages().FindByPredicate([](const FString &Frame)
+                                                                            { return Frame.StartsWith(TEXT("{\"abct\":\"ping\"")); });
+            TestNotNull(TEXT("Ping sent"), Ping);
+            if (Ping == nullptr)
+            {
+                return;
+            }
+
+            // A page whose clock runs 5 seconds ahead, answering instantly
+            TSharedPtr<FJsonObject> PingJson;
+            FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(*Ping), PingJson);
+            const double T0 = PingJson->GetNumberField(TEXT("t0"));
+            const double PageNow = ABCTClock::NowMillis() + 5000.0;
+            Backend->SimulatePostMessage(FString::Printf(TEXT("{\"abct\":\"pong\",\"id\":1,\"t0\":%.3f,\"t1\":%.3f,\"t2\":%.3f,\"rx\":[[\"state\",%.3f,%.3f]]}"),
+                                                         T0, PageNow, PageNow, T0, PageNow));
+            FP_AndroidBrowserCustomTabModule::Drain();
+
+            const FABCTClockSync &ClockSync = FABCTMessageChannel::Get().GetClockSync();
+            TestTrue(TEXT("Estimate available"), ClockSync.HasEstimate());
+            TestTrue(FString::Printf(TEXT("Offset %.1fms close to 5000ms"), ClockSync.GetOffsetMillis()), FMath::Abs(ClockSync.GetOffsetMillis() - 5000.0) < 250.0);
+            TestNotNull(TEXT("Game -> page latency recorded from rx"), ABCTStats::FindOneWayLatency(EABCTLatencyDirection::GameToPage, TEXTVIEW("state")));
+
+            // Page message stamped with the page clock
+            const uint64 Before = ABCTStats::FindOneWayLatency(EABCTLatencyDirection::PageToGame, TEXTVIEW("score")) ? ABCTStats::FindOneWayLatency(EABCTLatencyDirection::PageToGame, TEXTVIEW("score"))->Count.load() : 0;
+            Backend->SimulatePostMessage(FString::Printf(TEXT("{\"_ts\":%.3f,\"type\":\"score\"}"), ABCTClock::NowMillis() + ClockSync.GetOffsetMillis()));
+            FP_AndroidBrowserCustomTabModule::Drain();
+            const FABCTHistogram *PageToGame = ABCTStats::FindOneWayLatency(EABCTLatencyDirection::PageToGame, TEXTVIEW("score"));
+            TestTrue(TEXT("Page -> game latency recorded"), PageToGame != nullptr && PageToGame->Count.load() == Before + 1); });
+
+        It("should keep protocol messages away from the game", [this]()
+           {
+            const uint64 Before = ABCTStats::GetCounter(EABCTCounter::PostMessagesDispatched);
+            Backend->SimulatePostMessage(TEXT("{\"abct\":\"pong\",\"id\":7}"));
+            FP_AndroidBrowserCustomTabModule::Drain();
+            TestEqual(TEXT("Not dispatched"), ABCTStats::GetCounter(EABCTCounter::PostMessagesDispatched), Before); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
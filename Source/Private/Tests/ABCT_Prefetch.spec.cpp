@@ -0,0 +1,204 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the asset prefetch map.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_Prefetch.h"
+#include "ABCT_Stats.h"
+#include "ABCT_UrlTable.h"
+#include "CPP_ABCT_Base.h"
+#include "CPP_ABCT_PrefetchMap.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** An engine asset every project has */
+    const TCHAR *CubePath = TEXT("/Engine/BasicShapes/Cube.Cube");
+
+    /** Never exists, so its load is still in flight when the spec moves on */
+    const TCHAR *MissingPath = TEXT("/Game/ABCTPrefetchSpec/Missing.Missing");
+
+    FABCTPrefetchRequest MakeRequest(const TCHAR *Path)
+    {
+        FABCTPrefetchRequest Request;
+        Request.ObjectPaths.Add(FSoftObjectPath(Path));
+        Request.Key = Path;
+        return Request;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_PrefetchSpec, "Punal.AndroidBrowserCustomTab.Prefetch", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+UCPP_ABCT_PrefetchMap *Map;
+
+FABCTPrefetchRule &AddRule(const FString &Host, const FString &PathPattern, const FString &ObjectPath)
+{
+    FABCTPrefetchRule &Rule = Map->Rules.AddDefaulted_GetRef();
+    Rule.Host = Host;
+    Rule.PathPattern = PathPattern;
+    Rule.ObjectPaths.Add(ObjectPath);
+    return Rule;
+}
+
+FABCTPrefetchRequest ResolvePage(const FString &URL)
+{
+    FABCTPrefetchRequest Request;
+    Map->ResolvePage(FABCTUrl(URL), Request);
+    return Request;
+}
+END_DEFINE_SPEC(FABCT_PrefetchSpec)
+
+void FABCT_PrefetchSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        Map = NewObject<UCPP_ABCT_PrefetchMap>(GetTransientPackage());
+        Map->AddToRoot(); });
+
+    AfterEach([this]()
+              {
+        Map->RemoveFromRoot();
+        Map = nullptr; });
+
+    Describe("Matching", [this]()
+             {
+        It("should match hosts exactly or by domain", [this]()
+           {
+            TestTrue(TEXT("Any"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT(""), TEXT("store.example.com")));
+            TestTrue(TEXT("Exact"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT("Store.Example.com"), TEXT("store.example.com")));
+            TestTrue(TEXT("Subdomain"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT("*.example.com"), TEXT("store.example.com")));
+            TestTrue(TEXT("Bare domain"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT("*.example.com"), TEXT("example.com")));
+            TestFalse(TEXT("Other domain"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT("*.example.com"), TEXT("badexample.com")));
+            TestFalse(TEXT("Other host"), UCPP_ABCT_PrefetchMap::MatchHost(TEXT("store.example.com"), TEXT("cdn.example.com"))); });
+
+        It("should match paths per segment and capture them", [this]()
+           {
+            TMap<FString, FString> Captures;
+            TestTrue(TEXT("Capture"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/item/{id}"), TEXT("/item/Sword_01"), Captures));
+            TestEqual(TEXT("Captured id"), Captures.FindRef(TEXT("id")), FString(TEXT("Sword_01")));
+            TestTrue(TEXT("Trailing slash"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/item/{id}"), TEXT("/item/Sword_01/"), Captures));
+            TestFalse(TEXT("Too long"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/item/{id}"), TEXT("/item/Sword_01/reviews"), Captures));
+            TestFalse(TEXT("Too short"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/item/{id}"), TEXT("/item"), Captures));
+            TestFalse(TEXT("Literal is case-sensitive"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/item/{id}"), TEXT("/Item/Sword_01"), Captures));
+            TestTrue(TEXT("Any one segment"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/*/{id}/buy"), TEXT("/en/Sword_01/buy"), Captures));
+            TestTrue(TEXT("Rest of the path"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/sale/*"), TEXT("/sale/summer/day-1"), Captures));
+            TestTrue(TEXT("Rest may be empty"), UCPP_ABCT_PrefetchMap::MatchPath(TEXT("/sale/*"), TEXT("/sale"), Captures)); });
+
+        It("should expand templates and refuse unsafe or missing captures", [this]()
+           {
+            TMap<FString, FString> Captures = {{TEXT("id"), TEXT("Sword_01")}, {TEXT("up"), TEXT("..")}};
+            auto Lookup = [&Captures](FStringView Name, FString &OutValue)
+            {
+                const FString *Value = Captures.Find(FString(Name));
+                OutValue = Value ? *Value : FString();
+                return Value != nullptr;
+            };
+
+            FString Expanded;
+            TestTrue(TEXT("Expanded"), UCPP_ABCT_PrefetchMap::Expand(TEXT("/Game/Items/{id}/SK_{id}.SK_{id}"), Lookup, Expanded));
+            TestEqual(TEXT("Every capture"), Expanded, FString(TEXT("/Game/Items/Sword_01/SK_Sword_01.SK_Sword_01")));
+            TestFalse(TEXT("Missing capture"), UCPP_ABCT_PrefetchMap::Expand(TEXT("StoreItem:{sku}"), Lookup, Expanded));
+            TestFalse(TEXT("Unsafe capture"), UCPP_ABCT_PrefetchMap::Expand(TEXT("/Game/Items/{up}/Secret"), Lookup, Expanded));
+            TestTrue(TEXT("Unmatched brace is literal"), UCPP_ABCT_PrefetchMap::Expand(TEXT("StoreItem:{id"), Lookup, Expanded));
+            TestEqual(TEXT("Literal"), Expanded, FString(TEXT("StoreItem:{id"))); }); });
+
+    Describe("Resolving", [this]()
+             {
+        It("should resolve a page from its path and query", [this]()
+           {
+            FABCTPrefetchRule &Rule = AddRule(TEXT("*.example.com"), TEXT("/item/{id}"), TEXT("/Game/Items/{id}/SK_{id}.SK_{id}"));
+            Rule.PrimaryAssets.Add(TEXT("StoreItem:{id}"));
+            Rule.Priority = 5;
+            AddRule(TEXT(""), TEXT("/bundle"), TEXT("/Game/Bundles/{sku}.{sku}"));
+
+            const FABCTPrefetchRequest Item = ResolvePage(TEXT("https://store.example.com/item/Sword_01"));
+            TestEqual(TEXT("Object path"), Item.ObjectPaths.Num(), 1);
+            TestTrue(TEXT("Primary asset"), Item.PrimaryAssets.Num() == 1 && Item.PrimaryAssets[0] == FPrimaryAssetId(TEXT("StoreItem:Sword_01")));
+            TestEqual(TEXT("Rule priority"), Item.Priority, 5);
+
+            const FABCTPrefetchRequest Bundle = ResolvePage(TEXT("https://other.host/bundle?sku=Starter"));
+            TestTrue(TEXT("From the query"), Bundle.ObjectPaths.Num() == 1 && Bundle.ObjectPaths[0] == FSoftObjectPath(TEXT("/Game/Bundles/Starter.Starter")));
+
+            TestTrue(TEXT("Nothing for other pages"), ResolvePage(TEXT("https://store.example.com/cart")).IsEmpty());
+            TestTrue(TEXT("Same assets, same key"), ResolvePage(TEXT("https://store.example.com/item/Sword_01?ref=home")).Key == Item.Key); });
+
+        It("should resolve a deep link from its params at high priority", [this]()
+           {
+            FABCTPrefetchRule &Rule = AddRule(TEXT(""), TEXT(""), TEXT("/Game/Items/{id}/SK_{id}.SK_{id}"));
+            Rule.DeepLinkAction = TEXT("purchased");
+
+            FABCTPrefetchRequest Request;
+            TestTrue(TEXT("Resolved"), Map->ResolveDeepLink(TEXT("Purchased"), TEXT("{\"id\":\"Sword_01\"}"), Request));
+            TestTrue(TEXT("Object path"), Request.ObjectPaths.Num() == 1 && Request.ObjectPaths[0] == FSoftObjectPath(TEXT("/Game/Items/Sword_01/SK_Sword_01.SK_Sword_01")));
+            TestTrue(TEXT("High priority"), Request.Priority >= FStreamableManager::AsyncLoadHighPriority);
+            TestFalse(TEXT("Other action"), Map->ResolveDeepLink(TEXT("teleport"), TEXT("{\"id\":\"Sword_01\"}"), Request));
+            TestFalse(TEXT("Missing param"), Map->ResolveDeepLink(TEXT("purchased"), TEXT("{}"), Request));
+            TestTrue(TEXT("Not a page rule"), ResolvePage(TEXT("https://store.example.com/")).IsEmpty()); }); });
+
+    Describe("FABCTPrefetcher", [this]()
+             {
+        It("should cancel an unfinished page load when the page changes", [this]()
+           {
+            FABCTPrefetcher Prefetcher;
+            Prefetcher.SetPage(MakeRequest(MissingPath), 8);
+            TestTrue(TEXT("Loading"), Prefetcher.IsLoading(MissingPath));
+            TestEqual(TEXT("Started"), ABCTStats::GetCounter(EABCTCounter::PrefetchLoadsStarted), (uint64)1);
+
+            Prefetcher.SetPage(MakeRequest(MissingPath), 8);
+            TestEqual(TEXT("Same page not restarted"), ABCTStats::GetCounter(EABCTCounter::PrefetchLoadsStarted), (uint64)1);
+
+            Prefetcher.SetPage(FABCTPrefetchRequest(), 8);
+            TestEqual(TEXT("Cancelled"), ABCTStats::GetCounter(EABCTCounter::PrefetchLoadsCancelled), (uint64)1);
+            TestFalse(TEXT("Not retained"), Prefetcher.IsRetained(MissingPath));
+            TestTrue(TEXT("No page load"), Prefetcher.GetPageKey().IsEmpty()); });
+
+        It("should keep deep link loads across navigation", [this]()
+           {
+            FABCTPrefetcher Prefetcher;
+            Prefetcher.AddDeepLink(MakeRequest(MissingPath), 8);
+            Prefetcher.SetPage(MakeRequest(CubePath), 8);
+            Prefetcher.SetPage(FABCTPrefetchRequest(), 8);
+            TestTrue(TEXT("Retained"), Prefetcher.IsRetained(MissingPath));
+            TestTrue(TEXT("Still loading"), Prefetcher.IsLoading(MissingPath));
+
+            Prefetcher.Reset();
+            TestFalse(TEXT("Released"), Prefetcher.IsRetained(MissingPath)); });
+
+        It("should push the oldest retained load out", [this]()
+           {
+            FABCTPrefetcher Prefetcher;
+            Prefetcher.AddDeepLink(MakeRequest(MissingPath), 1);
+            Prefetcher.AddDeepLink(MakeRequest(CubePath), 1);
+            TestFalse(TEXT("Oldest dropped"), Prefetcher.IsRetained(MissingPath));
+            TestTrue(TEXT("Newest kept"), Prefetcher.IsRetained(CubePath)); }); });
+
+    Describe("UCPP_ABCT_Base", [this]()
+             {
+        It("should prefetch for pages and deep links", [this]()
+           {
+            AddRule(TEXT("store.example.com"), TEXT("/item/{id}"), TEXT("/Engine/BasicShapes/{id}.{id}"));
+            FABCTPrefetchRule &Purchased = AddRule(TEXT(""), TEXT(""), TEXT("/Engine/BasicShapes/{id}.{id}"));
+            Purchased.DeepLinkAction = TEXT("purchased");
+
+            UCPP_ABCT_Base *Instance = NewObject<UCPP_ABCT_Base>(GetTransientPackage());
+            Instance->AddToRoot();
+            Instance->SetDebugLoggingEnabled(false);
+            Instance->SetPrefetchMap(Map);
+
+            Instance->HandleNavigationEvent(TEXT("NavigationStarted"), TEXT("https://store.example.com/item/Cube"));
+            Instance->HandleNavigationEvent(TEXT("NavigationFinished"), TEXT("https://store.example.com/item/Cube"));
+            TestEqual(TEXT("Page load"), ABCTStats::GetCounter(EABCTCounter::PrefetchLoadsStarted), (uint64)1);
+
+            Instance->HandleDeepLink(TEXT("purchased"), TEXT("{\"id\":\"Sphere\"}"));
+            TestEqual(TEXT("Deep link load"), ABCTStats::GetCounter(EABCTCounter::PrefetchLoadsStarted), (uint64)2);
+
+            Instance->HandleNavigationEvent(TEXT("TabClosed"), TEXT(""));
+            Instance->RemoveFromRoot(); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
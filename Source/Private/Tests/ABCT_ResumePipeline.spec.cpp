@@ -0,0 +1,201 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the resume pipeline.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_ResumePipeline.h"
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_ResumePipelineSpec, "Punal.AndroidBrowserCustomTab.ResumePipeline", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+FABCTResumeConfig SavedConfig;
+TArray<FDelegateHandle> StepHandles;
+TArray<FString> RunOrder;
+
+/** A step that logs its name and takes longer than the per-frame budget */
+void AddSlowStep(const FString &Name, int32 Priority)
+{
+    StepHandles.Add(ABCTResumePipeline::AddStep(*Name, Priority, FABCTResumeStep::CreateLambda([this, Name]()
+                                                                                               {
+        RunOrder.Add(Name);
+        FPlatformProcess::Sleep(0.003f);
+        return true; })));
+}
+END_DEFINE_SPEC(FABCT_ResumePipelineSpec)
+
+void FABCT_ResumePipelineSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        ABCTResumePipeline::Cancel();
+        ABCTReturnToGame::Reset();
+        RunOrder.Reset();
+
+        SavedConfig = ABCTResumePipeline::GetConfig();
+        FABCTResumeConfig Config;
+        Config.ProfileFrames = 3;
+        Config.AudioRampFrames = 0;
+        ABCTResumePipeline::SetConfig(Config); });
+
+    AfterEach([this]()
+              {
+        for (const FDelegateHandle &Handle : StepHandles)
+        {
+            ABCTResumePipeline::RemoveStep(Handle);
+        }
+        StepHandles.Reset();
+        ABCTResumePipeline::Cancel();
+        ABCTResumePipeline::SetConfig(SavedConfig); });
+
+    Describe("Steps", [this]()
+             {
+        It("should run steps highest priority first, one budget per frame", [this]()
+           {
+            AddSlowStep(TEXT("Audio"), 1);
+            AddSlowStep(TEXT("RenderTargets"), 10);
+            AddSlowStep(TEXT("Atlases"), 5);
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabClosed);
+
+            ABCTResumePipeline::Tick();
+            TestTrue(TEXT("Frame 1"), RunOrder == TArray<FString>({TEXT("RenderTargets")}));
+            ABCTResumePipeline::Tick();
+            TestTrue(TEXT("Frame 2"), RunOrder == TArray<FString>({TEXT("RenderTargets"), TEXT("Atlases")}));
+            ABCTResumePipeline::Tick();
+            TestTrue(TEXT("Frame 3"), RunOrder == TArray<FString>({TEXT("RenderTargets"), TEXT("Atlases"), TEXT("Audio")}));
+
+            const FABCTResumeProfile &Profile = ABCTResumePipeline::GetLastProfile();
+            TestEqual(TEXT("Steps run"), Profile.StepsRun, 3);
+            TestEqual(TEXT("Restored on frame 3"), Profile.RestoreFrames, 3);
+            TestEqual(TEXT("Counted"), ABCTStats::GetCounter(EABCTCounter::ResumeStepsRun), (uint64)3); });
+
+        It("should call a step again until it reports done", [this]()
+           {
+            int32 Calls = 0;
+            StepHandles.Add(ABCTResumePipeline::AddStep(TEXT("Streaming"), 0, FABCTResumeStep::CreateLambda([&Calls]()
+                                                                                                           { return ++Calls == 3; })));
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabHidden);
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+            TestEqual(TEXT("Called each frame"), Calls, 2);
+            ABCTResumePipeline::Tick();
+            TestEqual(TEXT("Done on the third call"), Calls, 3);
+            TestEqual(TEXT("Restored on frame 3"), ABCTResumePipeline::GetLastProfile().RestoreFrames, 3); });
+
+        It("should still run the next step when a step removes itself", [this]()
+           {
+            FDelegateHandle OneShot;
+            OneShot = ABCTResumePipeline::AddStep(TEXT("OneShot"), 10, FABCTResumeStep::CreateLambda([this, &OneShot]()
+                                                                                                     {
+                RunOrder.Add(TEXT("OneShot"));
+                ABCTResumePipeline::RemoveStep(OneShot);
+                return true; }));
+            StepHandles.Add(ABCTResumePipeline::AddStep(TEXT("Next"), 0, FABCTResumeStep::CreateLambda([this]()
+                                                                                                       {
+                RunOrder.Add(TEXT("Next"));
+                return true; })));
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabClosed);
+
+            ABCTResumePipeline::Tick();
+            TestTrue(TEXT("Both ran"), RunOrder == TArray<FString>({TEXT("OneShot"), TEXT("Next")}));
+            TestEqual(TEXT("Steps run"), ABCTStats::GetCounter(EABCTCounter::ResumeStepsRun), (uint64)2); });
+
+        It("should drop steps still unfinished after MaxResumeFrames", [this]()
+           {
+            FABCTResumeConfig Config = ABCTResumePipeline::GetConfig();
+            Config.MaxResumeFrames = 2;
+            ABCTResumePipeline::SetConfig(Config);
+            StepHandles.Add(ABCTResumePipeline::AddStep(TEXT("Stuck"), 0, FABCTResumeStep::CreateLambda([]()
+                                                                                                       { return false; })));
+            AddExpectedError(TEXT("unfinished after 2 frames"), EAutomationExpectedErrorFlags::Contains, 1);
+
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabHidden);
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+            TestFalse(TEXT("Finished"), ABCTResumePipeline::IsRunning());
+            TestEqual(TEXT("Not restored"), ABCTResumePipeline::GetLastProfile().RestoreFrames, -1); }); });
+
+    Describe("Profile", [this]()
+             {
+        It("should report the first ProfileFrames frames once", [this]()
+           {
+            int32 Reports = 0;
+            FABCTResumeProfile Reported;
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabClosed, FABCTResumeProfileReady::CreateLambda([&](const FABCTResumeProfile &Profile)
+                                                                                                           {
+                ++Reports;
+                Reported = Profile; }));
+            TestFalse(TEXT("A second resume is ignored"), ABCTResumePipeline::Begin(EABCTResumeReason::TabHidden));
+
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+            TestEqual(TEXT("Not yet"), Reports, 0);
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+
+            TestEqual(TEXT("Reported once"), Reports, 1);
+            TestEqual(TEXT("Three frames"), Reported.FrameMillis.Num(), 3);
+            TestTrue(TEXT("Reason kept"), Reported.Reason == EABCTResumeReason::TabClosed);
+            TestEqual(TEXT("Worst frame"), Reported.WorstFrameMillis, FMath::Max(Reported.FrameMillis));
+            TestEqual(TEXT("Frame histogram"), ABCTStats::GetHistogram(EABCTHistogram::ResumeFrameMicros).Count.load(), (uint64)3);
+            TestEqual(TEXT("Worst frame histogram"), ABCTStats::GetHistogram(EABCTHistogram::ResumeWorstFrameMicros).Count.load(), (uint64)1);
+            TestFalse(TEXT("Finished"), ABCTResumePipeline::IsRunning()); });
+
+        It("should not count frames while the tab still covers the game", [this]()
+           {
+            ABCTReturnToGame::BeginClose(true);
+            ABCTResumePipeline::Begin(EABCTResumeReason::TabClosed);
+            ABCTResumePipeline::Tick();
+            ABCTResumePipeline::Tick();
+            TestEqual(TEXT("Nothing profiled"), ABCTStats::GetHistogram(EABCTHistogram::ResumeFrameMicros).Count.load(), (uint64)0);
+
+            ABCTReturnToGame::NotifyGameVisible(false);
+            ABCTReturnToGame::Update();
+            ABCTResumePipeline::Tick();
+            TestEqual(TEXT("First frame back"), ABCTStats::GetHistogram(EABCTHistogram::ResumeFrameMicros).Count.load(), (uint64)1); }); });
+
+    Describe("UCPP_ABCT_Base", [this]()
+             {
+        It("should start a resume when the tab closes", [this]()
+           {
+            TSharedPtr<FABCTSimulatedBackend> Backend;
+            UCPP_ABCT_Base *Instance = nullptr;
+            ABCTSpecFixture::Setup(Backend, Instance);
+
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            TestFalse(TEXT("Not while the tab is up"), ABCTResumePipeline::IsRunning());
+
+            Instance->CloseChromeCustomTab();
+            TestTrue(TEXT("Started on close"), ABCTResumePipeline::IsRunning());
+            for (int32 Frame = 0; Frame < 3; ++Frame)
+            {
+                PumpGameThread();
+            }
+            TestEqual(TEXT("Profile on the instance"), Instance->GetLastResumeProfile().FrameMillis.Num(), 3);
+            TestTrue(TEXT("Closed"), Instance->GetLastResumeProfile().Reason == EABCTResumeReason::TabClosed);
+
+            ABCTSpecFixture::Teardown(Backend, Instance); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
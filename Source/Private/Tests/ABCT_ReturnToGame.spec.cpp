@@ -0,0 +1,110 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for return-to-game latency.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_ReturnToGame.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+
+    uint64 ReturnCount()
+    {
+        return ABCTStats::GetHistogram(EABCTHistogram::TabReturnToGameMicros).Count.load();
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_ReturnToGameSpec, "Punal.AndroidBrowserCustomTab.ReturnToGame", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+END_DEFINE_SPEC(FABCT_ReturnToGameSpec)
+
+void FABCT_ReturnToGameSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        ABCTReturnToGame::Reset();
+        ABCTSpecFixture::Setup(Backend, Instance); });
+
+    AfterEach([this]()
+              {
+        ABCTSpecFixture::Teardown(Backend, Instance);
+        ABCTReturnToGame::Reset(); });
+
+    Describe("CloseChromeCustomTab", [this]()
+             {
+        It("should record the return on the next frame when the game stayed on screen", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            TestEqual(TEXT("Nothing before a close"), Instance->GetLastReturnToGameMillis(), -1.0f);
+
+            Instance->CloseChromeCustomTab();
+            TestTrue(TEXT("Pending until the next frame"), ABCTReturnToGame::IsPending());
+            PumpGameThread();
+
+            TestFalse(TEXT("Recorded"), ABCTReturnToGame::IsPending());
+            TestEqual(TEXT("One sample"), ReturnCount(), (uint64)1);
+            TestTrue(TEXT("Exposed on the instance"), Instance->GetLastReturnToGameMillis() >= 0.0f);
+            TestEqual(TEXT("No relaunch"), ABCTStats::GetCounter(EABCTCounter::TabCloseRelaunches), (uint64)0); }); });
+
+    Describe("Activity", [this]()
+             {
+        It("should wait for the game activity to resume", [this]()
+           {
+            ABCTReturnToGame::BeginClose(true);
+            PumpGameThread();
+            TestTrue(TEXT("Still pending while the tab covers the game"), ABCTReturnToGame::IsPending());
+            TestEqual(TEXT("Nothing recorded"), ReturnCount(), (uint64)0);
+
+            FPlatformProcess::Sleep(0.005f);
+            ABCTReturnToGame::NotifyGameVisible(false);
+            PumpGameThread();
+            TestEqual(TEXT("Recorded on the first frame back"), ReturnCount(), (uint64)1);
+            TestTrue(TEXT("Includes the wait"), ABCTReturnToGame::GetLastMillis() >= 5.0); });
+
+        It("should count closes that relaunched the game activity", [this]()
+           {
+            ABCTReturnToGame::BeginClose(true);
+            ABCTReturnToGame::NotifyGameVisible(true);
+            PumpGameThread();
+            TestEqual(TEXT("Relaunch counted"), ABCTStats::GetCounter(EABCTCounter::TabCloseRelaunches), (uint64)1);
+            TestEqual(TEXT("Still recorded"), ReturnCount(), (uint64)1); });
+
+        It("should not record a close that found nothing covering the game", [this]()
+           {
+            ABCTReturnToGame::BeginClose(true);
+            ABCTReturnToGame::CancelClose();
+            TestFalse(TEXT("No longer pending"), ABCTReturnToGame::IsPending());
+
+            ABCTReturnToGame::NotifyGameVisible(false);
+            PumpGameThread();
+            TestEqual(TEXT("Nothing recorded"), ReturnCount(), (uint64)0);
+            TestEqual(TEXT("No last latency"), ABCTReturnToGame::GetLastMillis(), -1.0); });
+
+        It("should ignore a resume without a pending close", [this]()
+           {
+            ABCTReturnToGame::NotifyGameVisible(false);
+            PumpGameThread();
+            TestEqual(TEXT("Nothing recorded"), ReturnCount(), (uint64)0);
+            TestEqual(TEXT("No last latency"), ABCTReturnToGame::GetLastMillis(), -1.0); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
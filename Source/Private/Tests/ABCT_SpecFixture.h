@@ -0,0 +1,64 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Shared setup for specs that drive a UCPP_ABCT_Base.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_Backend.h"
+#include "ABCT_SimulatedBackend.h"
+#include "CPP_ABCT_Base.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * ABCTSpecFixture
+ *
+ * The backend and instance most specs run against: a fresh FABCTSimulatedBackend installed
+ * as the backend override and a rooted UCPP_ABCT_Base with debug logging off. Call Setup from
+ * BeforeEach and Teardown from AfterEach, after dropping listeners that capture test locals.
+ */
+namespace ABCTSpecFixture
+{
+    /**
+     * Installs a simulated backend and creates the instance.
+     *
+     * @param OutBackend - Receives the backend, for scripting the page side
+     * @param OutInstance - Receives the rooted instance
+     */
+    inline void Setup(TSharedPtr<FABCTSimulatedBackend> &OutBackend, UCPP_ABCT_Base *&OutInstance)
+    {
+        OutBackend = MakeShared<FABCTSimulatedBackend>();
+        ABCTBackend::SetOverride(OutBackend);
+
+        OutInstance = NewObject<UCPP_ABCT_Base>(GetTransientPackage());
+        OutInstance->AddToRoot();
+        OutInstance->SetDebugLoggingEnabled(false);
+    }
+
+    /**
+     * Closes a tab the test left open, runs one game frame so the close completes, then
+     * releases the instance and removes the backend override.
+     */
+    inline void Teardown(TSharedPtr<FABCTSimulatedBackend> &Backend, UCPP_ABCT_Base *&Instance)
+    {
+        if (Instance->IsChromeCustomTabOpen())
+        {
+            Instance->CloseChromeCustomTab();
+        }
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+
+        Instance->RemoveFromRoot();
+        Instance = nullptr;
+        ABCTBackend::SetOverride(nullptr);
+        Backend.Reset();
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,292 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for reflection-driven struct serialization.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_AllocationCounter.h"
+#include "ABCT_JsonWriter.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_StructSerializer.h"
+#include "ABCT_TestStructs.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Base64.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Reads the binary struct format back, mirroring what a page decoder does */
+    struct FABCTBinaryCursor
+    {
+        TArrayView<const uint8> Bytes;
+        int32 Position = 0;
+
+        template <typename ValueType>
+        ValueType Read()
+        {
+            ValueType Value{};
+            if (Position + (int32)sizeof(ValueType) <= Bytes.Num())
+            {
+                FMemory::Memcpy(&Value, Bytes.GetData() + Position, sizeof(ValueType));
+            }
+            Position += sizeof(ValueType);
+            return Value;
+        }
+
+        FString ReadString()
+        {
+            const int32 Length = (int32)Read<uint32>();
+            FString Result;
+            if (Position + Length <= Bytes.Num())
+            {
+                Result = FString(FUTF8ToTCHAR((const ANSICHAR *)Bytes.GetData() + Position, Length));
+            }
+            Position += Length;
+            return Result;
+        }
+    };
+}
+
+BEGIN_DEFINE_SPEC(FABCT_StructSerializerSpec, "Punal.AndroidBrowserCustomTab.StructSerializer", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+FABCTTestInventory Inventory;
+
+FABCTTestInventory MakeInventory()
+{
+    FABCTTestInventory Result;
+    Result.Gold = 1250;
+    Result.bPremium = true;
+    Result.Weight = 12.5f;
+    Result.Slot = TEXT("Backpack");
+    Result.Title = FText::FromString(TEXT("Explorer's \"Pack\""));
+    Result.Position = FVector(1000.0, -25.5, 500.0);
+    FABCTTestItem &Sword = Result.Items.AddDefaulted_GetRef();
+    Sword.Name = TEXT("Sword");
+    Sword.Count = 1;
+    Sword.Rarity = EABCTTestRarity::Legendary;
+    FABCTTestItem &Potion = Result.Items.AddDefaulted_GetRef();
+    Potion.Name = TEXT("Potion");
+    Potion.Count = 12;
+    Result.Ids = {7, -1, 9007199254740993ll};
+    Result.Transient = 99;
+    return Result;
+}
+
+TSharedPtr<FJsonObject> Parse(const FString &Json)
+{
+    TSharedPtr<FJsonObject> Object;
+    FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Object);
+    return Object;
+}
+
+FString WriteMessage(EABCTStructFormat Format)
+{
+    FString Out;
+    FABCTJsonWriter Writer(Out);
+    ABCTStructSerializer::WriteMessage(FABCTTestInventory::StaticStruct(), &Inventory, Format, Writer);
+    return Out;
+}
+END_DEFINE_SPEC(FABCT_StructSerializerSpec)
+
+void FABCT_StructSerializerSpec::Define()
+{
+    BeforeEach([this]()
+               { Inventory = MakeInventory(); });
+
+    It("should write every reflected field as JSON", [this]()
+       {
+        TSharedPtr<FJsonObject> Message = Parse(WriteMessage(EABCTStructFormat::Json));
+        if (!TestTrue(TEXT("Parses"), Message.IsValid()))
+        {
+            return;
+        }
+        TestEqual(TEXT("Type"), Message->GetStringField(TEXT("type")), FString(TEXT("ABCTTestInventory")));
+
+        const TSharedPtr<FJsonObject> Data = Message->GetObjectField(TEXT("data"));
+        TestEqual(TEXT("Gold"), Data->GetIntegerField(TEXT("Gold")), 1250);
+        TestTrue(TEXT("bPremium"), Data->GetBoolField(TEXT("bPremium")));
+        TestEqual(TEXT("Weight"), Data->GetNumberField(TEXT("Weight")), 12.5);
+        TestEqual(TEXT("Slot"), Data->GetStringField(TEXT("Slot")), FString(TEXT("Backpack")));
+        TestEqual(TEXT("Title"), Data->GetStringField(TEXT("Title")), FString(TEXT("Explorer's \"Pack\"")));
+        TestEqual(TEXT("Position.Y"), Data->GetObjectField(TEXT("Position"))->GetNumberField(TEXT("Y")), -25.5);
+        TestFalse(TEXT("Unreflected field skipped"), Data->HasField(TEXT("Transient")));
+
+        const TArray<TSharedPtr<FJsonValue>> &Items = Data->GetArrayField(TEXT("Items"));
+        if (TestEqual(TEXT("Items"), Items.Num(), 2))
+        {
+            TestEqual(TEXT("Item name"), Items[0]->AsObject()->GetStringField(TEXT("Name")), FString(TEXT("Sword")));
+            TestEqual(TEXT("Enum written by name"), Items[0]->AsObject()->GetStringField(TEXT("Rarity")), FString(TEXT("Legendary")));
+            TestEqual(TEXT("Item count"), Items[1]->AsObject()->GetIntegerField(TEXT("Count")), 12);
+        }
+        TestEqual(TEXT("Ids"), Data->GetArrayField(TEXT("Ids")).Num(), 3); });
+
+    It("should write the binary layout described by the schema", [this]()
+       {
+        TArray<uint8> Bytes;
+        ABCTStructSerializer::WriteBinary(FABCTTestInventory::StaticStruct(), &Inventory, Bytes);
+
+        FABCTBinaryCursor Cursor{Bytes};
+        TestEqual(TEXT("Gold"), Cursor.Read<int32>(), 1250);
+        TestEqual(TEXT("bPremium"), Cursor.Read<uint8>(), (uint8)1);
+        TestEqual(TEXT("Weight"), Cursor.Read<float>(), 12.5f);
+        TestEqual(TEXT("Slot"), Cursor.ReadString(), FString(TEXT("Backpack")));
+        TestEqual(TEXT("Title"), Cursor.ReadString(), FString(TEXT("Explorer's \"Pack\"")));
+        TestEqual(TEXT("Position.X"), Cursor.Read<double>(), 1000.0);
+        TestEqual(TEXT("Position.Y"), Cursor.Read<double>(), -25.5);
+        TestEqual(TEXT("Position.Z"), Cursor.Read<double>(), 500.0);
+        TestEqual(TEXT("Item count"), Cursor.Read<uint32>(), 2u);
+        TestEqual(TEXT("Item 0 name"), Cursor.ReadString(), FString(TEXT("Sword")));
+        TestEqual(TEXT("Item 0 count"), Cursor.Read<int32>(), 1);
+        TestEqual(TEXT("Item 0 rarity"), Cursor.Read<uint8>(), (uint8)EABCTTestRarity::Legendary);
+        TestEqual(TEXT("Item 1 name"), Cursor.ReadString(), FString(TEXT("Potion")));
+        Cursor.Read<int32>();
+        Cursor.Read<uint8>();
+        TestEqual(TEXT("Id count"), Cursor.Read<uint32>(), 3u);
+        TestEqual(TEXT("Id 0"), Cursor.Read<int64>(), (int64)7);
+        TestEqual(TEXT("Id 1"), Cursor.Read<int64>(), (int64)-1);
+        TestEqual(TEXT("Id 2 keeps all 64 bits"), Cursor.Read<int64>(), (int64)9007199254740993ll);
+        TestEqual(TEXT("Consumed every byte"), Cursor.Position, Bytes.Num());
+
+        TSharedPtr<FJsonObject> Message = Parse(WriteMessage(EABCTStructFormat::Binary));
+        if (TestTrue(TEXT("Envelope parses"), Message.IsValid()))
+        {
+            TArray<uint8> Decoded;
+            TestTrue(TEXT("Base64 decodes"), FBase64::Decode(Message->GetStringField(TEXT("bin")), Decoded));
+            TestTrue(TEXT("Envelope carries the same bytes"), Decoded == Bytes);
+            TestEqual(TEXT("Schema hash"), (uint32)Message->GetNumberField(TEXT("schema")), ABCTStructSerializer::GetSchemaHash(FABCTTestInventory::StaticStruct()));
+        } });
+
+    It("should describe nested structs, arrays and enums in the schema", [this]()
+       {
+        FString Out;
+        FABCTJsonWriter Writer(Out);
+        ABCTStructSerializer::WriteSchemaMessage(FABCTTestInventory::StaticStruct(), Writer);
+        TSharedPtr<FJsonObject> Message = Parse(Out);
+        if (!TestTrue(TEXT("Parses"), Message.IsValid()))
+        {
+            return;
+        }
+        TestEqual(TEXT("Type"), Message->GetStringField(TEXT("type")), FString(TEXT("abct_schema")));
+
+        const TArray<TSharedPtr<FJsonValue>> &Fields = Message->GetObjectField(TEXT("def"))->GetArrayField(TEXT("fields"));
+        if (!TestEqual(TEXT("Fields"), Fields.Num(), 8))
+        {
+            return;
+        }
+        TestEqual(TEXT("Field order"), Fields[0]->AsObject()->GetStringField(TEXT("name")), FString(TEXT("Gold")));
+        TestEqual(TEXT("Weight type"), Fields[2]->AsObject()->GetStringField(TEXT("type")), FString(TEXT("f32")));
+        TestEqual(TEXT("Position is a struct"), Fields[5]->AsObject()->GetStringField(TEXT("type")), FString(TEXT("struct")));
+
+        const TSharedPtr<FJsonObject> ItemSchema = Fields[6]->AsObject()->GetObjectField(TEXT("of"));
+        TestEqual(TEXT("Items hold structs"), ItemSchema->GetStringField(TEXT("type")), FString(TEXT("struct")));
+        const TSharedPtr<FJsonObject> Rarity = ItemSchema->GetArrayField(TEXT("fields"))[2]->AsObject();
+        TestEqual(TEXT("Enum underlying type"), Rarity->GetStringField(TEXT("type")), FString(TEXT("u8")));
+        TestEqual(TEXT("Enum names by value"), Rarity->GetObjectField(TEXT("enum"))->GetStringField(TEXT("5")), FString(TEXT("Legendary"))); });
+
+    It("should serialize recursive structs", [this]()
+       {
+        FABCTTestNode Tree;
+        Tree.Name = TEXT("Root");
+        FABCTTestNode &Branch = Tree.Children.AddDefaulted_GetRef();
+        Branch.Name = TEXT("Branch");
+        Branch.Children.AddDefaulted_GetRef().Name = TEXT("Leaf");
+        Tree.Children.AddDefaulted_GetRef().Name = TEXT("Sibling");
+
+        FString Json;
+        FABCTJsonWriter JsonWriter(Json);
+        ABCTStructSerializer::WriteJson(FABCTTestNode::StaticStruct(), &Tree, JsonWriter);
+        TSharedPtr<FJsonObject> Data = Parse(Json);
+        if (!TestTrue(TEXT("Parses"), Data.IsValid()))
+        {
+            return;
+        }
+        const TArray<TSharedPtr<FJsonValue>> &Children = Data->GetArrayField(TEXT("Children"));
+        if (TestEqual(TEXT("Children"), Children.Num(), 2))
+        {
+            const TSharedPtr<FJsonObject> BranchObject = Children[0]->AsObject();
+            TestEqual(TEXT("Branch"), BranchObject->GetStringField(TEXT("Name")), FString(TEXT("Branch")));
+            TestEqual(TEXT("Leaf"), BranchObject->GetArrayField(TEXT("Children"))[0]->AsObject()->GetStringField(TEXT("Name")), FString(TEXT("Leaf")));
+            TestEqual(TEXT("Sibling"), Children[1]->AsObject()->GetStringField(TEXT("Name")), FString(TEXT("Sibling")));
+        }
+
+        TArray<uint8> Bytes;
+        ABCTStructSerializer::WriteBinary(FABCTTestNode::StaticStruct(), &Tree, Bytes);
+        FABCTBinaryCursor Cursor{Bytes};
+        TestEqual(TEXT("Root name"), Cursor.ReadString(), FString(TEXT("Root")));
+        TestEqual(TEXT("Root children"), Cursor.Read<uint32>(), 2u);
+        TestEqual(TEXT("Branch name"), Cursor.ReadString(), FString(TEXT("Branch")));
+        TestEqual(TEXT("Branch children"), Cursor.Read<uint32>(), 1u);
+        TestEqual(TEXT("Leaf name"), Cursor.ReadString(), FString(TEXT("Leaf")));
+        TestEqual(TEXT("Leaf children"), Cursor.Read<uint32>(), 0u);
+        TestEqual(TEXT("Sibling name"), Cursor.ReadString(), FString(TEXT("Sibling")));
+        TestEqual(TEXT("Sibling children"), Cursor.Read<uint32>(), 0u);
+        TestEqual(TEXT("Consumed every byte"), Cursor.Position, Bytes.Num());
+
+        FString Out;
+        FABCTJsonWriter SchemaWriter(Out);
+        ABCTStructSerializer::WriteSchemaMessage(FABCTTestNode::StaticStruct(), SchemaWriter);
+        TSharedPtr<FJsonObject> Message = Parse(Out);
+        if (TestTrue(TEXT("Schema parses"), Message.IsValid()))
+        {
+            const TSharedPtr<FJsonObject> Def = Message->GetObjectField(TEXT("def"));
+            const TSharedPtr<FJsonObject> Of = Def->GetArrayField(TEXT("fields"))[1]->AsObject()->GetObjectField(TEXT("of"));
+            TestEqual(TEXT("Children refer back to the node"), Of->GetStringField(TEXT("ref")), Def->GetStringField(TEXT("type")));
+        } });
+
+    It("should serialize from the cached plan without allocating", [this]()
+       {
+        FString Out;
+        Out.Reserve(4096);
+        for (const EABCTStructFormat Format : {EABCTStructFormat::Json, EABCTStructFormat::Binary})
+        {
+            // The first call builds the plan and sizes the per-thread scratch buffers
+            Out.Reset();
+            FABCTJsonWriter WarmUp(Out);
+            ABCTStructSerializer::WriteMessage(FABCTTestInventory::StaticStruct(), &Inventory, Format, WarmUp);
+
+            int64 Allocations = 0;
+            {
+                FABCTScopedAllocationCounter AllocationCounter;
+                Out.Reset();
+                FABCTJsonWriter Writer(Out);
+                ABCTStructSerializer::WriteMessage(FABCTTestInventory::StaticStruct(), &Inventory, Format, Writer);
+                Allocations = AllocationCounter.GetAllocations();
+            }
+            TestEqual(Format == EABCTStructFormat::Json ? TEXT("JSON allocations") : TEXT("Binary allocations"), Allocations, (int64)0);
+        } });
+
+    It("should send the schema once per page before the first binary message", [this]()
+       {
+        TSharedPtr<FABCTSimulatedBackend> Backend;
+        UCPP_ABCT_Base *Instance = nullptr;
+        ABCTSpecFixture::Setup(Backend, Instance);
+        Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+        Backend->ClearSentMessages();
+
+        TestTrue(TEXT("JSON queued"), Instance->SendStruct(Inventory));
+        TestTrue(TEXT("Binary queued"), Instance->SendStruct(Inventory, EABCTStructFormat::Binary));
+        TestTrue(TEXT("Second binary queued"), Instance->SendStruct(Inventory, EABCTStructFormat::Binary));
+        FP_AndroidBrowserCustomTabModule::Drain();
+
+        TArray<FString> Types;
+        for (const FString &Frame : Backend->GetSentMessages())
+        {
+            TSharedPtr<FJsonObject> Message = Parse(Frame);
+            Types.Add(Message.IsValid() ? Message->GetStringField(TEXT("type")) : FString(TEXT("<invalid>")));
+        }
+        TestEqual(TEXT("Message order"), FString::Join(Types, TEXT(",")), FString(TEXT("ABCTTestInventory,abct_schema,ABCTTestInventory,ABCTTestInventory")));
+
+        ABCTSpecFixture::Teardown(Backend, Instance); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
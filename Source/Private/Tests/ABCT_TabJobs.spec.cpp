@@ -0,0 +1,188 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the background job scheduler.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_TabJobs.h"
+#include "ABCT_Stats.h"
+#include "ABCT_TabState.h"
+#include "Misc/AutomationTest.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    /** Publishes Lifecycle the way UCPP_ABCT_Base does */
+    void SetTab(EABCTTabLifecycle Lifecycle)
+    {
+        FABCTTabStateSnapshot Snapshot = ABCTTabState::Read();
+        Snapshot.Lifecycle = Lifecycle;
+        ABCTTabState::Publish(Snapshot);
+        ABCTTabJobs::OnTabStateChanged(ABCTTabState::Read());
+    }
+
+    /** Waits up to two seconds for the worker to make Condition true */
+    bool WaitFor(TFunctionRef<bool()> Condition)
+    {
+        const double GiveUpSeconds = FPlatformTime::Seconds() + 2.0;
+        while (!Condition())
+        {
+            if (FPlatformTime::Seconds() > GiveUpSeconds)
+            {
+                return false;
+            }
+            FPlatformProcess::Sleep(0.001f);
+        }
+        return true;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FABCT_TabJobsSpec, "Punal.AndroidBrowserCustomTab.TabJobs", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+FABCTTabJobConfig SavedConfig;
+TArray<FDelegateHandle> JobHandles;
+
+/** A job that counts its slices and is done after SlicesToRun of them */
+void AddCountingJob(TSharedRef<std::atomic<int32>> Slices, int32 SlicesToRun, int32 Priority = 0, bool bEverySession = false)
+{
+    JobHandles.Add(ABCTTabJobs::AddJob(TEXT("Counting"), Priority, [Slices, SlicesToRun](const FABCTTabJobContext &)
+                                       { return Slices->fetch_add(1) + 1 >= SlicesToRun ? EABCTTabJobResult::Done : EABCTTabJobResult::Continue; },
+                                       bEverySession));
+}
+END_DEFINE_SPEC(FABCT_TabJobsSpec)
+
+void FABCT_TabJobsSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        SetTab(EABCTTabLifecycle::Closed);
+        SavedConfig = ABCTTabJobs::GetConfig();
+        FABCTTabJobConfig Config;
+        Config.bFastPSOPrecompile = false;
+        ABCTTabJobs::SetConfig(Config); });
+
+    AfterEach([this]()
+              {
+        for (const FDelegateHandle &Handle : JobHandles)
+        {
+            ABCTTabJobs::RemoveJob(Handle);
+        }
+        JobHandles.Reset();
+        SetTab(EABCTTabLifecycle::Closed);
+        ABCTTabJobs::SetConfig(SavedConfig); });
+
+    Describe("Scheduling", [this]()
+             {
+        It("should run a job to completion while the tab covers the game", [this]()
+           {
+            SetTab(EABCTTabLifecycle::Visible);
+            TSharedRef<std::atomic<int32>> Slices = MakeShared<std::atomic<int32>>(0);
+            AddCountingJob(Slices, 3);
+
+            TestTrue(TEXT("Finished"), WaitFor([]()
+                                               { return ABCTTabJobs::NumPending() == 0; }));
+            TestEqual(TEXT("Three slices"), Slices->load(), 3);
+            const FABCTTabJobSessionStats Session = ABCTTabJobs::GetSessionStats();
+            TestEqual(TEXT("Session slices"), Session.SlicesRun, 3);
+            TestEqual(TEXT("Session jobs"), Session.JobsCompleted, 1);
+            TestEqual(TEXT("Completed counter"), ABCTStats::GetCounter(EABCTCounter::TabJobsCompleted), (uint64)1); });
+
+        It("should pause while the tab is hidden or closed", [this]()
+           {
+            TSharedRef<std::atomic<int32>> Slices = MakeShared<std::atomic<int32>>(0);
+            AddCountingJob(Slices, MAX_int32);
+            FPlatformProcess::Sleep(0.05f);
+            TestEqual(TEXT("Nothing without a tab"), Slices->load(), 0);
+
+            SetTab(EABCTTabLifecycle::Visible);
+            TestTrue(TEXT("Runs once visible"), WaitFor([Slices]()
+                                                        { return Slices->load() > 0; }));
+
+            SetTab(EABCTTabLifecycle::Hidden);
+            FPlatformProcess::Sleep(0.05f);
+            const int32 SlicesWhenHidden = Slices->load();
+            FPlatformProcess::Sleep(0.05f);
+            TestEqual(TEXT("Paused while hidden"), Slices->load(), SlicesWhenHidden); });
+
+        It("should run the highest priority job first", [this]()
+           {
+            TArray<int32> Order;
+            FCriticalSection OrderLock;
+            for (const int32 Priority : {1, 10, 5})
+            {
+                JobHandles.Add(ABCTTabJobs::AddJob(TEXT("Ordered"), Priority, [&Order, &OrderLock, Priority](const FABCTTabJobContext &)
+                                                   {
+                    FScopeLock Lock(&OrderLock);
+                    Order.Add(Priority);
+                    return EABCTTabJobResult::Done; }));
+            }
+            SetTab(EABCTTabLifecycle::Visible);
+
+            TestTrue(TEXT("Finished"), WaitFor([]()
+                                               { return ABCTTabJobs::NumPending() == 0; }));
+            FScopeLock Lock(&OrderLock);
+            TestTrue(TEXT("By priority"), Order == TArray<int32>({10, 5, 1})); });
+
+        It("should hold the jobs to the CPU budget", [this]()
+           {
+            FABCTTabJobConfig Config = ABCTTabJobs::GetConfig();
+            Config.SliceMillis = 2.0;
+            Config.CpuBudget = 0.25f;
+            ABCTTabJobs::SetConfig(Config);
+            JobHandles.Add(ABCTTabJobs::AddJob(TEXT("Busy"), 0, [](const FABCTTabJobContext &Context)
+                                               {
+                while (!Context.ShouldYield())
+                {
+                }
+                return EABCTTabJobResult::Continue; }));
+
+            SetTab(EABCTTabLifecycle::Visible);
+            const double StartSeconds = FPlatformTime::Seconds();
+            FPlatformProcess::Sleep(0.3f);
+            const double WallMillis = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+            const double WorkMillis = ABCTTabJobs::GetSessionStats().WorkMillis;
+            SetTab(EABCTTabLifecycle::Hidden);
+
+            AddInfo(FString::Printf(TEXT("Background jobs used %.0f%% of one core"), WorkMillis / WallMillis * 100.0));
+            TestTrue(TEXT("Did some work"), WorkMillis > 0.0);
+            TestTrue(TEXT("Within the budget (with scheduling slack)"), WorkMillis <= WallMillis * 0.4); });
+
+        It("should not spin on a job that yields straight away", [this]()
+           {
+            TSharedRef<std::atomic<int32>> Slices = MakeShared<std::atomic<int32>>(0);
+            JobHandles.Add(ABCTTabJobs::AddJob(TEXT("Polling"), 0, [Slices](const FABCTTabJobContext &)
+                                               {
+                Slices->fetch_add(1);
+                return EABCTTabJobResult::Continue; }));
+
+            SetTab(EABCTTabLifecycle::Visible);
+            FPlatformProcess::Sleep(0.1f);
+            SetTab(EABCTTabLifecycle::Hidden);
+
+            AddInfo(FString::Printf(TEXT("%d slices in 100 ms"), Slices->load()));
+            TestTrue(TEXT("Ran"), Slices->load() > 0);
+            TestTrue(TEXT("At most one slice per minimum sleep (with scheduling slack)"), Slices->load() <= 150); }); });
+
+    Describe("Sessions", [this]()
+             {
+        It("should report each session and rerun every-session jobs", [this]()
+           {
+            TSharedRef<std::atomic<int32>> Slices = MakeShared<std::atomic<int32>>(0);
+            AddCountingJob(Slices, 1, 0, true);
+
+            SetTab(EABCTTabLifecycle::Opening);
+            TestTrue(TEXT("First session"), WaitFor([]()
+                                                    { return ABCTTabJobs::NumPending() == 0; }));
+            SetTab(EABCTTabLifecycle::Closed);
+            TestEqual(TEXT("Session reported"), ABCTTabJobs::GetLastSessionStats().JobsCompleted, 1);
+            TestEqual(TEXT("Session histogram"), ABCTStats::GetHistogram(EABCTHistogram::TabJobSessionWorkMicros).Count.load(), (uint64)1);
+            TestEqual(TEXT("Done until the next session"), ABCTTabJobs::NumPending(), 0);
+
+            SetTab(EABCTTabLifecycle::Visible);
+            TestTrue(TEXT("Second session"), WaitFor([Slices]()
+                                                     { return Slices->load() == 2; })); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
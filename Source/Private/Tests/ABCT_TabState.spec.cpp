@@ -0,0 +1,86 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the tab state snapshot.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_TabState.h"
+#include "Async/Async.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_TabStateSpec, "Punal.AndroidBrowserCustomTab.TabState", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+END_DEFINE_SPEC(FABCT_TabStateSpec)
+
+void FABCT_TabStateSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTSpecFixture::Setup(Backend, Instance); });
+
+    AfterEach([this]()
+              {
+        ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    It("should follow the tab through open, show, hide and close", [this]()
+       {
+        const uint32 StartSequence = ABCTTabState::Read().Sequence;
+
+        Instance->OpenChromeCustomTab(TEXT("https://example.com/state"));
+        FABCTTabStateSnapshot Snapshot = ABCTTabState::Read();
+        TestTrue(TEXT("Opening"), Snapshot.Lifecycle == EABCTTabLifecycle::Opening);
+        TestTrue(TEXT("Covering while opening"), Snapshot.IsCoveringGame());
+        TestEqual(TEXT("URL id"), (int32)Snapshot.UrlId, Instance->GetCurrentURLId());
+        TestTrue(TEXT("Opened timestamp"), Snapshot.OpenedCycles != 0);
+        TestTrue(TEXT("Sequence advanced"), Snapshot.Sequence > StartSequence);
+
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        TestTrue(TEXT("Visible after TabShown"), ABCTTabState::Read().Lifecycle == EABCTTabLifecycle::Visible);
+
+        Instance->HandleNavigationEvent(TEXT("TabHidden"), TEXT(""));
+        Snapshot = ABCTTabState::Read();
+        TestTrue(TEXT("Hidden"), Snapshot.Lifecycle == EABCTTabLifecycle::Hidden);
+        TestFalse(TEXT("Game visible again"), Snapshot.IsCoveringGame());
+
+        Instance->CloseChromeCustomTab();
+        Snapshot = ABCTTabState::Read();
+        TestTrue(TEXT("Closed"), Snapshot.Lifecycle == EABCTTabLifecycle::Closed);
+        TestEqual(TEXT("No URL"), Snapshot.UrlId, (uint32)0); });
+
+    It("should give readers on other threads consistent snapshots", [this]()
+       {
+        // Every published snapshot satisfies UrlId == LifecycleChangedCycles; a torn read would not
+        std::atomic<bool> bStop{false};
+        TFuture<int32> Reader = Async(EAsyncExecution::Thread, [&bStop]()
+                                      {
+            int32 TornReads = 0;
+            while (!bStop.load())
+            {
+                const FABCTTabStateSnapshot Snapshot = ABCTTabState::Read();
+                TornReads += Snapshot.UrlId != (uint32)Snapshot.LifecycleChangedCycles ? 1 : 0;
+            }
+            return TornReads; });
+
+        FABCTTabStateSnapshot Snapshot;
+        for (uint32 Index = 1; Index <= 200000; ++Index)
+        {
+            Snapshot.UrlId = Index;
+            Snapshot.LifecycleChangedCycles = Index;
+            ABCTTabState::Publish(Snapshot);
+        }
+        bStop = true;
+        TestEqual(TEXT("Torn reads"), Reader.Get(), 0);
+
+        ABCTTabState::Publish(FABCTTabStateSnapshot()); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Reflected types used by the automation specs.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_TestStructs.generated.h"
+
+UENUM()
+enum class EABCTTestRarity : uint8
+{
+    Common,
+    Rare,
+    Legendary = 5
+};
+
+USTRUCT()
+struct FABCTTestItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Name;
+
+    UPROPERTY()
+    int32 Count = 0;
+
+    UPROPERTY()
+    EABCTTestRarity Rarity = EABCTTestRarity::Common;
+};
+
+/** Covers every field kind ABCTStructSerializer supports */
+USTRUCT()
+struct FABCTTestInventory
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Gold = 0;
+
+    UPROPERTY()
+    bool bPremium = false;
+
+    UPROPERTY()
+    float Weight = 0.0f;
+
+    UPROPERTY()
+    FName Slot;
+
+    UPROPERTY()
+    FText Title;
+
+    UPROPERTY()
+    FVector Position = FVector::ZeroVector;
+
+    UPROPERTY()
+    TArray<FABCTTestItem> Items;
+
+    UPROPERTY()
+    TArray<int64> Ids;
+
+    /** Not reflected, so never serialized */
+    int32 Transient = 0;
+};
+
+/** Holds an array of itself */
+USTRUCT()
+struct FABCTTestNode
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FString Name;
+
+    UPROPERTY()
+    TArray<FABCTTestNode> Children;
+};
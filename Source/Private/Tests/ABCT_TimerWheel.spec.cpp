@@ -0,0 +1,207 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the timer wheel.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_TimerWheel.h"
+#include "ABCT_Stats.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_TimerWheelSpec, "Punal.AndroidBrowserCustomTab.TimerWheel", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+END_DEFINE_SPEC(FABCT_TimerWheelSpec)
+
+void FABCT_TimerWheelSpec::Define()
+{
+    BeforeEach([this]()
+               { ABCTStats::ResetAll(); });
+
+    Describe("FABCTTimerWheel", [this]()
+             {
+        It("should fire a timer on its due tick and not before", [this]()
+           {
+            for (const uint64 Delay : {(uint64)1, (uint64)63, (uint64)64, (uint64)100, (uint64)5000, (uint64)300000})
+            {
+                FABCTTimerWheel Wheel;
+                int32 Calls = 0;
+                const FABCTTimerHandle Handle = Wheel.Add(Delay, [&Calls]()
+                                                          { ++Calls; });
+
+                TestEqual(FString::Printf(TEXT("Nothing before tick %llu"), Delay), Wheel.AdvanceTo(Delay - 1), 0);
+                TestEqual(TEXT("One tick left"), Wheel.GetRemainingTicks(Handle), (int64)1);
+                TestEqual(FString::Printf(TEXT("Fired on tick %llu"), Delay), Wheel.AdvanceTo(Delay), 1);
+                TestEqual(TEXT("Once"), Calls, 1);
+                TestEqual(TEXT("Nothing scheduled"), Wheel.Num(), 0);
+            } });
+
+        It("should keep timers beyond the top level until they are due", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            const uint64 Delay = (1ull << (FABCTTimerWheel::SlotBits * FABCTTimerWheel::NumLevels)) + 5;
+            int32 Calls = 0;
+            const FABCTTimerHandle Handle = Wheel.Add(Delay, [&Calls]()
+                                                      { ++Calls; });
+
+            TestEqual(TEXT("Remaining"), Wheel.GetRemainingTicks(Handle), (int64)Delay);
+            TestEqual(TEXT("Nothing before the due tick"), Wheel.AdvanceTo(Delay - 1), 0);
+            TestEqual(TEXT("Fired on the due tick"), Wheel.AdvanceTo(Delay), 1);
+            TestEqual(TEXT("Once"), Calls, 1); });
+
+        It("should fire every timer of a tick in one advance", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            int32 Calls = 0;
+            for (int32 Index = 0; Index < 1000; ++Index)
+            {
+                Wheel.Add(10 + Index % 2, [&Calls]()
+                          { ++Calls; });
+            }
+            TestEqual(TEXT("Scheduled"), Wheel.Num(), 1000);
+            TestEqual(TEXT("Both ticks in one advance"), Wheel.AdvanceTo(20), 1000);
+            TestEqual(TEXT("Every callback"), Calls, 1000); });
+
+        It("should not fire cancelled timers", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            int32 Calls = 0;
+            FABCTTimerHandle Handle = Wheel.Add(100, [&Calls]()
+                                                { ++Calls; });
+            FABCTTimerHandle Kept = Wheel.Add(100, [&Calls]()
+                                              { Calls += 10; });
+
+            TestTrue(TEXT("Cancelled"), Wheel.Cancel(Handle));
+            TestFalse(TEXT("Handle invalidated"), Handle.IsValid());
+            TestFalse(TEXT("Twice"), Wheel.Cancel(Handle));
+            TestEqual(TEXT("One left"), Wheel.Num(), 1);
+            Wheel.AdvanceTo(200);
+            TestEqual(TEXT("Only the other timer"), Calls, 10);
+            TestFalse(TEXT("Fired timers are inactive"), Wheel.IsActive(Kept)); });
+
+        It("should not let a stale handle cancel the timer that reused its entry", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            FABCTTimerHandle First = Wheel.Add(10, []() {});
+            const FABCTTimerHandle Stale = First;
+            Wheel.Cancel(First);
+
+            bool bFired = false;
+            const FABCTTimerHandle Second = Wheel.Add(10, [&bFired]()
+                                                      { bFired = true; });
+            TestEqual(TEXT("Entry reused"), Second.Id, Stale.Id);
+
+            FABCTTimerHandle StaleCopy = Stale;
+            TestFalse(TEXT("Stale handle misses"), Wheel.Cancel(StaleCopy));
+            TestTrue(TEXT("New timer still scheduled"), Wheel.IsActive(Second));
+            Wheel.AdvanceTo(10);
+            TestTrue(TEXT("New timer fired"), bFired); });
+
+        It("should fire timers added with no delay on the next advance", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            Wheel.AdvanceTo(1000);
+            int32 Calls = 0;
+            Wheel.Add(0, [&Wheel, &Calls]()
+                      {
+                ++Calls;
+                // Added while firing; waits for the next advance
+                Wheel.Add(0, [&Calls]()
+                          { ++Calls; }); });
+
+            TestEqual(TEXT("Same tick"), Wheel.AdvanceTo(1000), 1);
+            TestEqual(TEXT("Nested timer waits"), Wheel.Num(), 1);
+            TestEqual(TEXT("Next advance"), Wheel.AdvanceTo(1000), 1);
+            TestEqual(TEXT("Both"), Calls, 2); });
+
+        It("should repeat until the timer cancels itself", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            int32 Calls = 0;
+            FABCTTimerHandle Handle;
+            Handle = Wheel.Add(5, [&Wheel, &Calls, &Handle]()
+                               {
+                if (++Calls == 3)
+                {
+                    Wheel.Cancel(Handle);
+                } }, 70);
+
+            TestEqual(TEXT("First"), Wheel.AdvanceTo(5), 1);
+            TestEqual(TEXT("Rescheduled"), Wheel.GetRemainingTicks(Handle), (int64)70);
+            TestEqual(TEXT("Not early"), Wheel.AdvanceTo(74), 0);
+            TestEqual(TEXT("Second"), Wheel.AdvanceTo(75), 1);
+            TestEqual(TEXT("Third"), Wheel.AdvanceTo(145), 1);
+            Wheel.AdvanceTo(1000);
+            TestEqual(TEXT("Stopped by its own callback"), Calls, 3);
+            TestEqual(TEXT("Nothing scheduled"), Wheel.Num(), 0); });
+
+        It("should fire each timer on its own tick when one advance spans them all", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            const uint64 Delays[] = {3, 64, 65, 4095, 4097, 300000, (1ull << (FABCTTimerWheel::SlotBits * FABCTTimerWheel::NumLevels)) + 7};
+            TArray<uint64> FiredTicks;
+            for (const uint64 Delay : Delays)
+            {
+                Wheel.Add(Delay, [&Wheel, &FiredTicks]()
+                          { FiredTicks.Add(Wheel.GetCurrentTick()); });
+            }
+
+            TestEqual(TEXT("All fired in one advance"), Wheel.AdvanceTo(Delays[UE_ARRAY_COUNT(Delays) - 1] + 1000), (int32)UE_ARRAY_COUNT(Delays));
+            TestEqual(TEXT("Count"), FiredTicks.Num(), (int32)UE_ARRAY_COUNT(Delays));
+            for (int32 Index = 0; Index < FiredTicks.Num() && Index < (int32)UE_ARRAY_COUNT(Delays); ++Index)
+            {
+                TestEqual(FString::Printf(TEXT("Timer %d on its due tick"), Index), FiredTicks[Index], Delays[Index]);
+            }
+            TestEqual(TEXT("Ends on the target tick"), Wheel.GetCurrentTick(), Delays[UE_ARRAY_COUNT(Delays) - 1] + 1000); });
+
+        It("should fire a repeating timer once after a stall and repeat from the target tick", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            int32 Calls = 0;
+            const FABCTTimerHandle Handle = Wheel.Add(10, [&Calls]()
+                                                      { ++Calls; }, 5);
+
+            TestEqual(TEXT("Once for the whole stall"), Wheel.AdvanceTo(100000), 1);
+            TestEqual(TEXT("Due a period after the target"), Wheel.GetRemainingTicks(Handle), (int64)5);
+            TestEqual(TEXT("Not early"), Wheel.AdvanceTo(100004), 0);
+            TestEqual(TEXT("Then on schedule"), Wheel.AdvanceTo(100005), 1);
+            TestEqual(TEXT("Calls"), Calls, 2); });
+
+        It("should drop every timer on Reset", [this]()
+           {
+            FABCTTimerWheel Wheel;
+            bool bFired = false;
+            const FABCTTimerHandle Handle = Wheel.Add(10, [&bFired]()
+                                                      { bFired = true; });
+            Wheel.Reset();
+            TestEqual(TEXT("Nothing scheduled"), Wheel.Num(), 0);
+            TestFalse(TEXT("Handle misses"), Wheel.IsActive(Handle));
+            Wheel.AdvanceTo(100);
+            TestFalse(TEXT("Not fired"), bFired); }); });
+
+    Describe("ABCTTimers", [this]()
+             {
+        It("should run timers from Tick and count them", [this]()
+           {
+            const int32 Before = ABCTTimers::NumTimers();
+            bool bFired = false;
+            FABCTTimerHandle Handle = ABCTTimers::SetTimer(0.0, [&bFired]()
+                                                           { bFired = true; });
+            FABCTTimerHandle Later = ABCTTimers::SetTimer(60.0, []() {});
+            TestEqual(TEXT("Gauge"), ABCTStats::GetGauge(EABCTGauge::TimersScheduled), (int64)(Before + 2));
+
+            const double Remaining = ABCTTimers::GetTimerRemaining(Later);
+            TestTrue(TEXT("Never early"), Remaining >= 60.0 && Remaining <= 60.0 + 2 * ABCTTimers::TickSeconds);
+
+            ABCTTimers::Tick();
+            TestTrue(TEXT("Fired on the next tick"), bFired);
+            TestFalse(TEXT("Done"), ABCTTimers::IsTimerActive(Handle));
+            TestTrue(TEXT("Counted"), ABCTStats::GetCounter(EABCTCounter::TimersFired) >= 1);
+
+            TestTrue(TEXT("Cleared"), ABCTTimers::ClearTimer(Later));
+            TestFalse(TEXT("Inactive"), ABCTTimers::IsTimerActive(Later));
+            TestEqual(TEXT("Remaining"), ABCTTimers::GetTimerRemaining(Later), -1.0);
+            TestEqual(TEXT("Back to where it was"), ABCTTimers::NumTimers(), Before); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,89 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for the URL table.
+ * @Date: 18/10/2026
+ */
+
+#include "ABCT_UrlTable.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FABCT_UrlTableSpec, "Punal.AndroidBrowserCustomTab.UrlTable", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+END_DEFINE_SPEC(FABCT_UrlTableSpec)
+
+void FABCT_UrlTableSpec::Define()
+{
+    Describe("Canonicalization", [this]()
+             {
+        It("should lower-case scheme and host, drop the default port and split the parts", [this]()
+           {
+            const FABCTUrl Url(TEXT("HTTPS://User@Example.COM:443/Store/Item?id=42&Ref=Home#Reviews"));
+            TestEqual(TEXT("Canonical"), Url.GetCanonical(), FString(TEXT("https://example.com/Store/Item?id=42&Ref=Home#Reviews")));
+            TestEqual(TEXT("Scheme"), FString(Url.GetScheme()), FString(TEXT("https")));
+            TestEqual(TEXT("Host"), FString(Url.GetHost()), FString(TEXT("example.com")));
+            TestEqual(TEXT("Port"), Url.GetPort(), 443);
+            TestEqual(TEXT("Origin"), FString(Url.GetOrigin()), FString(TEXT("https://example.com")));
+            TestEqual(TEXT("Path"), FString(Url.GetPath()), FString(TEXT("/Store/Item")));
+            TestEqual(TEXT("Query"), FString(Url.GetQuery()), FString(TEXT("id=42&Ref=Home")));
+            TestEqual(TEXT("Fragment"), FString(Url.GetFragment()), FString(TEXT("Reviews"))); });
+
+        It("should keep explicit ports and add the root path", [this]()
+           {
+            const FABCTUrl Url(TEXT("http://192.168.1.8:8080?debug=1"));
+            TestEqual(TEXT("Canonical"), Url.GetCanonical(), FString(TEXT("http://192.168.1.8:8080/?debug=1")));
+            TestEqual(TEXT("Port"), Url.GetPort(), 8080);
+            TestEqual(TEXT("Origin"), FString(Url.GetOrigin()), FString(TEXT("http://192.168.1.8:8080"))); });
+
+        It("should handle IPv6 hosts and non-hierarchical URLs", [this]()
+           {
+            const FABCTUrl Ipv6(TEXT("http://[::1]:3000/a"));
+            TestEqual(TEXT("IPv6 host"), FString(Ipv6.GetHost()), FString(TEXT("[::1]")));
+            TestEqual(TEXT("IPv6 port"), Ipv6.GetPort(), 3000);
+
+            const FABCTUrl Blank(TEXT("About:blank"));
+            TestEqual(TEXT("Opaque canonical"), Blank.GetCanonical(), FString(TEXT("about:blank")));
+            TestTrue(TEXT("No host"), Blank.GetHost().IsEmpty()); });
+
+        It("should treat URLs with an out of range or non-numeric port as invalid", [this]()
+           {
+            const FABCTUrl Highest(TEXT("https://example.com:65535/a"));
+            TestEqual(TEXT("Highest port kept"), Highest.GetPort(), 65535);
+
+            for (const TCHAR *Text : {TEXT("https://example.com:65536/a"), TEXT("https://example.com:99999/a"), TEXT("https://example.com:44x/a")})
+            {
+                const FABCTUrl Url(Text);
+                TestEqual(FString::Printf(TEXT("%s kept as-is"), Text), Url.GetCanonical(), FString(Text));
+                TestTrue(FString::Printf(TEXT("%s has no origin"), Text), Url.GetOrigin().IsEmpty() && Url.GetHost().IsEmpty() && Url.GetScheme().IsEmpty());
+                TestEqual(FString::Printf(TEXT("%s has no port"), Text), Url.GetPort(), -1);
+            } }); });
+
+    Describe("Interning", [this]()
+             {
+        It("should give equivalent URLs the same stable id", [this]()
+           {
+            const FABCTUrlRef First = ABCTUrlTable::Intern(TEXT("https://Example.com:443/intern-test"));
+            const FABCTUrlRef Second = ABCTUrlTable::Intern(TEXT("https://example.com/intern-test"));
+            const FABCTUrlRef Other = ABCTUrlTable::Intern(TEXT("https://example.com/intern-test?x=1"));
+            TestTrue(TEXT("Interned"), First.IsValid() && First->GetId() != 0);
+            TestTrue(TEXT("Same entry"), First == Second);
+            TestNotEqual(TEXT("Different URL, different id"), Other->GetId(), First->GetId());
+            TestTrue(TEXT("Found by id"), ABCTUrlTable::Find(First->GetId()) == First);
+            TestFalse(TEXT("Empty URL not interned"), ABCTUrlTable::Intern(TEXT("  ")).IsValid()); });
+
+        It("should evict old URLs without invalidating held refs", [this]()
+           {
+            const FABCTUrlRef Held = ABCTUrlTable::Intern(TEXT("https://example.com/held"));
+            for (int32 Index = 0; Index <= ABCTUrlTable::MaxEntries; ++Index)
+            {
+                ABCTUrlTable::Intern(FString::Printf(TEXT("https://example.com/evict/%d"), Index));
+            }
+            TestTrue(TEXT("Table stays bounded"), ABCTUrlTable::Num() <= ABCTUrlTable::MaxEntries);
+            TestFalse(TEXT("Evicted id no longer found"), ABCTUrlTable::Find(Held->GetId()).IsValid());
+            TestEqual(TEXT("Held ref still usable"), FString(Held->GetPath()), FString(TEXT("/held")));
+
+            const FABCTUrlRef Again = ABCTUrlTable::Intern(TEXT("https://example.com/held"));
+            TestTrue(TEXT("Re-interned with a new id"), Again->GetId() > Held->GetId()); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
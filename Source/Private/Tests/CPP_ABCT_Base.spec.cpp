@@ -0,0 +1,365 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Automation specs for UCPP_ABCT_Base.
+ * @Date: 18/10/2026
+ */
+
+#include "CPP_ABCT_Base.h"
+#include "ABCT_AllocationCounter.h"
+#include "ABCT_MessageChannel.h"
+#include "ABCT_SimulatedBackend.h"
+#include "ABCT_SpecFixture.h"
+#include "ABCT_Stats.h"
+#include "P_AndroidBrowserCustomTab.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ============================================================================
+// Performance Budgets
+// ============================================================================
+//
+// Budgets are deliberately loose enough for shared Linux CI runners; a failure
+// means a real regression (an extra copy, a parse in the hot path), not jitter.
+
+namespace ABCTBudgets
+{
+    /** Heap allocations on the game thread per event, ingress + dispatch + handler */
+    const int32 MaxAllocationsPerNavigationEvent = 24;
+    const int32 MaxAllocationsPerDeepLink = 24;
+    const int32 MaxAllocationsPerPostMessage = 24;
+    const int32 MaxAllocationsPerParameterLookup = 64;
+
+    /** Average game-thread microseconds per event (ingress + dispatch + handler) */
+    const double MaxMicrosPerNavigationEvent = 250.0;
+    const double MaxMicrosPerDeepLink = 250.0;
+    const double MaxMicrosPerPostMessage = 250.0;
+    const double MaxMicrosPerParameterLookup = 500.0;
+
+    /** Worst-case enqueue -> Blueprint dispatch latency while the game thread is pumping */
+    const uint64 MaxEnqueueToDispatchMicros = 50000;
+
+    /** Events per measured batch */
+    const int32 BatchSize = 256;
+}
+
+namespace
+{
+    void PumpGameThread()
+    {
+        FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+        FP_AndroidBrowserCustomTabModule::Drain();
+    }
+
+    /** Highest finite bucket bound that holds a sample, i.e. an upper bound on the max */
+    uint64 GetHistogramMaxBound(EABCTHistogram Histogram)
+    {
+        const FABCTHistogram &Source = ABCTStats::GetHistogram(Histogram);
+        for (int32 Index = FABCTHistogram::NumBuckets - 1; Index >= 0; --Index)
+        {
+            if (Source.Buckets[Index].load(std::memory_order_relaxed) > 0)
+            {
+                return FABCTHistogram::GetBucketUpperBound(Index);
+            }
+        }
+        return 0;
+    }
+
+    /** Result of running one batch of events through the pipeline */
+    struct FBatchCost
+    {
+        double AllocationsPerEvent;
+        double MicrosPerEvent;
+    };
+
+    /** Enqueues Count events with Enqueue, pumps them through, and measures the game-thread cost */
+    template <typename EnqueueFuncType>
+    FBatchCost MeasureBatch(int32 Count, EnqueueFuncType &&Enqueue)
+    {
+        FBatchCost Cost;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        int64 Allocations = 0;
+        {
+            FABCTScopedAllocationCounter AllocationCounter;
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                Enqueue(Index);
+            }
+            PumpGameThread();
+            Allocations = AllocationCounter.GetAllocations();
+        }
+        Cost.AllocationsPerEvent = (double)Allocations / Count;
+        Cost.MicrosPerEvent = (double)ABCTStats::CyclesToMicros(FPlatformTime::Cycles64() - StartCycles) / Count;
+        return Cost;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FCPP_ABCT_BaseSpec, "Punal.AndroidBrowserCustomTab.Base", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+TSharedPtr<FABCTSimulatedBackend> Backend;
+UCPP_ABCT_Base *Instance;
+const FString TeleportParams = TEXT("{\"x\":\"1000\",\"y\":\"-25.5\",\"z\":\"500\"}");
+END_DEFINE_SPEC(FCPP_ABCT_BaseSpec)
+
+void FCPP_ABCT_BaseSpec::Define()
+{
+    BeforeEach([this]()
+               {
+        ABCTStats::ResetAll();
+        ABCTSpecFixture::Setup(Backend, Instance); });
+
+    AfterEach([this]()
+              { ABCTSpecFixture::Teardown(Backend, Instance); });
+
+    // ============================================================================
+    // Open / Close Lifecycle
+    // ============================================================================
+
+    Describe("Lifecycle", [this]()
+             {
+        It("should open a tab through the backend and track the URL", [this]()
+           {
+            TestTrue(TEXT("OpenChromeCustomTab returns true"), Instance->OpenChromeCustomTab(TEXT("https://example.com/store")));
+            TestTrue(TEXT("Tab is open"), Instance->IsChromeCustomTabOpen());
+            TestEqual(TEXT("Current URL"), Instance->GetCurrentURL(), FString(TEXT("https://example.com/store")));
+            TestTrue(TEXT("Backend tab is open"), Backend->IsTabOpen());
+
+            PumpGameThread();
+            TestEqual(TEXT("Last event after the open sequence"), Instance->GetLastNavigationEvent(), FString(TEXT("MessageChannelReady")));
+            TestEqual(TEXT("All open events dispatched"), ABCTStats::GetCounter(EABCTCounter::NavigationEventsDispatched), ABCTStats::GetCounter(EABCTCounter::NavigationEventsReceived)); });
+
+        It("should reject an empty URL", [this]()
+           {
+            AddExpectedError(TEXT("URL is empty"), EAutomationExpectedErrorFlags::Contains, 1);
+            TestFalse(TEXT("OpenChromeCustomTab returns false"), Instance->OpenChromeCustomTab(TEXT("")));
+            TestFalse(TEXT("Tab is not open"), Instance->IsChromeCustomTabOpen());
+            TestEqual(TEXT("Failure counted"), ABCTStats::GetCounter(EABCTCounter::TabOpenFailures), (uint64)1); });
+
+        It("should report backend failures", [this]()
+           {
+            AddExpectedError(TEXT("Override backend returned false"), EAutomationExpectedErrorFlags::Contains, 1);
+            Backend->bFailOpen = true;
+            TestFalse(TEXT("OpenChromeCustomTab returns false"), Instance->OpenChromeCustomTab(TEXT("https://example.com")));
+            TestFalse(TEXT("Tab is not open"), Instance->IsChromeCustomTabOpen()); });
+
+        It("should close the tab and clear state", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            Instance->CloseChromeCustomTab();
+            TestFalse(TEXT("Tab is closed"), Instance->IsChromeCustomTabOpen());
+            TestTrue(TEXT("URL cleared"), Instance->GetCurrentURL().IsEmpty());
+            TestFalse(TEXT("Backend tab is closed"), Backend->IsTabOpen());
+            TestEqual(TEXT("Backend released its handles"), Backend->GetLiveHandleCount(), 0); });
+
+        It("should stop receiving events after close", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+            Instance->CloseChromeCustomTab();
+            Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+            PumpGameThread();
+            TestTrue(TEXT("Deep link not delivered"), Instance->GetLastDeepLinkAction().IsEmpty());
+            TestTrue(TEXT("Drop counted"), ABCTStats::GetCounter(EABCTCounter::EventsDroppedNoInstance) > 0); });
+
+        It("should survive repeated open/close cycles without leaking handles", [this]()
+           {
+            for (int32 Cycle = 0; Cycle < 100; ++Cycle)
+            {
+                Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+                PumpGameThread();
+                Instance->CloseChromeCustomTab();
+                PumpGameThread();
+            }
+            TestEqual(TEXT("Backend handles"), Backend->GetLiveHandleCount(), 0);
+            TestEqual(TEXT("Ingress queue drained"), ABCTStats::GetGauge(EABCTGauge::IngressQueueDepth), (int64)0); }); });
+
+    // ============================================================================
+    // HandleNavigationEvent
+    // ============================================================================
+
+    Describe("HandleNavigationEvent", [this]()
+             {
+        It("should update the current URL and last event", [this]()
+           {
+            Instance->HandleNavigationEvent(TEXT("NavigationFinished"), TEXT("https://example.com/item/42"));
+            TestEqual(TEXT("Last event"), Instance->GetLastNavigationEvent(), FString(TEXT("NavigationFinished")));
+            TestEqual(TEXT("Current URL"), Instance->GetCurrentURL(), FString(TEXT("https://example.com/item/42"))); });
+
+        It("should keep the current URL when the event has none", [this]()
+           {
+            Instance->HandleNavigationEvent(TEXT("NavigationStarted"), TEXT("https://example.com"));
+            Instance->HandleNavigationEvent(TEXT("TabShown"), TEXT(""));
+            TestEqual(TEXT("Current URL"), Instance->GetCurrentURL(), FString(TEXT("https://example.com")));
+            TestEqual(TEXT("Canonical URL"), Instance->GetCurrentCanonicalURL(), FString(TEXT("https://example.com/"))); });
+
+        It("should mark the tab open on NavigationStarted", [this]()
+           {
+            Instance->HandleNavigationEvent(TEXT("NavigationStarted"), TEXT("https://example.com"));
+            TestTrue(TEXT("Tab is open"), Instance->IsChromeCustomTabOpen()); });
+
+        It("should mark the tab closed on TabClosed", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            Instance->HandleNavigationEvent(TEXT("TabClosed"), TEXT(""));
+            TestFalse(TEXT("Tab is closed"), Instance->IsChromeCustomTabOpen());
+            TestTrue(TEXT("URL cleared"), Instance->GetCurrentURL().IsEmpty()); });
+
+        It("should deliver queued events in order", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            Backend->SimulateNavigationBurst(10);
+            PumpGameThread();
+            TestEqual(TEXT("Last event"), Instance->GetLastNavigationEvent(), FString(TEXT("NavigationFinished")));
+            TestEqual(TEXT("Last URL"), Instance->GetCurrentURL(), FString(TEXT("https://example.com/page/10"))); }); });
+
+    // ============================================================================
+    // HandleDeepLink
+    // ============================================================================
+
+    Describe("HandleDeepLink", [this]()
+             {
+        It("should store the action and parameters", [this]()
+           {
+            Instance->HandleDeepLink(TEXT("teleport"), TeleportParams);
+            TestEqual(TEXT("Action"), Instance->GetLastDeepLinkAction(), FString(TEXT("teleport")));
+            TestEqual(TEXT("Params"), Instance->GetLastDeepLinkParams(), TeleportParams); });
+
+        It("should deliver deep links from the backend to the active instance", [this]()
+           {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            Backend->SimulateDeepLink(TEXT("message"), TEXT("{\"text\":\"Hello\"}"));
+            PumpGameThread();
+            TestEqual(TEXT("Action"), Instance->GetLastDeepLinkAction(), FString(TEXT("message")));
+            TestEqual(TEXT("Dispatched"), ABCTStats::GetCounter(EABCTCounter::DeepLinksDispatched), (uint64)1); }); });
+
+    // ============================================================================
+    // GetDeepLinkParameter*
+    // ============================================================================
+
+    Describe("GetDeepLinkParameter", [this]()
+             {
+        It("should extract string values", [this]()
+           {
+            FString Value;
+            TestTrue(TEXT("Found"), Instance->GetDeepLinkParameter(TEXT("{\"text\":\"Hello World\"}"), TEXT("text"), Value));
+            TestEqual(TEXT("Value"), Value, FString(TEXT("Hello World"))); });
+
+        It("should return false for missing keys and empty input", [this]()
+           {
+            FString Value;
+            TestFalse(TEXT("Missing key"), Instance->GetDeepLinkParameter(TeleportParams, TEXT("w"), Value));
+            TestFalse(TEXT("Empty JSON"), Instance->GetDeepLinkParameter(TEXT(""), TEXT("x"), Value));
+            TestFalse(TEXT("Empty key"), Instance->GetDeepLinkParameter(TeleportParams, TEXT(""), Value)); });
+
+        It("should return false for invalid JSON", [this]()
+           {
+            AddExpectedError(TEXT("Failed to parse JSON"), EAutomationExpectedErrorFlags::Contains, 1);
+            FString Value;
+            TestFalse(TEXT("Invalid JSON"), Instance->GetDeepLinkParameter(TEXT("{not json"), TEXT("x"), Value));
+            TestEqual(TEXT("Failure counted"), ABCTStats::GetCounter(EABCTCounter::ParameterParseFailures), (uint64)1); });
+
+        It("should parse floats and ints", [this]()
+           {
+            float FloatValue = 0.0f;
+            int32 IntValue = 0;
+            TestTrue(TEXT("Float found"), Instance->GetDeepLinkParameterAsFloat(TeleportParams, TEXT("y"), FloatValue));
+            TestEqual(TEXT("Float value"), FloatValue, -25.5f);
+            TestTrue(TEXT("Int found"), Instance->GetDeepLinkParameterAsInt(TeleportParams, TEXT("x"), IntValue));
+            TestEqual(TEXT("Int value"), IntValue, 1000); });
+
+        It("should parse vectors and require all components", [this]()
+           {
+            FVector Vector = FVector::ZeroVector;
+            TestTrue(TEXT("Vector found"), Instance->GetDeepLinkParameterAsVector(TeleportParams, Vector));
+            TestEqual(TEXT("Vector value"), Vector, FVector(1000.0, -25.5, 500.0));
+            TestFalse(TEXT("Partial vector"), Instance->GetDeepLinkParameterAsVector(TEXT("{\"x\":\"1\",\"y\":\"2\"}"), Vector)); }); });
+
+    // ============================================================================
+    // Performance Budgets
+    // ============================================================================
+
+    Describe("Performance", [this]()
+             {
+        BeforeEach([this]()
+                   {
+            Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+            PumpGameThread();
+
+            // Warm up lazily-initialized engine paths so they are not billed to the first batch
+            Backend->SimulateNavigationBurst(4);
+            Backend->SimulateDeepLink(TEXT("teleport"), TeleportParams);
+            Backend->SimulatePostMessage(TEXT("{\"type\":\"warmup\"}"));
+            PumpGameThread();
+            ABCTStats::ResetAll(); });
+
+        It("should stay within the navigation event budget", [this]()
+           {
+            const FBatchCost Cost = MeasureBatch(ABCTBudgets::BatchSize / 2, [this](int32)
+                                                 { Backend->SimulateNavigationBurst(1); });
+            const double PerEventAllocations = Cost.AllocationsPerEvent / 2.0;
+            const double PerEventMicros = Cost.MicrosPerEvent / 2.0;
+            AddInfo(FString::Printf(TEXT("Navigation: %.1f allocations, %.2fus per event"), PerEventAllocations, PerEventMicros));
+            TestTrue(FString::Printf(TEXT("Allocations per navigation event %.1f <= %d"), PerEventAllocations, ABCTBudgets::MaxAllocationsPerNavigationEvent),
+                     PerEventAllocations <= ABCTBudgets::MaxAllocationsPerNavigationEvent);
+            TestTrue(FString::Printf(TEXT("Game-thread us per navigation event %.2f <= %.0f"), PerEventMicros, ABCTBudgets::MaxMicrosPerNavigationEvent),
+                     PerEventMicros <= ABCTBudgets::MaxMicrosPerNavigationEvent); });
+
+        It("should stay within the deep link budget", [this]()
+           {
+            const FBatchCost Cost = MeasureBatch(ABCTBudgets::BatchSize, [this](int32)
+                                                 { Backend->SimulateDeepLink(TEXT("teleport"), TeleportParams); });
+            AddInfo(FString::Printf(TEXT("Deep link: %.1f allocations, %.2fus per event"), Cost.AllocationsPerEvent, Cost.MicrosPerEvent));
+            TestTrue(FString::Printf(TEXT("Allocations per deep link %.1f <= %d"), Cost.AllocationsPerEvent, ABCTBudgets::MaxAllocationsPerDeepLink),
+                     Cost.AllocationsPerEvent <= ABCTBudgets::MaxAllocationsPerDeepLink);
+            TestTrue(FString::Printf(TEXT("Game-thread us per deep link %.2f <= %.0f"), Cost.MicrosPerEvent, ABCTBudgets::MaxMicrosPerDeepLink),
+                     Cost.MicrosPerEvent <= ABCTBudgets::MaxMicrosPerDeepLink); });
+
+        It("should stay within the PostMessage budget", [this]()
+           {
+            // Let the whole batch through flow control so every message is dispatched and billed
+            const FABCTInboundConfig SavedInboundConfig = FABCTMessageChannel::Get().GetInboundConfig();
+            FABCTInboundConfig InboundConfig = SavedInboundConfig;
+            InboundConfig.ReceiveWindow = ABCTBudgets::BatchSize;
+            InboundConfig.MaxDispatchPerTick = ABCTBudgets::BatchSize;
+            FABCTMessageChannel::Get().SetInboundConfig(InboundConfig);
+
+            const FBatchCost Cost = MeasureBatch(ABCTBudgets::BatchSize, [this](int32)
+                                                 { Backend->SimulatePostMessage(TEXT("{\"type\":\"state\",\"hp\":100}")); });
+            FABCTMessageChannel::Get().SetInboundConfig(SavedInboundConfig);
+            TestEqual(TEXT("Every message dispatched"), ABCTStats::GetCounter(EABCTCounter::PostMessagesDispatched), (uint64)ABCTBudgets::BatchSize);
+            AddInfo(FString::Printf(TEXT("PostMessage: %.1f allocations, %.2fus per event"), Cost.AllocationsPerEvent, Cost.MicrosPerEvent));
+            TestTrue(FString::Printf(TEXT("Allocations per PostMessage %.1f <= %d"), Cost.AllocationsPerEvent, ABCTBudgets::MaxAllocationsPerPostMessage),
+                     Cost.AllocationsPerEvent <= ABCTBudgets::MaxAllocationsPerPostMessage);
+            TestTrue(FString::Printf(TEXT("Game-thread us per PostMessage %.2f <= %.0f"), Cost.MicrosPerEvent, ABCTBudgets::MaxMicrosPerPostMessage),
+                     Cost.MicrosPerEvent <= ABCTBudgets::MaxMicrosPerPostMessage); });
+
+        It("should stay within the parameter lookup budget", [this]()
+           {
+            FVector Vector;
+            const FBatchCost Cost = MeasureBatch(ABCTBudgets::BatchSize, [this, &Vector](int32)
+                                                 { Instance->GetDeepLinkParameterAsVector(TeleportParams, Vector); });
+            // GetDeepLinkParameterAsVector performs three lookups
+            const double PerLookupAllocations = Cost.AllocationsPerEvent / 3.0;
+            const double PerLookupMicros = Cost.MicrosPerEvent / 3.0;
+            AddInfo(FString::Printf(TEXT("Parameter lookup: %.1f allocations, %.2fus per lookup"), PerLookupAllocations, PerLookupMicros));
+            TestTrue(FString::Printf(TEXT("Allocations per lookup %.1f <= %d"), PerLookupAllocations, ABCTBudgets::MaxAllocationsPerParameterLookup),
+                     PerLookupAllocations <= ABCTBudgets::MaxAllocationsPerParameterLookup);
+            TestTrue(FString::Printf(TEXT("Game-thread us per lookup %.2f <= %.0f"), PerLookupMicros, ABCTBudgets::MaxMicrosPerParameterLookup),
+                     PerLookupMicros <= ABCTBudgets::MaxMicrosPerParameterLookup); });
+
+        It("should stay within the enqueue to Blueprint latency budget", [this]()
+           {
+            for (int32 Index = 0; Index < ABCTBudgets::BatchSize; ++Index)
+            {
+                Backend->SimulateDeepLink(TEXT("jump"), TEXT("{\"height\":\"500\"}"));
+                PumpGameThread();
+            }
+            const uint64 MaxBound = GetHistogramMaxBound(EABCTHistogram::IngressToDispatchMicros);
+            AddInfo(FString::Printf(TEXT("Enqueue -> dispatch max <= %lluus"), MaxBound));
+            TestTrue(FString::Printf(TEXT("Enqueue -> dispatch max %lluus <= %lluus"), MaxBound, ABCTBudgets::MaxEnqueueToDispatchMicros),
+                     MaxBound <= ABCTBudgets::MaxEnqueueToDispatchMicros); }); });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,58 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Browser backend abstraction.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * IABCTBackend
+ *
+ * Outbound half of the custom tab bridge (game -> browser).
+ * On Android UCPP_ABCT_Base calls the generated ABCTJavaBridge stubs directly; installing
+ * an override backend routes UCPP_ABCT_Base through it instead, on any platform.
+ * The inbound half (browser -> game) always goes through ABCTIngress.
+ */
+class IABCTBackend
+{
+public:
+    virtual ~IABCTBackend() = default;
+
+    /**
+     * Opens URL in the browser.
+     *
+     * @return true if the browser accepted the request
+     */
+    virtual bool OpenTab(const FString &URL, const FString &ToolbarColor, const FString &UserAgent, const FString &CustomHeader) = 0;
+
+    /** Closes the browser tab and returns to the game */
+    virtual void CloseTab() = 0;
+
+    /**
+     * Sends one frame to the page over the PostMessage channel.
+     *
+     * @return true if the browser accepted the frame, false to retry later
+     */
+    virtual bool PostMessageToPage(const FString &Message) = 0;
+
+    /** Number of native handles (sessions, references, connections) the backend currently holds */
+    virtual int32 GetLiveHandleCount() const { return 0; }
+
+    /** Short name for logs and reports */
+    virtual FString GetName() const { return TEXT("custom"); }
+};
+
+namespace ABCTBackend
+{
+    /**
+     * Installs (or clears, with nullptr) the backend used by UCPP_ABCT_Base.
+     * Game thread only.
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void SetOverride(TSharedPtr<IABCTBackend> Backend);
+
+    /** Returns the installed override backend, or nullptr to use the platform bridge. Game thread only. */
+    P_ANDROIDBROWSERCUSTOMTAB_API TSharedPtr<IABCTBackend> GetOverride();
+}
@@ -0,0 +1,164 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel benchmark.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_MessageTypes.h"
+#include "Containers/Ticker.h"
+
+/**
+ * Workload settings for FABCTBenchmark. Sizes are in UTF-16 characters of message.
+ */
+struct FABCTBenchmarkConfig
+{
+    /** Round trips measured one at a time on an otherwise idle channel */
+    int32 IdleRttSamples = 200;
+
+    /** Interactive round trips measured while the Bulk lane is kept busy */
+    int32 LoadedRttSamples = 200;
+
+    /** Size of the Bulk lane messages that load the channel during LoadedRtt */
+    int32 LoadMessageChars = 64 * 1024;
+
+    /** Bulk messages kept in flight during LoadedRtt */
+    int32 LoadInFlight = 8;
+
+    /** Lane the throughput workloads are sent on */
+    EABCTMessageLane ThroughputLane = EABCTMessageLane::Interactive;
+
+    /** Message sizes of the throughput workloads, run in order */
+    TArray<int32> ThroughputSizes = {16, 256, 4096, 64 * 1024, 1024 * 1024};
+
+    /** How long each throughput size is driven */
+    double ThroughputSeconds = 3.0;
+
+    /** Messages in flight during throughput; keep below the inbound receive window */
+    int32 MaxInFlight = 32;
+
+    /** Characters in flight during throughput (at least one message is always in flight) */
+    int32 MaxInFlightChars = 4 * 1024 * 1024;
+
+    /** An unanswered message is counted as lost after this long */
+    double AckTimeoutSeconds = 10.0;
+
+    /** The benchmark aborts if the channel is not ready within this long */
+    double ChannelReadyTimeoutSeconds = 30.0;
+};
+
+/**
+ * FABCTBenchmark
+ *
+ * Runs standardized workloads over FABCTMessageChannel against a page that answers
+ * {"type":"bench","seq":N,...} with {"type":"bench_ack","seq":N,...} (see ABCTEchoPage):
+ *
+ *   idle_rtt     - one Interactive message in flight at a time
+ *   loaded_rtt   - the same while LoadInFlight Bulk messages keep the channel busy
+ *   throughput   - a window of messages in flight per size, reported as messages/s and bytes/s
+ *
+ * Round trips are measured from Send to the game thread receiving the ack, so they include
+ * lane scheduling, chunking, credits and the inbound dispatch budget. The result is a JSON
+ * report (schema "abct-benchmark/1") handed to OnFinished.
+ *
+ * Ticks itself from the core ticker. Game thread only.
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTBenchmark
+{
+public:
+    DECLARE_DELEGATE_OneParam(FOnFinished, const FString & /*ReportJson*/);
+
+    /**
+     * Starts the benchmark; it waits for the channel to become ready.
+     *
+     * @param InConfig - Workloads to run
+     * @param InBackendName - Backend label written to the report (e.g. "android", "simulated")
+     * @param InOnFinished - Called once with the report, also when the run aborts
+     */
+    FABCTBenchmark(const FABCTBenchmarkConfig &InConfig, const FString &InBackendName, FOnFinished InOnFinished);
+    ~FABCTBenchmark();
+
+    /**
+     * Consumes a page message if it is a benchmark ack.
+     *
+     * @param Message - Page message as dispatched to UCPP_ABCT_Base
+     * @return true if the message belonged to the benchmark and must not be dispatched further
+     */
+    bool HandleMessage(const FString &Message);
+
+    bool IsFinished() const { return Phase == EPhase::Finished; }
+
+    /** The JSON report, empty until finished */
+    const FString &GetReport() const { return Report; }
+
+private:
+    enum class EPhase : uint8
+    {
+        WaitForChannel,
+        IdleRtt,
+        LoadedRtt,
+        Throughput,
+        Finished,
+    };
+
+    struct FInFlight
+    {
+        double SentSeconds = 0.0;
+        int32 Chars = 0;
+        bool bProbe = false;
+        EPhase Phase = EPhase::WaitForChannel;
+        int32 SizeIndex = 0;
+    };
+
+    struct FThroughputResult
+    {
+        int32 Size = 0;
+        double Seconds = 0.0;
+        int64 Messages = 0;
+        int64 Chars = 0;
+        int32 Lost = 0;
+        TArray<double> RttMicros;
+    };
+
+    bool Tick(float DeltaTime);
+
+    /** Sends one bench message of Chars characters and tracks it */
+    void SendBench(EABCTMessageLane Lane, int32 Chars, bool bProbe);
+
+    /** Removes an in-flight message that was answered or lost */
+    void Retire(const FInFlight &Message);
+
+    /** Drops in-flight messages older than AckTimeoutSeconds */
+    void ExpireLost(double NowSeconds);
+
+    void EnterPhase(EPhase NewPhase, double NowSeconds);
+
+    /** Builds the report and calls OnFinished */
+    void Finish(const TCHAR *AbortReason);
+
+    FABCTBenchmarkConfig Config;
+    FString BackendName;
+    FOnFinished OnFinished;
+    FTSTicker::FDelegateHandle TickHandle;
+
+    EPhase Phase;
+    FDateTime StartedUtc;
+    double StartSeconds;
+    double PhaseStartSeconds;
+    int32 PhaseProbesSent;
+    int32 SizeIndex;
+    uint32 NextSeq;
+    int64 InFlightChars;
+    int32 InFlightProbes;
+    int32 InFlightLoad;
+    TMap<uint32, FInFlight> InFlight;
+
+    TArray<double> IdleRttMicros;
+    TArray<double> LoadedRttMicros;
+    int32 IdleRttLost;
+    int32 LoadedRttLost;
+    TArray<FThroughputResult> Throughput;
+    FString Report;
+};
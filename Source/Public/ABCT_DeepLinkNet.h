@@ -0,0 +1,110 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Compact network payloads for deep link actions.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_DeepLinkNet.generated.h"
+
+class UPackageMap;
+
+/**
+ * FABCTNetDeepLinkActionSpec
+ *
+ * Declares how one deep link action is typed for replication. The client decodes the
+ * params into values in this order, and the server reads them back by name. The spec list
+ * must be the same on both sides (it is class default data of the component), because the
+ * index of a spec is the action id sent on the wire.
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTNetDeepLinkActionSpec
+{
+    GENERATED_BODY()
+
+    /** The deep link action (e.g. "teleport") */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    FName Action;
+
+    /** Whether the x, y and z params form a location (quantized to 0.1 units) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    bool bHasLocation = false;
+
+    /** Params sent as integers (variable-length encoded) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    TArray<FName> IntParams;
+
+    /** Params sent as 32-bit floats */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    TArray<FName> FloatParams;
+};
+
+/**
+ * FABCTNetDeepLinkAction
+ *
+ * One decoded deep link action. Only ActionId and the values are sent; Action is filled in
+ * from the spec list by the receiver.
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTNetDeepLinkAction
+{
+    GENERATED_BODY()
+
+    /** Index of the action in the component's spec list */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    int32 ActionId = INDEX_NONE;
+
+    /** The action name (not replicated; resolved from ActionId) */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    FName Action;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    bool bHasLocation = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    FVector Location = FVector::ZeroVector;
+
+    /** Values of the spec's IntParams, in order */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    TArray<int32> Ints;
+
+    /** Values of the spec's FloatParams, in order */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    TArray<float> Floats;
+};
+
+/**
+ * FABCTNetDeepLinkBatch
+ *
+ * The deep link actions a client collected during one net update, sent in a single RPC.
+ *
+ * Wire format per batch: packed action count, then per action a packed action id, one bit
+ * for the location, the location as a packed vector at 0.1 unit precision, a packed int
+ * count with zig-zag packed values, and a packed float count with raw 32-bit values.
+ * Action names, param names and JSON punctuation are never sent.
+ */
+USTRUCT()
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTNetDeepLinkBatch
+{
+    GENERATED_BODY()
+
+    /** Upper bounds enforced when reading, so a malformed batch cannot allocate freely */
+    static constexpr int32 MaxActions = 64;
+    static constexpr int32 MaxValuesPerAction = 16;
+
+    UPROPERTY()
+    TArray<FABCTNetDeepLinkAction> Actions;
+
+    bool NetSerialize(FArchive &Ar, UPackageMap *Map, bool &bOutSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FABCTNetDeepLinkBatch> : public TStructOpsTypeTraitsBase2<FABCTNetDeepLinkBatch>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
@@ -0,0 +1,93 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Native gameplay tag dispatch for deep links.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "ABCT_Event.h"
+#include "ABCT_DeepLinkRouter.generated.h"
+
+class UCPP_ABCT_Base;
+
+/**
+ * FABCTDeepLinkEvent
+ *
+ * A deep link resolved to a gameplay tag through UCPP_ABCT_DeepLinkTagMap, with its
+ * params already decoded.
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTDeepLinkEvent
+{
+    GENERATED_BODY()
+
+    /** The tag mapped to the action */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    FGameplayTag Tag;
+
+    /** The deep link, shared with every other listener */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    FABCTEventHandle Link;
+
+    /**
+     * Query parameters (e.g. x -> "1000"). Keyed by string, not FName, so links from the page
+     * cannot add names to the global name table. Keys are case-insensitive.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    TMap<FString, FString> Params;
+
+    /** The instance that received the link */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    TObjectPtr<UCPP_ABCT_Base> Instance = nullptr;
+
+    /** The deep link action (e.g. "teleport") */
+    const FString &GetAction() const { return Link.Get().GetName(); }
+
+    /** Returns the parameter Key, or nullptr if the link does not have it */
+    const FString *FindParam(const FString &Key) const { return Params.Find(Key); }
+
+    /** Parses the parameter Key as a float; false if missing */
+    bool GetParamAsFloat(const FString &Key, float &OutValue) const;
+
+    /** Parses the parameter Key as an integer; false if missing */
+    bool GetParamAsInt(const FString &Key, int32 &OutValue) const;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FABCTDeepLinkTagEvent, const FABCTDeepLinkEvent &);
+
+/**
+ * ABCTDeepLinkRouter
+ *
+ * Game-thread registry of native handlers keyed by gameplay tag. A link tagged
+ * Deeplink.Travel.Teleport reaches the handlers of that tag, then those of Deeplink.Travel
+ * and Deeplink, so one handler can own a whole family of actions. Projects using the
+ * Gameplay Ability System can forward events to SendGameplayEventToActor from a handler.
+ */
+namespace ABCTDeepLinkRouter
+{
+    /**
+     * Registers Handler for Tag and all of its child tags.
+     *
+     * @param Tag - Tag to listen for
+     * @param Handler - Called on the game thread for every matching link
+     * @return Handle for RemoveHandler
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API FDelegateHandle AddHandler(FGameplayTag Tag, FABCTDeepLinkTagEvent::FDelegate Handler);
+
+    /** Unregisters a handler added with AddHandler */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RemoveHandler(FGameplayTag Tag, FDelegateHandle Handle);
+
+    /** Unregisters every handler bound to UserObject */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RemoveAllHandlers(const void *UserObject);
+
+    /**
+     * Calls the handlers of Event.Tag and of each of its parent tags, most specific first.
+     *
+     * @param Event - The resolved deep link
+     * @return Number of tags that had at least one handler
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API int32 Dispatch(const FABCTDeepLinkEvent &Event);
+}
@@ -0,0 +1,114 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Immutable shared event payloads.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_UrlTable.h"
+#include "ABCT_Event.generated.h"
+
+/** What an FABCTEvent carries */
+UENUM(BlueprintType)
+enum class EABCTEventKind : uint8
+{
+    /** Name = event name (NavigationFinished, TabClosed, ...), Url = the page */
+    Navigation UMETA(DisplayName = "Navigation"),
+
+    /** Name = action, Payload = params JSON */
+    DeepLink UMETA(DisplayName = "Deep Link"),
+
+    /** Payload = message, Origin = the channel origin */
+    PageMessage UMETA(DisplayName = "Page Message")
+};
+
+class FABCTEvent;
+
+/** Shared, read-only event; copying it copies a pointer */
+using FABCTEventRef = TSharedRef<const FABCTEvent, ESPMode::ThreadSafe>;
+
+/**
+ * FABCTEvent
+ *
+ * One event received from the browser, decoded once and never modified afterwards. The
+ * event and its reference count live in a single allocation; the strings are moved in,
+ * not copied. Every listener (internal state, native delegates, the tag router, Blueprint
+ * through FABCTEventHandle) shares the same instance, so fanning out to N listeners costs
+ * N pointer copies. Safe to read from any thread.
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTEvent
+{
+public:
+    /** URL is the page URL as received; empty if only the interned form is known */
+    static FABCTEventRef MakeNavigation(FString EventName, FABCTUrlRef Url, FString URL = FString());
+    static FABCTEventRef MakeDeepLink(FString Action, FString ParamsJson);
+    static FABCTEventRef MakePageMessage(FString Message, FString Origin);
+
+    EABCTEventKind GetKind() const { return Kind; }
+
+    /** Navigation event name or deep link action; empty for page messages */
+    const FString &GetName() const { return Name; }
+
+    /** Deep link params JSON or page message; empty for navigation events */
+    const FString &GetPayload() const { return Payload; }
+
+    /** PostMessage origin; empty for other kinds */
+    const FString &GetOrigin() const { return Origin; }
+
+    /** Interned URL of a navigation event, or nullptr */
+    const FABCTUrlRef &GetUrl() const { return Url; }
+
+    /** Canonical URL of a navigation event, or empty string */
+    const FString &GetUrlString() const;
+
+    /** URL of a navigation event as received, falling back to the canonical form */
+    const FString &GetSourceUrlString() const { return SourceUrl.IsEmpty() ? GetUrlString() : SourceUrl; }
+
+    /** FPlatformTime::Cycles64 when the event was created */
+    uint64 GetCreatedCycles() const { return CreatedCycles; }
+
+    /** Bytes held by the event and its strings; the interned URL is counted by the URL table */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Use the Make functions; public only for MakeShared */
+    FABCTEvent(EABCTEventKind InKind, FString &&InName, FString &&InPayload, FString &&InOrigin, FABCTUrlRef &&InUrl, FString &&InSourceUrl = FString());
+
+private:
+    const EABCTEventKind Kind;
+    const FString Name;
+    const FString Payload;
+    const FString Origin;
+    const FABCTUrlRef Url;
+    const FString SourceUrl;
+    const uint64 CreatedCycles;
+};
+
+/**
+ * FABCTEventHandle
+ *
+ * Blueprint handle to a shared FABCTEvent. Passing it around copies a pointer; read the
+ * fields with the UCPP_ABCT_EventLibrary functions.
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTEventHandle
+{
+    GENERATED_BODY()
+
+    FABCTEventHandle() = default;
+    FABCTEventHandle(const FABCTEventRef &InEvent) : Event(InEvent) {}
+
+    bool IsValid() const { return Event.IsValid(); }
+
+    /** The event; check IsValid first */
+    const FABCTEvent &Get() const { return *Event; }
+
+    TSharedPtr<const FABCTEvent, ESPMode::ThreadSafe> Event;
+};
+
+/** Native listeners of every event an instance dispatches */
+DECLARE_MULTICAST_DELEGATE_OneParam(FABCTEventDelegate, const FABCTEventRef &);
+
+/** Blueprint listeners of every event an instance dispatches */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FABCTEventHandleDelegate, const FABCTEventHandle &, Event);
@@ -0,0 +1,110 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Streaming JSON writer for outbound messages.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * FABCTJsonWriter
+ *
+ * Writes condensed JSON straight into a caller-owned FString, with no intermediate
+ * FJsonObject / FJsonValue nodes. Nothing is allocated except when the buffer has to grow,
+ * so writing into a pre-reserved buffer (UCPP_ABCT_Base::SendJsonToPage hands out pooled
+ * ones) is allocation-free:
+ *
+ *   FABCTJsonWriter Writer(Buffer);
+ *   Writer.BeginObject();
+ *   Writer.Field(TEXT("type"), TEXT("state"));
+ *   Writer.Key(TEXT("players"));
+ *   Writer.BeginArray();
+ *   ...
+ *   Writer.EndArray();
+ *   Writer.EndObject();
+ *
+ * The output is UTF-16 like the rest of the outbound path; the JNI bridge passes it to Java
+ * without conversion. Keys are not checked for duplicates. Nesting is limited to MaxDepth.
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTJsonWriter
+{
+public:
+    static constexpr int32 MaxDepth = 64;
+
+    /** Appends to Out; call Out.Reset() first to reuse its allocation */
+    explicit FABCTJsonWriter(FString &InOut);
+
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    /** Writes an object member name; the next call writes its value */
+    void Key(FStringView Name);
+
+    /** Like Key, for a name already encoded by EncodeKey (quoted, escaped, with the colon) */
+    void PreEncodedKey(FStringView EncodedKey);
+
+    /** Encodes Name once for PreEncodedKey: "Name": */
+    static FString EncodeKey(FStringView Name);
+
+    void Value(FStringView String);
+    void Value(const TCHAR *String) { Value(FStringView(String)); }
+    void Value(const FString &String) { Value(FStringView(String)); }
+    void Value(bool bValue);
+    void Value(int32 Number) { Value((int64)Number); }
+    void Value(uint32 Number) { Value((int64)Number); }
+    void Value(int64 Number);
+    void Value(uint64 Number);
+
+    /** Non-finite numbers are written as null, as JSON has no representation for them */
+    void Value(double Number);
+    void Value(float Number) { Value((double)Number); }
+    void Null();
+
+    /** Writes Json verbatim as a value; it must already be valid JSON */
+    void RawValue(FStringView Json);
+
+    /** Writes Bytes as a base64 string */
+    void Base64Value(TConstArrayView<uint8> Bytes);
+
+    /** Key(Name) followed by Value(FieldValue) */
+    template <typename ValueType>
+    void Field(FStringView Name, ValueType &&FieldValue)
+    {
+        Key(Name);
+        Value(Forward<ValueType>(FieldValue));
+    }
+
+    /** True once exactly one top-level value has been written and every container is closed */
+    bool IsComplete() const { return Depth == 0 && bWroteRoot; }
+
+    /**
+     * Appends Source to Out as the body of a JSON string literal (no surrounding quotes).
+     * Runs that need no escaping are copied in one go.
+     */
+    static void AppendEscaped(FString &Out, FStringView Source);
+
+private:
+    /** Writes the separator owed before a value at the current position */
+    void BeforeValue();
+
+    /** Writes the separator owed before an object member name */
+    void BeforeKey();
+
+    void Push(bool bObject);
+    void Pop(bool bObject);
+
+    FString &Out;
+
+    /** Bit per open container: 1 = object, 0 = array */
+    uint64 ObjectBits;
+
+    /** Bit per open container: set once it holds a member, so the next one needs a comma */
+    uint64 NonEmptyBits;
+    int32 Depth;
+    bool bAfterKey;
+    bool bWroteRoot;
+};
@@ -0,0 +1,43 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel types.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_MessageTypes.generated.h"
+
+/**
+ * Outbound lanes for messages sent to the page.
+ * Lanes are scheduled by weight and large messages are chunked, so a small
+ * Control message never waits behind a multi-megabyte Bulk snapshot.
+ */
+UENUM(BlueprintType)
+enum class EABCTMessageLane : uint8
+{
+    /** Small, urgent messages (close dialog, payment confirmed) */
+    Control UMETA(DisplayName = "Control"),
+
+    /** Regular UI traffic */
+    Interactive UMETA(DisplayName = "Interactive"),
+
+    /** Large state snapshots; chunked and sent with the lowest weight */
+    Bulk UMETA(DisplayName = "Bulk"),
+
+    Count UMETA(Hidden)
+};
+
+/**
+ * Encodings for structs sent with UCPP_ABCT_Base::SendStruct.
+ */
+UENUM(BlueprintType)
+enum class EABCTStructFormat : uint8
+{
+    /** {"type":"<Struct>","data":{...}} - readable, larger */
+    Json UMETA(DisplayName = "JSON"),
+
+    /** {"type":"<Struct>","schema":<hash>,"bin":"<base64>"} - compact, decoded with the schema message */
+    Binary UMETA(DisplayName = "Binary")
+};
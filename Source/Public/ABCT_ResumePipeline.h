@@ -0,0 +1,134 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Frame-spread restore work when the game returns from the tab.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_ResumePipeline.generated.h"
+
+/**
+ * What brought the game back from the tab.
+ */
+UENUM(BlueprintType)
+enum class EABCTResumeReason : uint8
+{
+    /** The browser reported TAB_HIDDEN (back button, or another app came to front) */
+    TabHidden UMETA(DisplayName = "Tab Hidden"),
+
+    /** The tab was closed */
+    TabClosed UMETA(DisplayName = "Tab Closed")
+};
+
+/**
+ * FABCTResumeProfile
+ *
+ * Frame times of the first frames after the game came back, and how long the restore work
+ * took to get through.
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTResumeProfile
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    EABCTResumeReason Reason = EABCTResumeReason::TabHidden;
+
+    /** Game frame time of each profiled frame, in milliseconds, first frame back first */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    TArray<float> FrameMillis;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    float WorstFrameMillis = 0.0f;
+
+    /** Resume steps run to completion */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    int32 StepsRun = 0;
+
+    /** Frames until the last step finished, or -1 if steps were still running at the end of the profile or were dropped */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Resume")
+    int32 RestoreFrames = 0;
+};
+
+/**
+ * Tuning of the resume pipeline.
+ */
+struct FABCTResumeConfig
+{
+    /** Time steps may take per frame; one step always runs, so a slow step gets a frame to itself */
+    double StepBudgetMillis = 2.0;
+
+    /** Frames profiled after the game comes back */
+    int32 ProfileFrames = 30;
+
+    /** Garbage collection is held off while steps run. Steps still unfinished after this many frames are dropped. */
+    int32 MaxResumeFrames = 120;
+
+    /** Frames the transient primary volume takes to ramp back up; 0 leaves audio alone */
+    int32 AudioRampFrames = 10;
+};
+
+/** A piece of restore work. Return true when done, false to be called again next frame. */
+DECLARE_DELEGATE_RetVal(bool, FABCTResumeStep);
+
+DECLARE_DELEGATE_OneParam(FABCTResumeProfileReady, const FABCTResumeProfile &);
+
+/**
+ * ABCTResumePipeline
+ *
+ * The first frames after the game comes back from the tab tend to hitch: GPU resources the OS
+ * evicted are recreated, audio restarts, a garbage collection that was due runs. When the tab
+ * is hidden or closed, the pipeline spreads that work over frames instead:
+ *   - registered steps run highest priority first, StepBudgetMillis of them per frame;
+ *   - garbage collection is deferred until the steps are through;
+ *   - the transient primary volume ramps up over AudioRampFrames instead of starting at full.
+ * The frame times of the first ProfileFrames frames are recorded as
+ * abct_resume_frame_microseconds and handed to the completion callback.
+ *
+ * Game thread only. Ticked from the message channel, once per frame; while a close started
+ * by CloseChromeCustomTab has not brought the game back yet (ABCTReturnToGame), it waits.
+ */
+namespace ABCTResumePipeline
+{
+    /**
+     * Registers a restore step, run on every resume.
+     *
+     * @param Name - Shown in logs
+     * @param Priority - Higher runs first (e.g. render targets before UI atlases before audio banks)
+     * @param Step - The work
+     * @return Handle for RemoveStep
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API FDelegateHandle AddStep(FName Name, int32 Priority, FABCTResumeStep Step);
+
+    /** Unregisters a step added with AddStep; a running resume finishes without it */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RemoveStep(FDelegateHandle Handle);
+
+    /** Unregisters every step bound to UserObject */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RemoveAllSteps(const void *UserObject);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API void SetConfig(const FABCTResumeConfig &Config);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API const FABCTResumeConfig &GetConfig();
+
+    /**
+     * Starts a resume. Ignored while one is running (TAB_HIDDEN is followed by the close).
+     *
+     * @param Reason - What brought the game back
+     * @param OnProfileReady - Called once the profile is complete
+     * @return false if a resume was already running
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API bool Begin(EABCTResumeReason Reason, FABCTResumeProfileReady OnProfileReady = FABCTResumeProfileReady());
+
+    /** Runs one frame of the current resume, if any */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Tick();
+
+    P_ANDROIDBROWSERCUSTOMTAB_API bool IsRunning();
+
+    /** Profile of the last completed resume, empty before the first */
+    P_ANDROIDBROWSERCUSTOMTAB_API const FABCTResumeProfile &GetLastProfile();
+
+    /** Abandons the current resume (restoring the volume) without reporting it (tests, shutdown) */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Cancel();
+}
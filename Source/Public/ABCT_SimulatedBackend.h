@@ -0,0 +1,95 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Simulated browser backend.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_Backend.h"
+
+/**
+ * FABCTSimulatedBackend
+ *
+ * Stand-in for ChromeCustomTabs.java that runs on every platform. It answers OpenTab/CloseTab
+ * with the same callback sequence the real browser produces and lets callers inject deep links,
+ * navigation bursts and PostMessages. All events enter through ABCTIngress, so the simulated
+ * pipeline is the real C++ pipeline minus the JNI string conversion.
+ *
+ * Usage:
+ *   TSharedPtr<FABCTSimulatedBackend> Backend = MakeShared<FABCTSimulatedBackend>();
+ *   ABCTBackend::SetOverride(Backend);
+ *   Instance->OpenChromeCustomTab(TEXT("https://example.com"));
+ *   Backend->SimulateDeepLink(TEXT("teleport"), TEXT("{\"x\":\"1\",\"y\":\"2\",\"z\":\"3\"}"));
+ *   FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTSimulatedBackend : public IABCTBackend
+{
+public:
+    FABCTSimulatedBackend();
+
+    // IABCTBackend interface
+    virtual bool OpenTab(const FString &URL, const FString &ToolbarColor, const FString &UserAgent, const FString &CustomHeader) override;
+    virtual void CloseTab() override;
+    virtual bool PostMessageToPage(const FString &Message) override;
+    virtual int32 GetLiveHandleCount() const override { return LiveHandles; }
+    virtual FString GetName() const override { return TEXT("simulated"); }
+
+    /**
+     * Emits Count NavigationStarted/NavigationFinished pairs for URLs under the open tab.
+     *
+     * @param Count - Number of page navigations to simulate
+     */
+    void SimulateNavigationBurst(int32 Count);
+
+    /** Emits a deep link as if the page navigated to uewebtest://Action?... */
+    void SimulateDeepLink(const FString &Action, const FString &ParamsJson);
+
+    /** Emits a PostMessage as if the page called postMessage(Message) */
+    void SimulatePostMessage(const FString &Message);
+
+    /** Makes the next OpenTab calls fail (simulates a device without a Custom Tabs provider) */
+    bool bFailOpen;
+
+    /** Makes PostMessage return false (simulates a busy or not yet connected channel) */
+    bool bRejectPostMessages;
+
+    /**
+     * Makes the simulated page behave like the bundled echo page (ABCTEchoPage): chunks are
+     * reassembled, pings answered, "bench" messages acked, and replies spend channel credits.
+     * Frames are not recorded in GetSentMessages() in this mode.
+     */
+    bool bEchoPage;
+
+    /** Frames the game sent to the page, in order */
+    const TArray<FString> &GetSentMessages() const { return SentMessages; }
+    void ClearSentMessages() { SentMessages.Reset(); }
+
+    bool IsTabOpen() const { return bTabOpen; }
+    const FString &GetCurrentURL() const { return CurrentURL; }
+
+private:
+    /** Echo page: handles one frame from the game */
+    void EchoFrame(const FString &Frame);
+
+    /** Echo page: handles one complete (reassembled) message */
+    void EchoMessage(const FString &Message);
+
+    /** Echo page: sends Message to the game once it holds a credit */
+    void SendFromEchoPage(FString Message);
+
+    bool bTabOpen;
+    int32 LiveHandles;
+    int32 NavigationCounter;
+    FString CurrentURL;
+    TArray<FString> SentMessages;
+
+    // Echo page state
+    TMap<int64, FString> EchoChunks;
+    TArray<FString> EchoBacklog;
+    int32 EchoCredits;
+    /** Receive times since the last pong, as comma-separated ["type",_ts,receive ms] entries */
+    FString EchoReceipts;
+    int32 EchoReceiptCount;
+};
@@ -0,0 +1,238 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Lock-free pipeline statistics.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Monotonic counters exported by the plugin.
+ * Keep in sync with the name table in ABCT_Stats.cpp.
+ */
+enum class EABCTCounter : uint8
+{
+    TabOpenRequests,
+    TabOpenFailures,
+    TabCloseRequests,
+    TabCloseRelaunches,
+    NavigationEventsReceived,
+    NavigationEventsDispatched,
+    DeepLinksReceived,
+    DeepLinksDispatched,
+    DeepLinksRoutedByTag,
+    DeepLinkBatchesReceived,
+    DeepLinkBatchesRejected,
+    DeepLinkSignaturesVerified,
+    DeepLinkSignaturesRejected,
+    DeepLinkReplaysRejected,
+    DeepLinkNetActionsQueued,
+    DeepLinkNetBatchesSent,
+    DeepLinkNetActionsRejected,
+    PostMessagesReceived,
+    PostMessagesDispatched,
+    EventsDroppedNoInstance,
+    ParameterLookups,
+    ParameterParseFailures,
+    OutboundMessagesQueued,
+    OutboundMessagesSent,
+    OutboundMessagesDropped,
+    OutboundFramesSent,
+    OutboundChunksSent,
+    OutboundCharsSent,
+    OutboundSendRetries,
+    OutboundPayloadBuffersReused,
+    InboundMessagesDropped,
+    InboundCreditsGranted,
+    InboundSlowdownsSent,
+    IdempotencyKeysChecked,
+    DuplicatesDropped,
+    ClockSyncSamples,
+    MemoryShedSteps,
+    ResumeStepsRun,
+    TabJobSlicesRun,
+    TabJobsCompleted,
+    TabJobMicros,
+    PrefetchLoadsStarted,
+    PrefetchLoadsCompleted,
+    PrefetchLoadsCancelled,
+    TimersFired,
+
+    Count
+};
+
+/**
+ * Point-in-time values exported by the plugin (can go up and down).
+ * Keep in sync with the name table in ABCT_Stats.cpp.
+ */
+enum class EABCTGauge : uint8
+{
+    TabOpen,
+    IngressQueueDepth,
+    DeepLinkVerifyQueueDepth,
+    LiveInstances,
+    OutboundQueuedMessages,
+    InboundQueuedMessages,
+    InboundOutstandingCredits,
+    InternedUrls,
+    ClockOffsetMicros,
+    ClockBestDelayMicros,
+    MemoryQueuesBytes,
+    MemoryMessagingBytes,
+    MemoryCachesBytes,
+    MemoryBudgetBytes,
+    MemoryShedLevel,
+    TabJobsPending,
+    TimersScheduled,
+
+    Count
+};
+
+/**
+ * Latency / duration histograms exported by the plugin. All values are in microseconds.
+ * Keep in sync with the name table in ABCT_Stats.cpp.
+ */
+enum class EABCTHistogram : uint8
+{
+    IngressToDispatchMicros,
+    NavigationHandlerMicros,
+    DeepLinkHandlerMicros,
+    DeepLinkStageBrowserMicros,
+    DeepLinkStageBridgeMicros,
+    DeepLinkStageIngressMicros,
+    DeepLinkStageQueueMicros,
+    DeepLinkStageDecodeMicros,
+    DeepLinkStageDispatchMicros,
+    DeepLinkStageHandlerMicros,
+    DeepLinkVerifyMicros,
+    ParameterParseMicros,
+    OutboundControlQueueMicros,
+    OutboundInteractiveQueueMicros,
+    OutboundBulkQueueMicros,
+    TabReturnToGameMicros,
+    ResumeFrameMicros,
+    ResumeWorstFrameMicros,
+    TabJobSessionWorkMicros,
+    PrefetchLoadMicros,
+
+    Count
+};
+
+/**
+ * Directions of the one-way latency histograms, which are further labelled by message type.
+ */
+enum class EABCTLatencyDirection : uint8
+{
+    PageToGame,
+    GameToPage,
+
+    Count
+};
+
+/**
+ * FABCTHistogram
+ *
+ * Fixed-size power-of-two histogram built on relaxed atomics.
+ * Bucket i counts samples with Value <= 2^i, the last bucket is +Inf.
+ * Recording never allocates or locks, so it is safe from the JNI thread,
+ * the game thread and the metrics endpoint thread at the same time.
+ */
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTHistogram
+{
+    /** 2^0 .. 2^25 microseconds (~33 seconds) plus the +Inf bucket */
+    static constexpr int32 NumBuckets = 27;
+
+    std::atomic<uint64> Buckets[NumBuckets];
+    std::atomic<uint64> Sum;
+    std::atomic<uint64> Count;
+
+    FABCTHistogram() { Reset(); }
+
+    void Record(uint64 Value);
+    void Reset();
+
+    /** Upper bound of bucket Index, or MAX_uint64 for the +Inf bucket */
+    static uint64 GetBucketUpperBound(int32 Index);
+};
+
+namespace ABCTStats
+{
+    P_ANDROIDBROWSERCUSTOMTAB_API void Increment(EABCTCounter Counter, uint64 Delta = 1);
+    P_ANDROIDBROWSERCUSTOMTAB_API uint64 GetCounter(EABCTCounter Counter);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API void SetGauge(EABCTGauge Gauge, int64 Value);
+    P_ANDROIDBROWSERCUSTOMTAB_API void AddGauge(EABCTGauge Gauge, int64 Delta);
+    P_ANDROIDBROWSERCUSTOMTAB_API int64 GetGauge(EABCTGauge Gauge);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API void RecordHistogram(EABCTHistogram Histogram, uint64 ValueMicros);
+    P_ANDROIDBROWSERCUSTOMTAB_API const FABCTHistogram &GetHistogram(EABCTHistogram Histogram);
+
+    /** Records the time elapsed since StartCycles (from FPlatformTime::Cycles64) */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RecordCyclesSince(EABCTHistogram Histogram, uint64 StartCycles);
+
+    /**
+     * Records a one-way message latency, labelled by direction and message type.
+     * Up to MaxLatencyTypes distinct types per direction are tracked; later ones share "other".
+     * Game thread only (new labels are registered without locks); reading is safe anywhere.
+     *
+     * @param Direction - Which way the message travelled
+     * @param MessageType - Message type label (characters outside [A-Za-z0-9_.-] become '_')
+     * @param ValueMicros - Latency in microseconds
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RecordOneWayLatency(EABCTLatencyDirection Direction, FStringView MessageType, uint64 ValueMicros);
+
+    /** Returns the one-way latency histogram for MessageType, or nullptr if nothing was recorded for it */
+    P_ANDROIDBROWSERCUSTOMTAB_API const FABCTHistogram *FindOneWayLatency(EABCTLatencyDirection Direction, FStringView MessageType);
+
+    /**
+     * Records the page tap -> handler complete latency of a deep link, labelled by action.
+     * Labels follow the RecordOneWayLatency rules. Game thread only.
+     *
+     * @param Action - The deep link action
+     * @param ValueMicros - Latency in microseconds
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RecordDeepLinkEndToEnd(FStringView Action, uint64 ValueMicros);
+
+    /** Returns the end-to-end histogram for Action, or nullptr if nothing was recorded for it */
+    P_ANDROIDBROWSERCUSTOMTAB_API const FABCTHistogram *FindDeepLinkEndToEnd(FStringView Action);
+
+    /** Distinct labels tracked per labelled family (message types per direction, deep link actions), including the shared "other" slot */
+    constexpr int32 MaxLatencyTypes = 32;
+
+    /** Converts an FPlatformTime::Cycles64 delta to whole microseconds */
+    P_ANDROIDBROWSERCUSTOMTAB_API uint64 CyclesToMicros(uint64 Cycles);
+
+    /** Resets every counter and histogram (tests and soak runs only). Gauges track live state and are kept. */
+    P_ANDROIDBROWSERCUSTOMTAB_API void ResetAll();
+
+    /**
+     * Appends every counter, gauge and histogram in Prometheus text exposition format (v0.0.4).
+     * Only reads relaxed atomics, so it can run on any thread without blocking writers.
+     *
+     * @param Out - Builder the exposition text is appended to
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void WritePrometheus(FAnsiStringBuilderBase &Out);
+}
+
+/**
+ * Scoped helper that records its lifetime into a histogram.
+ */
+struct FABCTScopedHistogramTimer
+{
+    explicit FABCTScopedHistogramTimer(EABCTHistogram InHistogram)
+        : Histogram(InHistogram), StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    ~FABCTScopedHistogramTimer()
+    {
+        ABCTStats::RecordCyclesSince(Histogram, StartCycles);
+    }
+
+private:
+    EABCTHistogram Histogram;
+    uint64 StartCycles;
+};
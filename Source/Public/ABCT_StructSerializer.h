@@ -0,0 +1,74 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Reflection-driven struct serialization.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_MessageTypes.h"
+
+class FABCTJsonWriter;
+class UScriptStruct;
+
+/**
+ * ABCTStructSerializer
+ *
+ * Serializes USTRUCTs for the page without hand-written JSON. The first use of a struct walks
+ * its reflection data once and caches a flat plan: one op per field with its absolute offset,
+ * type and JSON key pre-encoded, nested structs inlined, arrays pointing at an element plan.
+ * Recursive structs (a TArray<FNode> Children inside FNode) point the array back at the plan
+ * of the enclosing struct.
+ * Later calls only walk the plan, with no property iteration or name lookups.
+ *
+ * Supported fields: bool, integers, float, double, enums, FString, FName, FText, nested
+ * structs and TArray of any of these. Other fields (object references, maps, sets, static
+ * arrays) are skipped with a warning when the plan is built.
+ *
+ * Binary layout (little-endian, fields in plan order): bool = u8, numbers at their native
+ * width, enums as their underlying integer, strings = u32 UTF-8 byte length + bytes, arrays =
+ * u32 count + elements, nested structs inline. The schema message describes the layout:
+ *
+ *   {"type":"abct_schema","schema":<hash>,"def":{"type":"<Struct>","fields":[
+ *      {"name":"Gold","type":"i32"},
+ *      {"name":"Items","type":"array","of":{"type":"struct","struct":"Item","fields":[...]}},
+ *      {"name":"Rarity","type":"u8","enum":{"0":"Common","1":"Rare"}},
+ *      {"name":"Children","type":"array","of":{"type":"struct","ref":"<Struct>"}}]}}
+ *
+ * with types bool, i8, u8, i16, u16, i32, u32, i64, u64, f32, f64, str, struct and array.
+ * "ref" names an enclosing struct (the def's "type" or an entry's "struct") whose fields repeat.
+ *
+ * Thread-safe; plans are built once and live until shutdown. In the editor, plans of structs
+ * that use user defined structs or enums are not cached, since recompiling those changes
+ * their layout in place.
+ */
+namespace ABCTStructSerializer
+{
+    /**
+     * Writes the struct as a message envelope:
+     *   Json   - {"type":"<Struct>","data":{...}}
+     *   Binary - {"type":"<Struct>","schema":<hash>,"bin":"<base64>"}
+     *
+     * @param Struct - Struct type of Data
+     * @param Data - Struct instance
+     * @param Format - Encoding
+     * @param Writer - Receives exactly one JSON value
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void WriteMessage(const UScriptStruct *Struct, const void *Data, EABCTStructFormat Format, FABCTJsonWriter &Writer);
+
+    /** Writes the struct's fields as one JSON object */
+    P_ANDROIDBROWSERCUSTOMTAB_API void WriteJson(const UScriptStruct *Struct, const void *Data, FABCTJsonWriter &Writer);
+
+    /** Appends the binary encoding of the struct to Out */
+    P_ANDROIDBROWSERCUSTOMTAB_API void WriteBinary(const UScriptStruct *Struct, const void *Data, TArray<uint8> &Out);
+
+    /** Writes {"type":"abct_schema","schema":<hash>,"def":{...}} describing the binary layout */
+    P_ANDROIDBROWSERCUSTOMTAB_API void WriteSchemaMessage(const UScriptStruct *Struct, FABCTJsonWriter &Writer);
+
+    /** CRC of the schema definition; binary messages carry it so the page can match its schema */
+    P_ANDROIDBROWSERCUSTOMTAB_API uint32 GetSchemaHash(const UScriptStruct *Struct);
+
+    /** Message type used for Struct ("PlayerInventory" for FPlayerInventory) */
+    P_ANDROIDBROWSERCUSTOMTAB_API FString GetTypeName(const UScriptStruct *Struct);
+}
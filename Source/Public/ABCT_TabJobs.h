@@ -0,0 +1,139 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Background jobs run while the tab covers the game.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ABCT_TabState.h"
+#include "ShaderPipelineCache.h"
+#include "ABCT_TabJobs.generated.h"
+
+/** What a job slice reports back to the scheduler */
+enum class EABCTTabJobResult : uint8
+{
+    /** More work left; run again in a later slice */
+    Continue,
+
+    /** Finished for this tab session */
+    Done,
+};
+
+/**
+ * FABCTTabJobContext
+ *
+ * Passed to each job slice. Jobs do their work in small units and check ShouldYield between
+ * them.
+ */
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabJobContext
+{
+    /** End of the slice, in FPlatformTime::Seconds */
+    double DeadlineSeconds = 0.0;
+
+    /** true once the slice is used up or the game is back on screen; return Continue then */
+    bool ShouldYield() const;
+};
+
+/**
+ * Work done by background jobs during one tab session (open to close).
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabJobSessionStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Background Jobs")
+    int32 SlicesRun = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Background Jobs")
+    int32 JobsCompleted = 0;
+
+    /** CPU time spent in job slices, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Background Jobs")
+    float WorkMillis = 0.0f;
+};
+
+/**
+ * Tuning of the background job scheduler.
+ */
+struct FABCTTabJobConfig
+{
+    /** Length of one job slice */
+    double SliceMillis = 4.0;
+
+    /** Share of one core the jobs may use, so the browser keeps its headroom (0..1] */
+    float CpuBudget = 0.25f;
+
+    /** Switch shader pipeline cache precompilation to its fast batch mode while the tab is up */
+    bool bFastPSOPrecompile = true;
+};
+
+using FABCTTabJob = TFunction<EABCTTabJobResult(const FABCTTabJobContext &)>;
+
+/**
+ * ABCTTabJobs
+ *
+ * While the player is in the tab the game is idle but alive. This scheduler uses that time for
+ * registered background work (asset prefetch, cache compaction, save serialization, ...):
+ * jobs run on a low-priority worker thread in slices of SliceMillis, with sleeps between
+ * slices that hold them to CpuBudget of one core (at least 1 ms, so a job that yields straight
+ * away does not spin the worker). They only run while the tab covers the game
+ * (ABCTTabState) and pause at the end of the current slice once it hides. The shader pipeline
+ * cache is switched to fast precompilation for the same time.
+ *
+ * Jobs run on the worker, so work that must happen on the game thread (garbage collection,
+ * UObject access) should be queued from the job rather than done in it. Jobs and the config
+ * are managed from the game thread.
+ */
+namespace ABCTTabJobs
+{
+    /**
+     * Registers a job. The worker runs the highest priority unfinished job.
+     *
+     * @param Name - Shown in logs
+     * @param Priority - Higher runs first
+     * @param Job - One slice of work, called on the worker thread
+     * @param bEverySession - Run again in every tab session instead of once
+     * @return Handle for RemoveJob
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API FDelegateHandle AddJob(FName Name, int32 Priority, FABCTTabJob Job, bool bEverySession = false);
+
+    /** Unregisters a job; waits for its slice to finish if it is running */
+    P_ANDROIDBROWSERCUSTOMTAB_API void RemoveJob(FDelegateHandle Handle);
+
+    /** Number of registered jobs not finished in the current session */
+    P_ANDROIDBROWSERCUSTOMTAB_API int32 NumPending();
+
+    P_ANDROIDBROWSERCUSTOMTAB_API void SetConfig(const FABCTTabJobConfig &Config);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabJobConfig GetConfig();
+
+    /**
+     * Follows the tab lifecycle: starts and ends sessions, wakes the worker, switches the PSO
+     * batch mode. Called by UCPP_ABCT_Base after each publish. Game thread only.
+     *
+     * @param Snapshot - The state just published
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void OnTabStateChanged(const FABCTTabStateSnapshot &Snapshot);
+
+    /**
+     * Sets the shader pipeline cache batch mode the game wants outside the tab. The engine has
+     * no getter for the current mode, so games that switch it (e.g. to Precompile behind a
+     * loading screen) should do so here: the mode is applied right away, or when the tab hides
+     * if fast precompilation is on, instead of being reset to Background. Game thread only.
+     *
+     * @param Mode - Batch mode to use while the tab is not covering the game
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void SetPSOBatchMode(FShaderPipelineCache::BatchMode Mode);
+
+    /** Work done so far in the current session */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabJobSessionStats GetSessionStats();
+
+    /** Work done in the last finished session */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabJobSessionStats GetLastSessionStats();
+
+    /** Stops the worker; registered jobs are dropped (module shutdown) */
+    void Shutdown();
+}
@@ -0,0 +1,74 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Tab state snapshot readable from any thread.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Where the custom tab is in its lifecycle */
+enum class EABCTTabLifecycle : uint8
+{
+    /** No tab */
+    Closed,
+
+    /** Open requested, browser not shown yet */
+    Opening,
+
+    /** Tab is on screen, covering the game */
+    Visible,
+
+    /** Tab still exists but the game is on screen */
+    Hidden,
+};
+
+/**
+ * FABCTTabStateSnapshot
+ *
+ * One consistent view of the tab state. Timestamps are FPlatformTime::Cycles64 values,
+ * 0 if the event has not happened yet.
+ */
+struct FABCTTabStateSnapshot
+{
+    EABCTTabLifecycle Lifecycle = EABCTTabLifecycle::Closed;
+
+    /** Incremented on every publish; equal sequences mean an unchanged state */
+    uint32 Sequence = 0;
+
+    /** ABCTUrlTable id of the current URL, 0 if none */
+    uint32 UrlId = 0;
+
+    /** When the current tab was opened */
+    uint64 OpenedCycles = 0;
+
+    /** When Lifecycle last changed */
+    uint64 LifecycleChangedCycles = 0;
+
+    bool IsOpen() const { return Lifecycle != EABCTTabLifecycle::Closed; }
+
+    /** true while the tab is (or is about to be) on top of the game */
+    bool IsCoveringGame() const { return Lifecycle == EABCTTabLifecycle::Opening || Lifecycle == EABCTTabLifecycle::Visible; }
+};
+
+/**
+ * ABCTTabState
+ *
+ * The tab state published through a seqlock: the game thread is the single writer, and
+ * readers on any thread (audio, render, networking) get a consistent snapshot without
+ * locks, retrying only if they overlap a publish. UCPP_ABCT_Base publishes on every
+ * lifecycle or URL change.
+ */
+namespace ABCTTabState
+{
+    /** Returns the latest snapshot. Any thread, wait-free unless a publish is in progress. */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTTabStateSnapshot Read();
+
+    /**
+     * Publishes a new state; Sequence is assigned here. Game thread only.
+     *
+     * @param Snapshot - New state (Sequence is ignored)
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Publish(const FABCTTabStateSnapshot &Snapshot);
+}
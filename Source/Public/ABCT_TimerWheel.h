@@ -0,0 +1,201 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Hierarchical timer wheel for plugin timeouts and retries.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Handle to a scheduled timer. Handles of fired, cleared or reused timers simply miss.
+ */
+struct FABCTTimerHandle
+{
+    /** Pool index of the timer plus one; 0 for no timer */
+    uint32 Id = 0;
+
+    /** Allocation serial of the pool entry, so a stale handle does not hit its next timer */
+    uint32 Serial = 0;
+
+    bool IsValid() const { return Id != 0; }
+
+    void Invalidate()
+    {
+        Id = 0;
+        Serial = 0;
+    }
+};
+
+/**
+ * FABCTTimerWheel
+ *
+ * Hierarchical timing wheel: NumLevels wheels of SlotsPerLevel slots, each level counting
+ * SlotsPerLevel times slower than the one below (level 0 slots are one tick). A timer goes
+ * into the coarsest slot that still resolves its expiry and moves down a level whenever the
+ * wheel below wraps around, so inserting and cancelling are O(1) and an Advance only touches
+ * the slots it passes. Timers further out than the top level wait in an overflow list that is
+ * re-examined each time the top level wraps. Each level keeps a bit per occupied slot, so an
+ * Advance over a long stall jumps straight to the next slot that has timers to fire or to
+ * cascade instead of stepping through every tick in between.
+ *
+ * Slots are intrusive doubly linked lists over a pooled timer array whose entries are
+ * reused. Timers due in the same tick fire in one pass, in no guaranteed order. Not
+ * thread-safe.
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTTimerWheel
+{
+public:
+    static constexpr int32 SlotBits = 6;
+    static constexpr int32 SlotsPerLevel = 1 << SlotBits;
+    static constexpr int32 NumLevels = 4;
+
+    FABCTTimerWheel();
+
+    /**
+     * Schedules a timer.
+     *
+     * @param DelayTicks - Ticks from the current tick; 0 fires on the next Advance
+     * @param Callback - Called when the timer fires; may add and cancel timers
+     * @param RepeatTicks - Fires again this many ticks after each firing if > 0
+     * @return Handle for Cancel
+     */
+    FABCTTimerHandle Add(uint64 DelayTicks, TFunction<void()> Callback, uint64 RepeatTicks = 0);
+
+    /**
+     * Cancels a timer, also from within its own callback.
+     *
+     * @param Handle - The timer; invalidated
+     * @return true if the timer was still scheduled
+     */
+    bool Cancel(FABCTTimerHandle &Handle);
+
+    /** Whether the timer is still scheduled (a repeating timer stays scheduled while it fires) */
+    bool IsActive(const FABCTTimerHandle &Handle) const;
+
+    /** Ticks until the timer fires next, or -1 if it is not scheduled */
+    int64 GetRemainingTicks(const FABCTTimerHandle &Handle) const;
+
+    /**
+     * Moves the wheel forward to Tick, firing every timer due on the way. A repeating timer
+     * fires at most once per call and is next due RepeatTicks after Tick, so a stall does not
+     * replay the firings it missed.
+     *
+     * @param Tick - The new current tick; a tick in the past only fires timers added with no delay
+     * @return Number of timers fired
+     */
+    int32 AdvanceTo(uint64 Tick);
+
+    uint64 GetCurrentTick() const { return CurrentTick; }
+
+    /** Scheduled timers */
+    int32 Num() const { return NumScheduled; }
+
+    /** Heap bytes of the timer pool, not counting what the callbacks capture */
+    SIZE_T GetAllocatedSize() const { return Timers.GetAllocatedSize() + FreeTimers.GetAllocatedSize(); }
+
+    /** Drops every timer without firing it and frees the pool */
+    void Reset();
+
+private:
+    struct FTimer
+    {
+        TFunction<void()> Callback;
+        uint64 ExpiryTick = 0;
+        uint64 RepeatTicks = 0;
+        int32 Prev = INDEX_NONE;
+        int32 Next = INDEX_NONE;
+
+        /** List the timer is linked into; INDEX_NONE while it fires or once it is free */
+        int32 List = INDEX_NONE;
+        uint32 Serial = 0;
+    };
+
+    /** List indices after the level slots */
+    static constexpr int32 OverflowList = NumLevels * SlotsPerLevel;
+    static constexpr int32 DueList = OverflowList + 1;
+    static constexpr int32 FiringList = OverflowList + 2;
+    static constexpr int32 NumLists = OverflowList + 3;
+
+    /** Returns the pool index of Handle's timer, or INDEX_NONE if the handle is stale */
+    int32 Find(const FABCTTimerHandle &Handle) const;
+
+    /** Links a timer into the slot that resolves its expiry from the current tick */
+    void Schedule(int32 Index);
+
+    /** Moves every timer of List to Schedule again (a level wrapped around) */
+    void Cascade(int32 List);
+
+    /** Next tick after the current one with a slot to fire or cascade, or MAX_uint64 if none */
+    uint64 FindNextEventTick() const;
+
+    /**
+     * Fires every timer of List.
+     *
+     * @param TargetTick - Tick the advance is heading to; repeating timers are rescheduled from it
+     */
+    int32 Fire(int32 List, uint64 TargetTick);
+
+    void PushBack(int32 List, int32 Index);
+    void Unlink(int32 Index);
+    void Free(int32 Index);
+
+    TArray<FTimer> Timers;
+    TArray<int32> FreeTimers;
+    int32 Heads[NumLists];
+    int32 Tails[NumLists];
+
+    /** Bit per non-empty slot of each level */
+    uint64 Occupied[NumLevels];
+    uint64 CurrentTick;
+    int32 NumScheduled;
+    uint32 NextSerial;
+};
+
+/**
+ * ABCTTimers
+ *
+ * The plugin's timers (timeouts, debounce windows, TTLs, retry backoff) all run on one
+ * FABCTTimerWheel with TickSeconds resolution, advanced by the plugin tick
+ * (FP_AndroidBrowserCustomTabModule::Drain). A frame costs one coalesced advance however many
+ * timers are pending, instead of a ticker or delayed task per timer. A timer never fires
+ * early; it fires on the first plugin tick at or after its due time. Game thread only.
+ */
+namespace ABCTTimers
+{
+    /** Resolution of plugin timers */
+    constexpr double TickSeconds = 0.01;
+
+    /**
+     * Schedules a timer.
+     *
+     * @param DelaySeconds - Time from now; 0 fires on the next plugin tick
+     * @param Callback - Called on the game thread when the timer fires
+     * @param RepeatSeconds - Fires again this long after each firing if > 0
+     * @return Handle for ClearTimer
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTTimerHandle SetTimer(double DelaySeconds, TFunction<void()> Callback, double RepeatSeconds = 0.0);
+
+    /**
+     * Cancels a timer.
+     *
+     * @param Handle - The timer; invalidated
+     * @return true if the timer was still scheduled
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API bool ClearTimer(FABCTTimerHandle &Handle);
+
+    P_ANDROIDBROWSERCUSTOMTAB_API bool IsTimerActive(const FABCTTimerHandle &Handle);
+
+    /** Seconds until the timer fires next, or -1 if it is not scheduled */
+    P_ANDROIDBROWSERCUSTOMTAB_API double GetTimerRemaining(const FABCTTimerHandle &Handle);
+
+    /** Scheduled timers */
+    P_ANDROIDBROWSERCUSTOMTAB_API int32 NumTimers();
+
+    /** Advances the wheel to now and fires due timers (plugin tick) */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Tick();
+
+    /** Drops every timer (module shutdown) */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Shutdown();
+}
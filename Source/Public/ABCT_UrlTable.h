@@ -0,0 +1,112 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - URL canonicalization and interning.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SharedPointer.h"
+
+/**
+ * FABCTUrl
+ *
+ * A canonicalized URL with its parts pre-split. Immutable once interned.
+ *
+ * Canonical form: scheme and host lower-cased, default port (http 80, https 443, ws 80,
+ * wss 443) dropped, user info dropped, empty path of a hierarchical URL written as "/",
+ * empty query and fragment dropped. Path, query and fragment keep their case and encoding.
+ * URLs without "//" after the scheme (about:blank, data:...) keep everything after the
+ * colon as the path. Strings without a scheme, and URLs whose port is not a number from 0 to
+ * 65535, are invalid: they are kept as-is in the path, with no scheme, host or origin.
+ */
+class P_ANDROIDBROWSERCUSTOMTAB_API FABCTUrl
+{
+public:
+    /** Canonicalizes URL; used by ABCTUrlTable::Intern */
+    explicit FABCTUrl(FStringView URL);
+
+    /** Stable id assigned by the table; 0 for URLs that were never interned */
+    uint32 GetId() const { return Id; }
+
+    const FString &GetCanonical() const { return Canonical; }
+
+    /** Lower-cased scheme, without "://" */
+    FStringView GetScheme() const { return Slice(SchemeRange); }
+
+    /** Lower-cased host, without user info or port */
+    FStringView GetHost() const { return Slice(HostRange); }
+
+    /** Explicit port, or the scheme default, or -1 if neither is known */
+    int32 GetPort() const { return Port; }
+
+    /** "scheme://host[:port]" (the PostMessage origin), or empty for non-hierarchical URLs */
+    FStringView GetOrigin() const { return Slice(OriginRange); }
+
+    /** Path starting at "/" */
+    FStringView GetPath() const { return Slice(PathRange); }
+
+    /** Query without "?" */
+    FStringView GetQuery() const { return Slice(QueryRange); }
+
+    /** Fragment without "#" */
+    FStringView GetFragment() const { return Slice(FragmentRange); }
+
+private:
+    friend class FABCTUrlTableImpl;
+
+    struct FRange
+    {
+        int32 Start = 0;
+        int32 Len = 0;
+    };
+
+    FStringView Slice(FRange Range) const { return FStringView(*Canonical + Range.Start, Range.Len); }
+
+    FString Canonical;
+    FRange SchemeRange;
+    FRange HostRange;
+    FRange OriginRange;
+    FRange PathRange;
+    FRange QueryRange;
+    FRange FragmentRange;
+    int32 Port;
+    uint32 Id;
+};
+
+/** Shared handle to an interned URL; events and state hold these instead of URL strings */
+using FABCTUrlRef = TSharedPtr<const FABCTUrl, ESPMode::ThreadSafe>;
+
+/**
+ * ABCTUrlTable
+ *
+ * Process-wide intern table: every distinct canonical URL is parsed once and gets a
+ * stable id. The table holds the most recent MaxEntries URLs; older ones are evicted
+ * (their ids are never reused) but stay alive for as long as someone holds a ref.
+ * Thread-safe.
+ */
+namespace ABCTUrlTable
+{
+    /** Capacity of the table */
+    constexpr int32 MaxEntries = 4096;
+
+    /**
+     * Canonicalizes and interns URL.
+     *
+     * @return The interned URL, or nullptr for an empty URL
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTUrlRef Intern(FStringView URL);
+
+    /** Looks up an interned URL by id; nullptr if unknown or evicted */
+    P_ANDROIDBROWSERCUSTOMTAB_API FABCTUrlRef Find(uint32 Id);
+
+    /** Number of URLs currently in the table */
+    P_ANDROIDBROWSERCUSTOMTAB_API int32 Num();
+
+    /**
+     * Evicts the oldest URLs until at most KeepEntries remain (memory pressure). Evicted URLs
+     * stay alive while referenced and are re-interned with a new id when seen again.
+     */
+    P_ANDROIDBROWSERCUSTOMTAB_API void Trim(int32 KeepEntries);
+}
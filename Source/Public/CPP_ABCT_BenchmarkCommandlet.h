@@ -0,0 +1,43 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - PostMessage channel benchmark commandlet.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CPP_ABCT_BenchmarkCommandlet.generated.h"
+
+/**
+ * UCPP_ABCT_BenchmarkCommandlet
+ *
+ * Runs the channel benchmark (UCPP_ABCT_Base::StartChannelBenchmark) against
+ * FABCTSimulatedBackend in echo page mode, so the same workloads and report format used on
+ * device run on Linux CI without a browser.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=CPP_ABCT_Benchmark -Report=Saved/ABCT/bench-linux.json
+ *
+ * Options:
+ *   -Report=<path>          Report file (default Saved/ABCT/ChannelBenchmark-<time>.json)
+ *   -Samples=<int>          Idle and loaded RTT samples each (default 200)
+ *   -Seconds=<float>        Duration of each throughput size (default 3)
+ *   -Sizes=<int>,<int>,..   Throughput message sizes in characters (default 16,256,4096,65536,1048576)
+ *   -MaxInFlight=<int>      Throughput messages in flight (default 32)
+ *   -FrameRate=<float>      Simulated game frame rate; per-frame budgets depend on it (default 60, 0 = unpaced)
+ *
+ * Returns 0 when the benchmark completed, 1 when it aborted.
+ */
+UCLASS()
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_BenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_ABCT_BenchmarkCommandlet();
+
+    // UCommandlet interface
+    virtual int32 Main(const FString &Params) override;
+};
@@ -0,0 +1,162 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Replicates deep link actions to the server.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "ABCT_DeepLinkNet.h"
+#include "ABCT_Event.h"
+#include "CPP_ABCT_DeepLinkNetComponent.generated.h"
+
+class UCPP_ABCT_Base;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FABCTNetDeepLinkActionDelegate, const FABCTNetDeepLinkAction &, Action);
+
+/**
+ * UCPP_ABCT_DeepLinkNetComponent
+ *
+ * Sends deep links received on a client to the server as typed, compact actions. Add it to
+ * the PlayerController (Server RPCs need a client-owned actor) and list the replicated
+ * actions in Actions. Links are decoded on the client, queued, and sent in one
+ * FABCTNetDeepLinkBatch per net update; the server validates them and calls
+ * OnServerDeepLinkAction, where the game authorizes and applies them.
+ *
+ * Compared with re-sending Action and ParamsJson as strings, a teleport costs a packed id
+ * and a quantized vector instead of two length-prefixed strings, and a burst of links
+ * costs one RPC instead of one each (see the DeepLinkNet spec for measured sizes).
+ */
+UCLASS(ClassGroup = (Punal), meta = (BlueprintSpawnableComponent))
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_DeepLinkNetComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_ABCT_DeepLinkNetComponent();
+
+    // ============================================================================
+    // Client - Queueing
+    // ============================================================================
+
+    /**
+     * Queues every deep link Instance receives whose action is in Actions.
+     *
+     * @param Instance - The custom tab instance to listen to (nullptr stops listening)
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    void ListenTo(UCPP_ABCT_Base *Instance);
+
+    /**
+     * Decodes a deep link and queues it for the next batch.
+     *
+     * @param Action - The deep link action
+     * @param ParamsJson - JSON string containing parameters
+     * @return true if the action is replicated and was queued
+     */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    bool QueueDeepLink(const FString &Action, const FString &ParamsJson);
+
+    /**
+     * Decodes a deep link into its typed form using the spec of its action.
+     * Missing or non-numeric params decode as 0.
+     *
+     * @param Action - The deep link action
+     * @param ParamsJson - JSON string containing parameters
+     * @param OutAction - The decoded action
+     * @return true if Action is in Actions and its spec has at most
+     *         FABCTNetDeepLinkBatch::MaxValuesPerAction int and float params each
+     */
+    bool EncodeDeepLink(FStringView Action, const FString &ParamsJson, FABCTNetDeepLinkAction &OutAction) const;
+
+    /** Sends the queued actions now instead of at the next net update */
+    UFUNCTION(BlueprintCallable, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    void FlushPendingActions();
+
+    /** Actions queued for the next batch */
+    int32 GetNumPendingActions() const { return PendingActions.Num(); }
+
+    /** Replaces the replicated action list; set the same list on client and server before play */
+    void SetActionSpecs(const TArray<FABCTNetDeepLinkActionSpec> &InActions) { Actions = InActions; }
+
+    // ============================================================================
+    // Server - Applying
+    // ============================================================================
+
+    /**
+     * Called on the server for every validated action, in the order the client received them.
+     * Authorize the action here before applying it.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    FABCTNetDeepLinkActionDelegate OnServerDeepLinkAction;
+
+    /**
+     * Reads an integer param of a received action by name.
+     *
+     * @param Action - The received action
+     * @param Param - The param name from the action's IntParams
+     * @param OutValue - The value
+     * @return true if the action has the param
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    bool GetIntParam(const FABCTNetDeepLinkAction &Action, FName Param, int32 &OutValue) const;
+
+    /**
+     * Reads a float param of a received action by name.
+     *
+     * @param Action - The received action
+     * @param Param - The param name from the action's FloatParams
+     * @param OutValue - The value
+     * @return true if the action has the param
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    bool GetFloatParam(const FABCTNetDeepLinkAction &Action, FName Param, float &OutValue) const;
+
+    /**
+     * Validates a batch and calls OnServerDeepLinkAction for each action.
+     * Runs on the server; exposed for listen servers and tests.
+     *
+     * @param Batch - The received batch
+     * @return Number of actions applied
+     */
+    int32 ApplyBatch(const FABCTNetDeepLinkBatch &Batch);
+
+    // UActorComponent interface
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+    /** Replicated actions; the index is the action id, so keep the list identical on client and server */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network")
+    TArray<FABCTNetDeepLinkActionSpec> Actions;
+
+    /** Actions per RPC sent by this client; a longer queue is sent over several net updates. The server accepts up to FABCTNetDeepLinkBatch::MaxActions whatever its own setting. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Network", meta = (ClampMin = "1", ClampMax = "64"))
+    int32 MaxActionsPerBatch;
+
+    UFUNCTION(Server, Reliable, WithValidation)
+    void ServerApplyDeepLinkActions(const FABCTNetDeepLinkBatch &Batch);
+
+private:
+    /** Sends up to MaxActionsPerBatch queued actions in one RPC */
+    void SendBatch();
+
+    /** Spec index of Action, or INDEX_NONE */
+    int32 FindActionId(FStringView Action) const;
+
+    /** The spec of a received action, or nullptr if its id is out of range */
+    const FABCTNetDeepLinkActionSpec *FindSpec(const FABCTNetDeepLinkAction &Action) const;
+
+    void OnBrowserEvent(const FABCTEventRef &Event);
+
+    /** Actions waiting for the next net update */
+    TArray<FABCTNetDeepLinkAction> PendingActions;
+
+    /** World time of the last batch sent */
+    double LastFlushSeconds;
+
+    TWeakObjectPtr<UCPP_ABCT_Base> ListenedInstance;
+    FDelegateHandle ListenHandle;
+};
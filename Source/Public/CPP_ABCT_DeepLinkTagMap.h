@@ -0,0 +1,44 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Deep link action to gameplay tag mapping.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "CPP_ABCT_DeepLinkTagMap.generated.h"
+
+/**
+ * UCPP_ABCT_DeepLinkTagMap
+ *
+ * Maps deep link actions (the host of uewebtest://teleport?x=1000) to gameplay tags.
+ * Assign it to UCPP_ABCT_Base::DeepLinkTagMap and mapped links are dispatched natively
+ * through ABCTDeepLinkRouter with their decoded params, without going through the
+ * Blueprint OnDeepLinkReceived event.
+ */
+UCLASS(BlueprintType)
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_DeepLinkTagMap : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /** Deep link action -> gameplay tag fired for it. Actions are case-insensitive. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    TMap<FName, FGameplayTag> ActionTags;
+
+    /** Whether mapped links also call OnDeepLinkReceived (unmapped links, and mapped ones without a handler, always do) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Deep Link")
+    bool bAlsoNotifyBlueprint = false;
+
+    /**
+     * Finds the tag mapped to Action. Actions never seen as an FName cannot be mapped, so the
+     * lookup does not add them to the name table.
+     *
+     * @param Action - The deep link action
+     * @return The mapped tag, or an invalid tag if Action is not mapped
+     */
+    FGameplayTag FindTag(FStringView Action) const;
+};
@@ -0,0 +1,79 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Blueprint accessors for shared events.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "ABCT_Event.h"
+#include "CPP_ABCT_EventLibrary.generated.h"
+
+/**
+ * UCPP_ABCT_EventLibrary
+ *
+ * Reads FABCTEventHandle fields in Blueprint. The handle is passed by pointer; a string is
+ * only copied when Blueprint asks for it.
+ */
+UCLASS()
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_EventLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Returns whether the handle refers to an event.
+     *
+     * @param Event - The event handle
+     * @return true if the handle is valid
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static bool IsEventValid(const FABCTEventHandle &Event) { return Event.IsValid(); }
+
+    /**
+     * Returns what the event carries.
+     *
+     * @param Event - The event handle
+     * @return The event kind (Navigation for an invalid handle)
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static EABCTEventKind GetEventKind(const FABCTEventHandle &Event);
+
+    /**
+     * Returns the navigation event name or deep link action.
+     *
+     * @param Event - The event handle
+     * @return The name, or empty string for page messages and invalid handles
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static FString GetEventName(const FABCTEventHandle &Event);
+
+    /**
+     * Returns the deep link params JSON or page message.
+     *
+     * @param Event - The event handle
+     * @return The payload, or empty string for navigation events and invalid handles
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static FString GetEventPayload(const FABCTEventHandle &Event);
+
+    /**
+     * Returns the canonical URL of a navigation event.
+     *
+     * @param Event - The event handle
+     * @return The URL, or empty string if the event has none
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static FString GetEventURL(const FABCTEventHandle &Event);
+
+    /**
+     * Returns the PostMessage origin of a page message.
+     *
+     * @param Event - The event handle
+     * @return The origin, or empty string for other kinds
+     */
+    UFUNCTION(BlueprintPure, Category = "Punal|Android|Browser|Chrome Custom Tab|Event")
+    static FString GetEventOrigin(const FABCTEventHandle &Event);
+};
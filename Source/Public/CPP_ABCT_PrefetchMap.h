@@ -0,0 +1,147 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Page and deep link to game asset prefetch mapping.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/SoftObjectPath.h"
+#include "CPP_ABCT_PrefetchMap.generated.h"
+
+class FABCTUrl;
+
+/**
+ * One prefetch rule: the game assets a store page or deep link is about.
+ *
+ * Templates name captures in braces. Page rules capture path segments ("/item/{id}") and
+ * query params (/item?sku=... makes {sku} available); deep link rules capture the link's
+ * params (uewebtest://purchased?id=42 makes {id} available).
+ */
+USTRUCT(BlueprintType)
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTPrefetchRule
+{
+    GENERATED_BODY()
+
+    /** Host of the page ("store.example.com", "*.example.com" for it and its subdomains, empty = any) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    FString Host;
+
+    /**
+     * Path of the page, matched per segment: literal, "*" for any one segment, "{name}" to
+     * capture one, or a final "*" for the rest of the path (e.g. "/item/{id}"). Empty matches
+     * any path. Ignored when DeepLinkAction is set.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    FString PathPattern;
+
+    /** Makes this a deep link rule for the action (case-insensitive) instead of a page rule */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    FName DeepLinkAction;
+
+    /** Primary asset ids to load, "Type:Name" with captures (e.g. "StoreItem:{id}") */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    TArray<FString> PrimaryAssets;
+
+    /** Asset bundles of PrimaryAssets to load along with them (e.g. "Equipped") */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    TArray<FName> Bundles;
+
+    /** Soft object paths to load, with captures (e.g. "/Game/Items/{id}/SK_{id}.SK_{id}") */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    TArray<FString> ObjectPaths;
+
+    /** Async load priority; higher loads first. Deep link loads never go below AsyncLoadHighPriority. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    int32 Priority = 0;
+};
+
+/**
+ * The loads resolved from a page or deep link. Key identifies the set, so a page that
+ * resolves to loads already made does not start them again.
+ */
+struct P_ANDROIDBROWSERCUSTOMTAB_API FABCTPrefetchRequest
+{
+    FString Key;
+    TArray<FPrimaryAssetId> PrimaryAssets;
+    TArray<FName> Bundles;
+    TArray<FSoftObjectPath> ObjectPaths;
+    int32 Priority = 0;
+
+    bool IsEmpty() const { return PrimaryAssets.IsEmpty() && ObjectPaths.IsEmpty(); }
+};
+
+/**
+ * UCPP_ABCT_PrefetchMap
+ *
+ * Maps store pages and deep links to the game assets they show. Assign it to
+ * UCPP_ABCT_Base::PrefetchMap and the assets of a page start loading as soon as the tab
+ * navigates to it, so the item the player buys is in memory by the time the purchase deep
+ * link comes back. Loads for a page the player left before they finished are cancelled.
+ */
+UCLASS(BlueprintType)
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_PrefetchMap : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /** Every matching rule contributes its assets */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    TArray<FABCTPrefetchRule> Rules;
+
+    /** Finished loads kept resident (most recent first) so recently viewed items stay in memory */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Punal|Android|Browser|Chrome Custom Tab|Prefetch")
+    int32 MaxRetainedLoads = 8;
+
+    /**
+     * Resolves the loads for a page.
+     *
+     * @param Url - The page the tab is navigating to
+     * @param OutRequest - The loads of every matching page rule
+     * @return true if anything is to be loaded
+     */
+    bool ResolvePage(const FABCTUrl &Url, FABCTPrefetchRequest &OutRequest) const;
+
+    /**
+     * Resolves the loads for a deep link. Rules for other actions cost no JSON parsing.
+     *
+     * @param Action - The deep link action
+     * @param ParamsJson - The link's params ({"id":"42"})
+     * @param OutRequest - The loads of every matching deep link rule
+     * @return true if anything is to be loaded
+     */
+    bool ResolveDeepLink(FStringView Action, FStringView ParamsJson, FABCTPrefetchRequest &OutRequest) const;
+
+    /**
+     * Matches a host against a rule's Host.
+     *
+     * @param Pattern - "store.example.com", "*.example.com" or empty
+     * @param Host - Lower-cased host of the page
+     * @return true if Host matches
+     */
+    static bool MatchHost(FStringView Pattern, FStringView Host);
+
+    /**
+     * Matches a path against a rule's PathPattern.
+     *
+     * @param Pattern - e.g. "/item/{id}" or "/sale/*"
+     * @param Path - Path of the page
+     * @param OutCaptures - Receives the captured segments by name
+     * @return true if Path matches
+     */
+    static bool MatchPath(FStringView Pattern, FStringView Path, TMap<FString, FString> &OutCaptures);
+
+    /**
+     * Substitutes captures into a template.
+     *
+     * @param Template - e.g. "StoreItem:{id}"
+     * @param Lookup - Returns the value of a capture, or false if there is none
+     * @param OutValue - The expanded template
+     * @return false if the template names a capture Lookup does not have, or one whose value is
+     *         not only letters, digits, '_' and '-' (so a page cannot point it at other assets)
+     */
+    static bool Expand(FStringView Template, TFunctionRef<bool(FStringView Name, FString &OutValue)> Lookup, FString &OutValue);
+};
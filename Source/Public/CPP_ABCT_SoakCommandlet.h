@@ -0,0 +1,50 @@
+/*
+ * @Author: Punal Manalan
+ * @Description: Android Browser Custom Tab Plugin - Long-running soak test commandlet.
+ * @Date: 18/10/2026
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CPP_ABCT_SoakCommandlet.generated.h"
+
+/**
+ * UCPP_ABCT_SoakCommandlet
+ *
+ * Drives the full C++ custom tab pipeline (ABCTIngress -> game thread -> UCPP_ABCT_Base)
+ * against FABCTSimulatedBackend for hours, sampling memory, allocator stats, queue depths
+ * and handle counts, and fails when memory or latency drifts past the configured limits.
+ *
+ * Usage:
+ *   UnrealEditor-Cmd <Project> -run=CPP_ABCT_Soak -Hours=4 -Mix=open=1,nav=10,deeplink=5,post=20
+ *
+ * Options:
+ *   -Hours=<float>           Run length in hours (default 1). -Minutes=<float> overrides it.
+ *   -Mix=<event>=<weight>,.. Relative weights for open, nav, deeplink, post (default 1,10,5,20)
+ *   -EventsPerSecond=<int>   Target event rate (default 500)
+ *   -NavBurst=<int>          Navigations per nav event (default 8)
+ *   -PostFlood=<int>         PostMessages per post event (default 32)
+ *   -SampleSeconds=<float>   Sampling interval (default 60)
+ *   -WarmupSamples=<int>     Samples skipped before the baseline is taken (default 2)
+ *   -MaxRSSGrowthMB=<float>  Allowed resident memory growth over the baseline (default 64)
+ *   -MaxLatencyDrift=<float> Allowed p99 latency growth factor over the baseline (default 4)
+ *   -MaxP99Micros=<int>      Absolute p99 ingress -> dispatch limit in microseconds (default 50000)
+ *   -MaxDeepLinkP99Micros=<int> Absolute p99 deep link handler limit in microseconds (default 50000)
+ *   -MaxQueueDepth=<int>     Allowed ingress queue depth after pumping (default 0)
+ *   -Seed=<int>              Random seed for the event mix (default 1)
+ *
+ * Returns 0 on success, 1 when a threshold was exceeded.
+ */
+UCLASS()
+class P_ANDROIDBROWSERCUSTOMTAB_API UCPP_ABCT_SoakCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UCPP_ABCT_SoakCommandlet();
+
+    // UCommandlet interface
+    virtual int32 Main(const FString &Params) override;
+};
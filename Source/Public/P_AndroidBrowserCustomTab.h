@@ -7,8 +7,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Modules/ModuleManager.h"
 
+class FABCTMetricsEndpoint;
+
 /**
  * Main module class for ViewShed Analysis Plugin
  * Handles module lifecycle (startup/shutdown) and initialization
@@ -21,4 +24,21 @@ public:
 
 	/** Called when module is unloaded from memory */
 	virtual void ShutdownModule() override;
+
+	/**
+	 * One plugin tick: advances the timer wheel, pumps the PostMessage channel, then updates
+	 * the memory budget, the return to game measurement and the resume pipeline. Runs every
+	 * frame from the core ticker; specs and commandlets may call it directly. Game thread only.
+	 */
+	static void Drain();
+
+private:
+	/** Core ticker callback for Drain */
+	static bool Tick(float DeltaTime);
+
+	/** The plugin's one core ticker, registered for the lifetime of the module */
+	FTSTicker::FDelegateHandle TickHandle;
+
+	/** Optional loopback Prometheus endpoint, started with -ABCTMetricsPort=<port> (not in shipping) */
+	TUniquePtr<FABCTMetricsEndpoint> MetricsEndpoint;
 };